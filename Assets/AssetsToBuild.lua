@@ -11,14 +11,20 @@ return
 	meshes =
 	{
 		-- The actual assets can be defined simply as relative path strings (the common case)
-		"Meshes/ceiling.mesh",
-		"Meshes/floor.mesh",
 		"Meshes/metal.mesh",
-		"Meshes/props.mesh",
-		"Meshes/railing.mesh",
-		"Meshes/walls.mesh",
-		"Meshes/player.mesh",
-		"Meshes/flag.mesh",
+		-- The level's textures are packed into one atlas,
+		-- and so these meshes' texture coordinates are moved to where their images are in it
+		{ path = "Meshes/ceiling.mesh", arguments = { "atlas=Textures/level.atlas", "atlasImage=Textures/ceiling.png" } },
+		{ path = "Meshes/floor.mesh", arguments = { "atlas=Textures/level.atlas", "atlasImage=Textures/floor.png" } },
+		{ path = "Meshes/railing.mesh", arguments = { "atlas=Textures/level.atlas", "atlasImage=Textures/railing.png" } },
+		{ path = "Meshes/walls.mesh", arguments = { "atlas=Textures/level.atlas", "atlasImage=Textures/walls.png" } },
+		-- These can be seen from far away (and there can be many players),
+		-- and so simpler levels of detail are built for them
+		{ path = "Meshes/props.mesh", arguments = { "lods" } },
+		-- The player is closed and covers itself from every direction,
+		-- and so its triangles are also ordered to reduce overdraw
+		{ path = "Meshes/player.mesh", arguments = { "lods", "overdraw" } },
+		{ path = "Meshes/flag.mesh", arguments = { "lods" } },
 	},
 	materials =
 	{
@@ -100,9 +100,13 @@ layout( std140, binding = 0 ) uniform constantBuffer_frame
 	mat4 g_transform_cameraToScreen;
 	float g_elapsedSecondCount_total;
 };
+// Every mesh is drawn with an instanced draw call
+// (even if there is only a single instance),
+// and each instance's transform is chosen with gl_InstanceID.
+// The array size must match MAX_INSTANCE_COUNT_PER_DRAW_CALL in ConstantBufferData.h
 layout( std140, binding = 1 ) uniform constantBuffer_drawCall
 {
-	mat4 g_transform_localToWorld;
+	mat4 g_transforms_localToWorld[256];
 };
 
 // Input
@@ -112,6 +116,8 @@ layout( std140, binding = 1 ) uniform constantBuffer_drawCall
 // but must match the C calls to glVertexAttribPointer()
 
 // These values come from one of the sVertex that we filled the vertex buffer with in C code
+// (if the mesh's vertices are compressed then the position is a [0,1] fraction of the way across its bounds
+// and the transform includes the scale and bias that turn it back into local space)
 layout( location = 0 ) in vec3 i_vertexPosition_local;
 layout( location = 1 ) in vec4 i_color;
 layout( location = 2 ) in vec2 i_textureCoordinates;
@@ -156,7 +162,7 @@ void main()
 		// which _must_ have 1 for the w value
 		vec4 vertexPosition_local = vec4( i_vertexPosition_local, 1.0 );
 		// Transform the vertex from local space into world space
-		vec4 vertexPosition_world = vertexPosition_local * g_transform_localToWorld;
+		vec4 vertexPosition_world = vertexPosition_local * g_transforms_localToWorld[gl_InstanceID];
 		// Transform the vertex from world space into camera space
 		vec4 vertexPosition_camera = vertexPosition_world * g_transform_worldToCamera;
 		// Project the vertex from camera space into screen space
@@ -86,6 +86,12 @@ bool eae6320::Application::cbApplication::Initialize_all( const sEntryPointParam
 		EAE6320_ASSERT( false );
 		return false;
 	}
+	// Start the render thread last so that the game can load everything it needs first
+	if ( !Graphics::StartRenderThread() )
+	{
+		EAE6320_ASSERT( false );
+		return false;
+	}
 
 	return true;
 }
@@ -140,6 +146,12 @@ bool eae6320::Application::cbApplication::CleanUp_all()
 {
 	bool wereThereErrors = false;
 
+	// Stop the render thread first so that the game can clean up its graphics resources
+	if ( !Graphics::StopRenderThread() )
+	{
+		wereThereErrors = true;
+		EAE6320_ASSERT( false );
+	}
 	// Clean up the game
 	if ( !CleanUp() )
 	{
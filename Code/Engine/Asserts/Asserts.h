@@ -11,7 +11,9 @@
 #include "Configuration.h"
 
 #ifdef EAE6320_ASSERTS_AREENABLED
-	#include <intrin.h>
+	#if defined( EAE6320_PLATFORM_WINDOWS )
+		#include <intrin.h>
+	#endif
 	#include <sstream>
 #endif
 
@@ -38,6 +40,8 @@
 #ifdef EAE6320_ASSERTS_AREENABLED
 	#if defined( EAE6320_PLATFORM_WINDOWS )
 		#define EAE6320_ASSERTS_BREAK __debugbreak()
+	#elif defined( EAE6320_PLATFORM_LINUX )
+		#define EAE6320_ASSERTS_BREAK __builtin_trap()
 	#else
 		#error "No implementation exists for breaking on asserts"
 	#endif
@@ -51,20 +55,25 @@
 			EAE6320_ASSERTS_BREAK;	\
 		}	\
 	}
-	#define EAE6320_ASSERTF( i_assertion, i_messageToDisplayWhenAssertionIsFalse, ... )	\
+	// The first argument after the assertion is the message to display when it is false
+	// (it is part of the variable arguments so that a message without any insertions
+	// doesn't leave a trailing comma, which only Visual Studio removes)
+	#define EAE6320_ASSERTF( i_assertion, ... )	\
 	{	\
 		static bool shouldThisAssertBeIgnored = false;	\
 		if ( !shouldThisAssertBeIgnored && !static_cast<bool>( i_assertion ) \
 			&& eae6320::Asserts::ShowMessageIfAssertionIsFalseAndReturnWhetherToBreak( __LINE__, __FILE__,	\
-				shouldThisAssertBeIgnored, i_messageToDisplayWhenAssertionIsFalse, __VA_ARGS__ ) )	\
+				shouldThisAssertBeIgnored, __VA_ARGS__ ) )	\
 		{	\
 			EAE6320_ASSERTS_BREAK;	\
 		}	\
 	}
 #else
 	// The macros do nothing when asserts aren't enabled
-	#define EAE6320_ASSERT( i_assertion )
-	#define EAE6320_ASSERTF( i_assertion, i_messageToDisplayWhenAssertionIsFalse, ... )
+	// (the assertion is an unevaluated operand so that variables that are only used to assert
+	// don't cause "unused variable" warnings)
+	#define EAE6320_ASSERT( i_assertion ) { static_cast<void>( sizeof( i_assertion ) ); }
+	#define EAE6320_ASSERTF( i_assertion, ... ) { static_cast<void>( sizeof( i_assertion ) ); }
 #endif
 
 #endif	// EAE6320_ASSERTS_H
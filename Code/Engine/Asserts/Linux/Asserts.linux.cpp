@@ -0,0 +1,24 @@
+// Header Files
+//=============
+
+#include "../Asserts.h"
+
+#include <cstdio>
+
+// Helper Function Definition
+//===========================
+
+#ifdef EAE6320_ASSERTS_AREENABLED
+
+bool eae6320::Asserts::ShowMessageAndReturnWhetherToBreak( std::ostringstream& io_message, bool& io_shouldThisAssertBeIgnoredInTheFuture )
+{
+	// There is nobody to ask (the Linux build runs headless, e.g. on build servers),
+	// and so the message is written to the standard error stream
+	// and the program always breaks (which ends it if there is no debugger attached)
+	std::fprintf( stderr, "Assertion Failed! %s\n", io_message.str().c_str() );
+	std::fflush( stderr );
+	static_cast<void>( io_shouldThisAssertBeIgnoredInTheFuture );
+	return true;
+}
+
+#endif	// EAE6320_ASSERTS_AREENABLED
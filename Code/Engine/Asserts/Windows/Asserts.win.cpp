@@ -1,7 +1,7 @@
 // Header Files
 //=============
 
-#include "../AssertS.h"
+#include "../Asserts.h"
 
 #include "../../Windows/Includes.h"
 
@@ -31,6 +31,8 @@ namespace eae6320 {
 			void Rotate(Math::cVector i_orientation);
 			Math::cMatrix_transformation CalculateWorldToCameraTransformationMatrix();
 			Math::cMatrix_transformation CalculateCameraToScreenTransformationMatrix();
+			float GetNearPlane() const { return m_nearPlane; }
+			float GetFarPlane() const { return m_farPlane; }
 		private:
 			float m_fieldOfView;
 			float m_nearPlane;
@@ -1,4 +1,4 @@
-#include "Checkbox.h"
+#include "CheckBox.h"
 
 eae6320::Graphics::Checkbox::Checkbox()
 {
@@ -8,12 +8,13 @@ eae6320::Graphics::Checkbox::Checkbox()
 eae6320::Graphics::Checkbox::Checkbox(char * i_text, int16_t i_x, int16_t i_y)
 {
 	Text.text = new Graphics::cText(i_text, i_x, i_y);
-	Text.material.Load("data/materials/sprite.material");
+	// The material is shared with the rest of the text so that it is all drawn together
+	Text.material = cMaterial::LoadShared("data/materials/sprite.material");
 }
 
 
 eae6320::Graphics::Checkbox::~Checkbox()
 {
-	Text.text->CleanUp();
-	Text.material.CleanUp();
+	delete Text.text;
+	cMaterial::ReleaseShared(Text.material);
 }
\ No newline at end of file
@@ -23,6 +23,18 @@ namespace eae6320 {
 			Math::cMatrix_transformation g_transform_localToWorld;
 		};
 
+		// A uniform buffer is only guaranteed to be able to hold 16 KB,
+		// which is 256 matrices
+		const unsigned int MAX_INSTANCE_COUNT_PER_DRAW_CALL = 256;
+
+		// Meshes that share a mesh and a material are drawn with a single instanced draw call,
+		// and the vertex shader uses the instance's ID to choose its transform
+		// (only the transforms of the instances that are being drawn are copied to the GPU)
+		struct sInstancedDrawCall
+		{
+			Math::cMatrix_transformation g_transforms_localToWorld[MAX_INSTANCE_COUNT_PER_DRAW_CALL];
+		};
+
 
 		struct sMaterial
 		{
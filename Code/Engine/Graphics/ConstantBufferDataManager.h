@@ -2,6 +2,10 @@
 #define EAE6320_GRAPHICS_CONSTANT_BUFFER_DATA_H
 
 #include "ConstantBufferData.h"
+#include "cRingBufferAllocator.h"
+
+#include <cstddef>
+#include <cstdint>
 
 #if defined( EAE6320_PLATFORM_D3D )
 #include <D3D11.h>
@@ -20,14 +24,51 @@ namespace eae6320
 			bool Initialize(ConstantBufferType bufferType, size_t  bufferSize, void* bufferData);
 			bool Bind();  
 			bool Update(void* bufferData);
+			// Only updates the beginning of the buffer
+			// (e.g. the instances of an instanced draw call that are actually used)
+			bool Update(void* bufferData, size_t updateSize);
 			bool CleanUp();
+
+			// Ring Buffer
+			//------------
+
+			// Constants that change for every draw call (rather than being updated in place before each one)
+			// are written one after another into a ring buffer,
+			// and each draw call binds the range that holds its constants.
+			// The memory that a frame used isn't written to again until the GPU has finished with it.
+			bool InitializeRingBuffer(ConstantBufferType bufferType, size_t ringBufferSize);
+			// Every range that is bound must start at a multiple of this
+			size_t GetRingBufferAlignment() const { return s_ringBuffer.GetAlignment(); }
+			// Returns memory that the given amount of data can be written to
+			// (and the offset of that memory in the buffer), or NULL if there isn't enough room.
+			// The memory can't be used to draw until it is unmapped.
+			void* MapRingBufferRange(size_t size, size_t& o_offset);
+			bool UnmapRingBufferRange();
+			bool BindRange(size_t offset, size_t size);
+			// This must be called after the last draw call of a frame that used the ring buffer
+			bool EndFrame();
 		private:
+			// Waits until the GPU has finished with the oldest frame in the ring buffer
+			// and then makes its memory available
+			bool WaitForOldestRingBufferFrame();
+
 			ConstantBufferType s_bufferType;
 			size_t s_bufferSize;
+			cRingBufferAllocator s_ringBuffer;
 #if defined( EAE6320_PLATFORM_D3D )
 			ID3D11Buffer* s_constantBufferData;
 #elif defined( EAE6320_PLATFORM_GL )
 			GLuint s_constantBufferId;
+			// Each in-flight frame of the ring buffer has a fence
+			// that is signaled when the GPU has finished using it
+			GLsync s_ringBufferFences[cRingBufferAllocator::s_maxFrameCount] = {};
+#elif defined( EAE6320_PLATFORM_NULL )
+			uint32_t s_constantBufferId;
+			// There's no GPU memory to map,
+			// and so the ring buffer is written to CPU memory and recorded when it's unmapped
+			uint8_t* s_ringBufferMemory = NULL;
+			size_t s_mappedOffset = 0;
+			size_t s_mappedSize = 0;
 #endif
 		};
 
@@ -3,70 +3,109 @@
 void eae6320::Graphics::DebugObject::Move(Math::cVector i_position)
 {
 	transform.Move(i_position);
-	meshObject.position = i_position;
 }
 
 void eae6320::Graphics::DebugObject::Rotate(Math::cVector i_rotation)
 {
 	transform.Rotate(i_rotation);
-	meshObject.rotation = transform.getOrientation();
 }
 
+const eae6320::Graphics::MeshObject& eae6320::Graphics::DebugObject::GetMeshObject()
+{
+	meshObject.transform_localToWorld = transform.getLocalToWorldTransform();
+	meshObject.pass = DebugPass;
+	return meshObject;
+}
+
+// Debug shapes are created and changed while the game is running,
+// and so their meshes are built and their materials are loaded by the render thread
+// (the objects themselves are created immediately so that they can be submitted in the same frame)
+
 void eae6320::Graphics::DebugObject::initializeBoxDebugObject(Math::cVector initPosition, Math::cVector initRotation, float width, float height, float depth, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha)
 {
-	meshObject.mesh = new Graphics::Mesh();
-	meshObject.mesh->DrawCube(width, height, depth, red, green, blue, alpha);
-	meshObject.material = new Graphics::cMaterial();
-	meshObject.material->Load(debugshapeMaterialPath);
+	Graphics::Mesh* const mesh = meshObject.mesh = new Graphics::Mesh();
+	Graphics::cMaterial* const material = meshObject.material = new Graphics::cMaterial();
+	const char* const materialPath = debugshapeMaterialPath;
+	ExecuteOnRenderThread([=]()
+	{
+		mesh->DrawCube(width, height, depth, red, green, blue, alpha);
+		material->Load(materialPath);
+	});
 	Move(initPosition);
 	Rotate(initRotation);
 }
 
 void eae6320::Graphics::DebugObject::drawBoxDebugObject(Graphics::cMaterial* material,Math::cVector initPosition, Math::cVector initRotation, float width, float height, float depth, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha)
 {
-	meshObject.mesh = new Graphics::Mesh();
-	meshObject.mesh->DrawCube(width, height, depth, red, green, blue, alpha);
+	Graphics::Mesh* const mesh = meshObject.mesh = new Graphics::Mesh();
+	ExecuteOnRenderThread([=]() { mesh->DrawCube(width, height, depth, red, green, blue, alpha); });
 	meshObject.material = material;
 	Move(initPosition);
 	Rotate(initRotation);
 }
 
-
-
+void eae6320::Graphics::DebugObject::drawSharedDebugObject(Graphics::cMaterial* material, Graphics::Mesh* mesh, Math::cVector initPosition, Math::cVector initRotation)
+{
+	meshObject.mesh = mesh;
+	meshObject.material = material;
+	Move(initPosition);
+	Rotate(initRotation);
+}
 
 void eae6320::Graphics::DebugObject::initializeSphereDebugObject(Math::cVector initPosition, Math::cVector initRotation, float radius, int sliceCount, int stackCount, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha)
 {
-	meshObject.mesh = new Graphics::Mesh();
-	meshObject.mesh->DrawSphere(radius, sliceCount, stackCount, red, green, blue, alpha);
-	meshObject.material = new Graphics::cMaterial();
-	meshObject.material->Load(debugshapeMaterialPath);
+	Graphics::Mesh* const mesh = meshObject.mesh = new Graphics::Mesh();
+	Graphics::cMaterial* const material = meshObject.material = new Graphics::cMaterial();
+	const char* const materialPath = debugshapeMaterialPath;
+	ExecuteOnRenderThread([=]()
+	{
+		mesh->DrawSphere(radius, sliceCount, stackCount, red, green, blue, alpha);
+		material->Load(materialPath);
+	});
 	Move(initPosition);
 	Rotate(initRotation);
 }
 
 void eae6320::Graphics::DebugObject::initializeCylinderDebugObject(Math::cVector initPosition, Math::cVector initRotation, float bottomRadius, float topRadius, float height, int sliceCount, int stackCount, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha)
 {
-	meshObject.mesh = new Graphics::Mesh();
-	meshObject.mesh->DrawCylinder(bottomRadius, topRadius, height, sliceCount, stackCount, red, green, blue, alpha);
-	meshObject.material = new Graphics::cMaterial();
-	meshObject.material->Load(debugshapeMaterialPath);
+	Graphics::Mesh* const mesh = meshObject.mesh = new Graphics::Mesh();
+	Graphics::cMaterial* const material = meshObject.material = new Graphics::cMaterial();
+	const char* const materialPath = debugshapeMaterialPath;
+	ExecuteOnRenderThread([=]()
+	{
+		mesh->DrawCylinder(bottomRadius, topRadius, height, sliceCount, stackCount, red, green, blue, alpha);
+		material->Load(materialPath);
+	});
 	Move(initPosition);
 	Rotate(initRotation);
 }
 
 void eae6320::Graphics::DebugObject::initializeLineDebugObject(Math::cVector initPosition, Math::cVector initRotation, eae6320::Math::cVector start, eae6320::Math::cVector end, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha)
 {
-	meshObject.mesh = new Graphics::Mesh();
-	meshObject.mesh->DrawLine(start, end, red, green, blue, alpha);
-	meshObject.material = new Graphics::cMaterial();
-	meshObject.material->Load(debugshapeMaterialPath);
+	Graphics::Mesh* const mesh = meshObject.mesh = new Graphics::Mesh();
+	Graphics::cMaterial* const material = meshObject.material = new Graphics::cMaterial();
+	const char* const materialPath = debugshapeMaterialPath;
+	ExecuteOnRenderThread([=]()
+	{
+		mesh->DrawLine(start, end, red, green, blue, alpha);
+		material->Load(materialPath);
+	});
 	Move(initPosition);
 	Rotate(initRotation);
 }
 
 void eae6320::Graphics::DebugObject::updateLine(eae6320::Math::cVector start, eae6320::Math::cVector end, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha)
 {
-	meshObject.mesh->DrawLine(start, end, red, green, blue, alpha);
+	// The mesh is only changed once the render thread has finished drawing it
+	Graphics::Mesh* const mesh = meshObject.mesh;
+	ExecuteOnRenderThread([=]() { mesh->DrawLine(start, end, red, green, blue, alpha); });
+}
+
+void eae6320::Graphics::DebugObject::updateSphere(float radius, int sliceCount, int stackCount, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha)
+{
+	// The mesh is only changed once the render thread has finished drawing it
+	Graphics::Mesh* const mesh = meshObject.mesh;
+	ExecuteOnRenderThread([=]() { mesh->DrawSphere(radius, sliceCount, stackCount, red, green, blue, alpha); });
 }
 
 bool eae6320::Graphics::DebugObject::cleanUp()
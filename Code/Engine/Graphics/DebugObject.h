@@ -17,12 +17,18 @@ namespace eae6320
 		public:
 			void Move(Math::cVector);
 			void Rotate(Math::cVector);
+			const Graphics::MeshObject& GetMeshObject();
 			void initializeBoxDebugObject(Math::cVector initPosition, Math::cVector initRotation, float width, float height, float depth, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha);
 			void drawBoxDebugObject(Graphics::cMaterial* material, Math::cVector initPosition, Math::cVector initRotation, float width, float height, float depth, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha);
+			// Uses a mesh that is shared with other debug objects
+			// (debug objects that share a mesh and a material are drawn as instances of a single draw call)
+			void drawSharedDebugObject(Graphics::cMaterial* material, Graphics::Mesh* mesh, Math::cVector initPosition, Math::cVector initRotation);
 			void initializeSphereDebugObject(Math::cVector initPosition, Math::cVector initRotation, float radius, int sliceCount, int stackCount, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha);
 			void initializeCylinderDebugObject(Math::cVector initPosition, Math::cVector initRotation, float bottomRadius, float topRadius, float height, int sliceCount, int stackCount, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha);
 			void initializeLineDebugObject(Math::cVector initPosition, Math::cVector initRotation, eae6320::Math::cVector start, eae6320::Math::cVector end, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha);
 			void updateLine(eae6320::Math::cVector start, eae6320::Math::cVector end, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha);
+			// Rebuilds the sphere's existing mesh instead of creating a new mesh and material
+			void updateSphere(float radius, int sliceCount, int stackCount, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha);
 			bool cleanUp();
 		private:
 			const char* const debugshapeMaterialPath = "data/materials/debugshape.material";
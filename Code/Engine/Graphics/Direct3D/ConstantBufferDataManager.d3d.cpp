@@ -68,6 +68,11 @@ bool eae6320::Graphics::ConstantBufferDataManager::CleanUp() {
 }
 
 bool eae6320::Graphics::ConstantBufferDataManager::Update(void* bufferData) {
+	return Update(bufferData, s_bufferSize);
+}
+
+bool eae6320::Graphics::ConstantBufferDataManager::Update(void* bufferData, size_t updateSize) {
+	EAE6320_ASSERT(updateSize <= s_bufferSize);
 
 	// Get a pointer from Direct3D that can be written to
 	void* memoryToWriteTo = NULL;
@@ -92,7 +97,8 @@ bool eae6320::Graphics::ConstantBufferDataManager::Update(void* bufferData) {
 	if (memoryToWriteTo)
 	{
 		// Copy the new data to the memory that Direct3D has provided
-		memcpy(memoryToWriteTo, bufferData, s_bufferSize);
+		// (the rest of the buffer is undefined after it is discarded)
+		memcpy(memoryToWriteTo, bufferData, updateSize);
 		// Let Direct3D know that the memory contains the data
 		// (the pointer will be invalid after this call)
 		const unsigned int noSubResources = 0;
@@ -12,9 +12,12 @@
 bool eae6320::Graphics::Mesh::Initialize() {
 	s_vertexBuffer = NULL;
 	s_indexBuffer = NULL;
+	// The input layout is created by the effect (for sVertex) rather than by each mesh,
+	// and so the Direct3D mesh builder never compresses vertices
+	EAE6320_ASSERTF(vertexFormat.type == VertexFormats::Uncompressed, "Direct3D meshes can't have compressed vertices");
 		
 	const unsigned int bufferSize = verticesCount * sizeof(sVertex);
-	const unsigned int indexBufferSize = indicesCount*sizeof(uint32_t);
+	const unsigned int indexBufferSize = indicesCount*indexSize;
 	
 	D3D11_BUFFER_DESC bufferDescription = { 0 };
 	{
@@ -90,18 +93,18 @@ void eae6320::Graphics::Mesh::DrawFrame() {
 	// Bind a specific vertex buffer to the device as a data source
 	{
 		EAE6320_ASSERT(s_indexBuffer != NULL);
-		// Every index is a 16 bit unsigned integer
-		const DXGI_FORMAT format = DXGI_FORMAT_R32_UINT;
+		// Every index is either a 16 or a 32 bit unsigned integer
+		const DXGI_FORMAT format = (indexSize == sizeof(uint16_t)) ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT;
 		// The indices start at the beginning of the buffer
 		const unsigned int offset = 0;
 		eae6320::Graphics::Direct3dUtil::getDirect3dContext()->IASetIndexBuffer(s_indexBuffer, format, offset);
 	}
 	// Render triangles from the currently-bound vertex and index buffers
 	{
-		// It's possible to start rendering primitives in the middle of the stream
-		const unsigned int indexOfFirstIndexToUse = 0;
+		// Only the full-detail LOD is drawn
+		const unsigned int indexOfFirstIndexToUse = lods[0].firstIndex;
 		const unsigned int offsetToAddToEachIndex = 0;
-		eae6320::Graphics::Direct3dUtil::getDirect3dContext()->DrawIndexed(indicesCount, indexOfFirstIndexToUse, offsetToAddToEachIndex);
+		eae6320::Graphics::Direct3dUtil::getDirect3dContext()->DrawIndexed(lods[0].indexCount, indexOfFirstIndexToUse, offsetToAddToEachIndex);
 	}
 }
 
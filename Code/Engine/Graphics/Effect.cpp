@@ -1,8 +1,15 @@
 #include "Effect.h"
+
+#include <cstring>
 #include "../Platform/Platform.h"
 #include "../Asserts/Asserts.h"
 #include "../Logging/Logging.h"
 
+// Static Data Initialization
+//===========================
+
+uint32_t eae6320::Graphics::cEffect::s_sortIdCount = 0;
+
 bool eae6320::Graphics::cEffect::LoadBinaryFile(const char* const i_effectBinaryFilePath)
 {
 	bool wereThereErrors = false;
@@ -22,6 +22,10 @@ namespace eae6320
 			void Bind();
 			bool CleanUp();
 
+			bool IsTranslucent() const { return m_renderState.IsAlphaTransparencyEnabled(); }
+			// This is unique to each effect and is used to group draws with the same effect together
+			uint32_t GetSortId() const { return m_sortId; }
+
 		private:
 			bool LoadBinaryFile(const char* const i_effectBinaryFilePath);
 			cRenderState m_renderState;
@@ -36,6 +40,12 @@ namespace eae6320
 #ifdef EAE6320_PLATFORM_GL
 			GLuint s_programId = 0;
 #endif
+#ifdef EAE6320_PLATFORM_NULL
+			uint32_t s_effectId = 0;
+#endif
+			uint32_t m_sortId = s_sortIdCount++;
+
+			static uint32_t s_sortIdCount;
 		};
 	}
 }
@@ -1,21 +1,40 @@
 #include "GameObject.h"
 #include "../Math/cVector.h"
+#include "../Math/Functions.h"
+#include <cmath>
+#include <map>
+#include <string>
+
+namespace
+{
+	// The object is only turned to face its velocity if it is off by more than a degree
+	// (comparing against the cosine avoids an acos for the common case of already facing the right way)
+	constexpr float s_cosineOfTurnThreshold = eae6320::Math::Cos_compileTime( eae6320::Math::ConvertDegreesToRadians( 1.0f ) );
+
+	// Game objects that are loaded from the same files share a mesh and a material
+	// so that the render queue can draw them as instances of a single draw call
+	std::map<std::string, eae6320::Graphics::Mesh*> s_loadedMeshes;
+	std::map<std::string, eae6320::Graphics::cMaterial*> s_loadedMaterials;
+}
 
 void eae6320::Graphics::GameObject::Move(Math::cVector i_position)
 {
 	transform.Move(i_position);
-	meshObject.position = i_position;
-	if (Math::cVector(rigidBody.velocity.x, 0, rigidBody.velocity.z).GetLength() > 1.0f)
+	const Math::cVector horizontalVelocity(rigidBody.velocity.x, 0, rigidBody.velocity.z);
+	const float horizontalSpeedSquared = Math::Dot(horizontalVelocity, horizontalVelocity);
+	if (horizontalSpeedSquared > 1.0f)
 	{
-		float dot = Math::Dot(Math::cVector(rigidBody.velocity.x, 0, rigidBody.velocity.z).CreateNormalized(), transform.getForward());
-		float angle = std::acos(dot) *(180.0f / Math::Pi);
-		Math::cVector cross = Math::Cross(Math::cVector(rigidBody.velocity.x, 0, rigidBody.velocity.z), transform.getForward());
-		if (Math::Dot(transform.getUp(), cross) < 0)
-		{
-			angle = -angle;
-		}
-		if ((angle > 1.0f) || (angle < -1.0f))
+		const Math::cVector forward = transform.getForward();
+		float dot = Math::Dot(horizontalVelocity, forward) / std::sqrt(horizontalSpeedSquared);
+		if (dot < s_cosineOfTurnThreshold)
 		{
+			dot = dot < -1.0f ? -1.0f : dot;
+			float angle = Math::ConvertRadiansToDegrees(std::acos(dot));
+			Math::cVector cross = Math::Cross(horizontalVelocity, forward);
+			if (Math::Dot(transform.getUp(), cross) < 0)
+			{
+				angle = -angle;
+			}
 			Rotate(transform.getRotation() + Math::cVector(0, angle, 0));
 		}
 	}
@@ -24,20 +43,49 @@ void eae6320::Graphics::GameObject::Move(Math::cVector i_position)
 void eae6320::Graphics::GameObject::Rotate(Math::cVector i_rotation)
 {
 	transform.Rotate(i_rotation);
-	meshObject.rotation = transform.getOrientation();
+}
+
+const eae6320::Graphics::MeshObject& eae6320::Graphics::GameObject::GetMeshObject()
+{
+	meshObject.transform_localToWorld = transform.getLocalToWorldTransform();
+	meshObject.previousLod = &previousLod;
+	return meshObject;
 }
 
 void eae6320::Graphics::GameObject::Initialize(Math::cVector initPosition, Math::cVector initRotation, char* meshFilePath, char* materialFilePath)
 {
-	meshObject.mesh = new Graphics::Mesh();
 	if (meshFilePath != nullptr)
 	{
-		meshObject.mesh->LoadBinaryFile(meshFilePath);
+		Graphics::Mesh*& loadedMesh = s_loadedMeshes[meshFilePath];
+		if (!loadedMesh)
+		{
+			// Game objects can be created while the game is running (e.g. when a remote player joins),
+			// and so the files are loaded by the render thread
+			// (the objects themselves are created now so that they can be submitted immediately)
+			Graphics::Mesh* const mesh = loadedMesh = new Graphics::Mesh();
+			const std::string path = meshFilePath;
+			ExecuteOnRenderThread([mesh, path]() { mesh->LoadBinaryFile(path.c_str()); });
+		}
+		meshObject.mesh = loadedMesh;
 	}
-	meshObject.material = new Graphics::cMaterial();
-	if (meshFilePath != nullptr)
+	else
+	{
+		meshObject.mesh = new Graphics::Mesh();
+	}
+	if ((meshFilePath != nullptr) && (materialFilePath != nullptr))
+	{
+		Graphics::cMaterial*& loadedMaterial = s_loadedMaterials[materialFilePath];
+		if (!loadedMaterial)
+		{
+			Graphics::cMaterial* const material = loadedMaterial = new Graphics::cMaterial();
+			const std::string path = materialFilePath;
+			ExecuteOnRenderThread([material, path]() { material->Load(path.c_str()); });
+		}
+		meshObject.material = loadedMaterial;
+	}
+	else
 	{
-		meshObject.material->Load(materialFilePath);
+		meshObject.material = new Graphics::cMaterial();
 	}
 	Move(initPosition);
 	Rotate(initRotation);
@@ -45,6 +93,8 @@ void eae6320::Graphics::GameObject::Initialize(Math::cVector initPosition, Math:
 
 bool eae6320::Graphics::GameObject::cleanUp()
 {
+	// A shared mesh or material can be cleaned up more than once;
+	// the second time doesn't do anything
 	if (meshObject.mesh)
 		meshObject.mesh->CleanUp();
 	if (meshObject.material)
@@ -16,9 +16,14 @@ namespace eae6320
 			Graphics::MeshObject meshObject;
 			Physics::RigidBody rigidBody;
 			Transform transform;
+		private:
+			// This is only used by the render thread (see MeshObject::previousLod)
+			uint32_t previousLod = 0;
 		public:
 			void Move(Math::cVector);
 			void Rotate(Math::cVector);
+			// This updates the mesh object's matrix from the transform and should be used when submitting it to be drawn
+			const Graphics::MeshObject& GetMeshObject();
 			void Initialize(Math::cVector, Math::cVector, char*, char*);
 			bool cleanUp();
 		};
@@ -2,3 +2,271 @@
 //=============
 
 #include "Graphics.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include "cFramePacket.h"
+#include "Internal.h"
+#include "../Asserts/Asserts.h"
+#include "../Logging/Logging.h"
+#include "../Time/Time.h"
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+	// The game thread fills one packet while the render thread draws the other one
+	eae6320::Graphics::cFramePacket s_framePackets[2];
+
+	// This data is only used by the game thread
+	//------------------------------------------
+
+	// The packet that is being filled
+	eae6320::Graphics::cFramePacket* s_framePacket_game = &s_framePackets[0];
+	// The camera is kept between frames
+	// (it's only copied into a packet when the packet is handed to the render thread)
+	eae6320::Graphics::Camera s_camera;
+	eae6320::Graphics::sRenderStatistics s_renderStatistics = {};
+	std::thread s_renderThread;
+
+	// This data is shared by both threads
+	// and must only be accessed while the mutex is locked
+	//----------------------------------------------------
+
+	std::mutex s_mutex;
+	// This is notified whenever anything protected by the mutex changes
+	std::condition_variable s_condition;
+	// The packet that has been handed to the render thread and hasn't finished being drawn
+	// (or NULL if the render thread is waiting for a packet)
+	eae6320::Graphics::cFramePacket* s_framePacket_render = NULL;
+	eae6320::Graphics::sRenderStatistics s_renderStatistics_render = {};
+	bool s_shouldRenderThreadExit = false;
+	// These are set by the render thread once it has tried to make the rendering context current
+	bool s_hasRenderThreadStarted = false;
+	bool s_didRenderThreadStartSuccessfully = false;
+
+	// This is set as soon as the render thread is started (before it is handed any packets)
+	// and reset after it has exited,
+	// and so it can be read by the render thread's tasks without locking
+	std::thread::id s_renderThreadId;
+}
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	void RenderThreadMain();
+}
+
+// Interface
+//==========
+
+// Render
+//-------
+
+void eae6320::Graphics::RenderFrame()
+{
+	// The frame constants are calculated from the camera that was set most recently
+	{
+		sFrame frameData;
+		frameData.g_transform_worldToCamera = s_camera.CalculateWorldToCameraTransformationMatrix();
+		frameData.g_transform_cameraToScreen = s_camera.CalculateCameraToScreenTransformationMatrix();
+		frameData.g_elapsedSecondCount_total = Time::GetElapsedSecondCount_total();
+		s_framePacket_game->SetFrameConstants( frameData, s_camera.GetNearPlane(), s_camera.GetFarPlane() );
+	}
+
+	if ( !s_renderThread.joinable() )
+	{
+		// Without a render thread the packet is drawn by this thread
+		s_framePacket_game->RunTasks();
+		RenderFramePacket( *s_framePacket_game, s_renderStatistics );
+		s_framePacket_game->Reset();
+		return;
+	}
+
+	// Hand the packet that was filled to the render thread
+	{
+		std::unique_lock<std::mutex> lock( s_mutex );
+		// The render thread must finish drawing the previous packet first
+		// because that is the packet that will be filled next
+		s_condition.wait( lock, [] { return s_framePacket_render == NULL; } );
+		s_framePacket_render = s_framePacket_game;
+		s_renderStatistics = s_renderStatistics_render;
+	}
+	s_condition.notify_all();
+	s_framePacket_game = ( s_framePacket_game == &s_framePackets[0] ) ? &s_framePackets[1] : &s_framePackets[0];
+	s_framePacket_game->Reset();
+}
+
+// Submission
+//-----------
+
+void eae6320::Graphics::SetMesh( const MeshObject& i_gameObject )
+{
+	s_framePacket_game->AddMeshObject( i_gameObject );
+}
+
+void eae6320::Graphics::SetSprite( const UIObject& i_uiObject )
+{
+	s_framePacket_game->AddSprite( i_uiObject );
+}
+
+void eae6320::Graphics::AddUIText( const UIText& i_uiText )
+{
+	s_framePacket_game->AddText( i_uiText );
+}
+
+void eae6320::Graphics::SetCamera( const Camera& i_camera )
+{
+	s_camera = i_camera;
+}
+
+// Threading
+//----------
+
+bool eae6320::Graphics::StartRenderThread()
+{
+	EAE6320_ASSERT( !s_renderThread.joinable() );
+
+	// The rendering context was made current on this thread when it was created
+	if ( !ReleaseContext() )
+	{
+		EAE6320_ASSERT( false );
+		return false;
+	}
+	s_shouldRenderThreadExit = false;
+	s_hasRenderThreadStarted = false;
+	s_renderThread = std::thread( RenderThreadMain );
+	s_renderThreadId = s_renderThread.get_id();
+	bool wasSuccessful;
+	{
+		std::unique_lock<std::mutex> lock( s_mutex );
+		s_condition.wait( lock, [] { return s_hasRenderThreadStarted; } );
+		wasSuccessful = s_didRenderThreadStartSuccessfully;
+	}
+	if ( !wasSuccessful )
+	{
+		// The error has already been reported
+		s_renderThread.join();
+		s_renderThreadId = std::thread::id();
+		MakeContextCurrent();
+		return false;
+	}
+
+	Logging::OutputMessage( "The render thread was started" );
+	return true;
+}
+
+bool eae6320::Graphics::StopRenderThread()
+{
+	if ( !s_renderThread.joinable() )
+	{
+		return true;
+	}
+
+	// The render thread finishes drawing any packet that it has been handed before it exits
+	{
+		std::lock_guard<std::mutex> lock( s_mutex );
+		s_shouldRenderThreadExit = true;
+	}
+	s_condition.notify_all();
+	s_renderThread.join();
+	s_renderThreadId = std::thread::id();
+	// The statistics of the last packet that was drawn wouldn't otherwise be seen
+	// until another packet was handed to the render thread
+	s_renderStatistics = s_renderStatistics_render;
+
+	if ( !MakeContextCurrent() )
+	{
+		EAE6320_ASSERT( false );
+		return false;
+	}
+	// Any tasks that were added to the packet that was being filled are run now
+	// (the packet itself will never be drawn)
+	s_framePacket_game->RunTasks();
+	s_framePacket_game->Reset();
+
+	Logging::OutputMessage( "The render thread was stopped" );
+	return true;
+}
+
+void eae6320::Graphics::ExecuteOnRenderThread( const std::function<void()>& i_task )
+{
+	if ( ( s_renderThreadId != std::thread::id() ) && ( std::this_thread::get_id() != s_renderThreadId ) )
+	{
+		s_framePacket_game->AddTask( i_task );
+	}
+	else
+	{
+		i_task();
+	}
+}
+
+// Statistics
+//-----------
+
+const eae6320::Graphics::sRenderStatistics& eae6320::Graphics::GetRenderStatistics()
+{
+	return s_renderStatistics;
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	void RenderThreadMain()
+	{
+		{
+			const bool wasSuccessful = eae6320::Graphics::MakeContextCurrent();
+			{
+				std::lock_guard<std::mutex> lock( s_mutex );
+				s_hasRenderThreadStarted = true;
+				s_didRenderThreadStartSuccessfully = wasSuccessful;
+			}
+			s_condition.notify_all();
+			if ( !wasSuccessful )
+			{
+				EAE6320_ASSERT( false );
+				eae6320::Logging::OutputError( "The render thread couldn't make the rendering context current" );
+				return;
+			}
+		}
+
+		while ( true )
+		{
+			eae6320::Graphics::cFramePacket* framePacket;
+			{
+				std::unique_lock<std::mutex> lock( s_mutex );
+				s_condition.wait( lock, [] { return ( s_framePacket_render != NULL ) || s_shouldRenderThreadExit; } );
+				if ( !s_framePacket_render )
+				{
+					break;
+				}
+				framePacket = s_framePacket_render;
+			}
+
+			// The packet is drawn without locking because the game thread won't touch it
+			// until it has been given back
+			framePacket->RunTasks();
+			eae6320::Graphics::sRenderStatistics statistics;
+			eae6320::Graphics::RenderFramePacket( *framePacket, statistics );
+
+			{
+				std::lock_guard<std::mutex> lock( s_mutex );
+				s_renderStatistics_render = statistics;
+				s_framePacket_render = NULL;
+			}
+			s_condition.notify_all();
+		}
+
+		// The rendering context is released so that it can be made current on the thread that cleans up
+		if ( !eae6320::Graphics::ReleaseContext() )
+		{
+			EAE6320_ASSERT( false );
+		}
+	}
+}
@@ -9,10 +9,12 @@
 //=============
 
 #include "Configuration.h"
+#include <functional>
 #include "Mesh.h"
 #include "ConstantBufferData.h"
 #include "../Math/cVector.h"
 #include "../Math/cQuaternion.h"
+#include "../Math/cMatrix_transformation.h"
 #include "Camera.h"
 #include "cMaterial.h"
 #include "cSprite.h"
@@ -32,6 +34,10 @@ namespace eae6320
 		// Render
 		//-------
 
+		// Everything that has been submitted since the last call is a single frame:
+		// If the render thread is running the frame is handed to it to be drawn
+		// while the calling thread goes on to submit the next frame,
+		// and otherwise it is drawn before this returns
 		void RenderFrame();
 
 		// Initialization / Clean Up
@@ -39,7 +45,11 @@ namespace eae6320
 
 		struct sInitializationParameters
 		{
-#if defined( EAE6320_PLATFORM_WINDOWS )
+#if defined( EAE6320_PLATFORM_NULL )
+			// The null platform doesn't need a window (even on Windows).
+			// If this isn't NULL every frame's commands are written to this file
+			const char* commandListPath;
+#elif defined( EAE6320_PLATFORM_WINDOWS )
 			HWND mainWindow;
 	#if defined( EAE6320_PLATFORM_D3D )
 			unsigned int resolutionWidth, resolutionHeight;
@@ -49,32 +59,96 @@ namespace eae6320
 #endif
 		};
 		
+		// Every mesh in an earlier pass is drawn before any mesh in a later one
+		enum eRenderPass
+		{
+			WorldPass,
+			DebugPass,
+		};
+
 		struct MeshObject
 		{
 			cMaterial *material;
 			Mesh *mesh;
-			Math::cVector position;
-			Math::cQuaternion rotation;
+			// This is copied from the owning object's Transform when it is submitted,
+			// which only rebuilds the matrix if the object has moved or rotated
+			Math::cMatrix_transformation transform_localToWorld;
+			eRenderPass pass = WorldPass;
+			// If this isn't NULL the render thread stores the LOD that the object was drawn with here
+			// so that the object doesn't keep switching LODs when its size on screen is near a threshold
+			// (it must only be used by the render thread and so should be owned by whatever submits the object)
+			uint32_t* previousLod = NULL;
 		};
 		
+		// Sprites and text that share a material are drawn with a single draw call,
+		// and so their materials should be loaded with cMaterial::LoadShared()
 		struct UIObject
 		{
-			cMaterial material;
-			cSprite* sprite;
+			cMaterial* material = NULL;
+			cSprite* sprite = NULL;
 		};
 
 		struct UIText
 		{
-			cMaterial material;
-			cText* text;
+			cMaterial* material = NULL;
+			cText* text = NULL;
 		};
 
 		bool Initialize( const sInitializationParameters& i_initializationParameters );
 		bool CleanUp();
-		void SetMesh(MeshObject i_gameObject);
-		void SetSprite(UIObject i_uiObject);
-		void AddUIText(UIText i_uiText);
-		void SetCamera(Camera i_camera);
+
+		// Submission
+		//-----------
+
+		// These must only be called by the game thread (i.e. the thread that calls RenderFrame()).
+		// Mesh objects and text are copied,
+		// but sprites and UI materials are referenced until the frame has been drawn.
+		void SetMesh(const MeshObject& i_gameObject);
+		void SetSprite(const UIObject& i_uiObject);
+		void AddUIText(const UIText& i_uiText);
+		void SetCamera(const Camera& i_camera);
+
+		// Threading
+		//----------
+
+		// The render thread is started once everything has been loaded
+		// and must be stopped before anything is cleaned up:
+		// While it is running it is the only thread that can use the graphics API
+		bool StartRenderThread();
+		bool StopRenderThread();
+		// Anything that creates or changes graphics resources while the game is running must be done by the render thread.
+		// If the render thread is running and this is called by the game thread
+		// the task is run before the frame that is currently being submitted is drawn
+		// (and so anything that is created by it can be submitted in the same frame),
+		// and otherwise it is run immediately.
+		void ExecuteOnRenderThread(const std::function<void()>& i_task);
+
+		// Statistics
+		//-----------
+
+		struct sRenderStatistics
+		{
+			uint32_t drawCount;
+			// This is how many mesh objects were visible.
+			// Meshes that share a mesh and a material are drawn as instances of a single draw call,
+			// and so this can be much larger than the draw count
+			uint32_t instanceCount;
+			// A state change is binding a material's constant buffer, effect, or texture
+			uint32_t stateChangeCount;
+			// How many state changes there would have been if the meshes were drawn in the order they were submitted
+			uint32_t stateChangeCount_unsorted;
+			// How many mesh objects were submitted but not drawn because they were outside of the camera's frustum
+			uint32_t culledCount;
+			// The number of triangles in every instance that was drawn
+			// (which is lower than it would be without LODs)
+			uint32_t triangleCount;
+			// Sprites and text are drawn with one draw call for each material that they use
+			uint32_t uiDrawCount;
+		};
+
+		// These are the statistics of the most recently rendered frame
+		// (this must only be called by the game thread)
+		const sRenderStatistics& GetRenderStatistics();
 	}
 }
 #endif	// EAE6320_GRAPHICS_H
@@ -0,0 +1,45 @@
+/*
+	This file contains the functions that every platform implements
+	and that are used internally by the platform-independent graphics code
+*/
+
+#ifndef EAE6320_GRAPHICS_INTERNAL_H
+#define EAE6320_GRAPHICS_INTERNAL_H
+
+// Forward Declarations
+//=====================
+
+namespace eae6320
+{
+	namespace Graphics
+	{
+		class cFramePacket;
+		struct sRenderStatistics;
+	}
+}
+
+// Interface
+//==========
+
+namespace eae6320
+{
+	namespace Graphics
+	{
+		// Render
+		//-------
+
+		// Draws everything in a frame packet and presents the result
+		// (this is only called by whichever thread the rendering context is current on)
+		void RenderFramePacket( const cFramePacket& i_framePacket, sRenderStatistics& o_statistics );
+
+		// Threading
+		//----------
+
+		// A rendering context can only be current on one thread at a time,
+		// and so it must be released by one thread before it can be made current on another
+		bool MakeContextCurrent();
+		bool ReleaseContext();
+	}
+}
+
+#endif	// EAE6320_GRAPHICS_INTERNAL_H
@@ -5,8 +5,17 @@
 #include "../Math/Functions.h"
 #include "../Math/cVector.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <vector>
 
+// Static Data Initialization
+//===========================
+
+uint32_t eae6320::Graphics::Mesh::s_sortIdCount = 0;
+const uint32_t eae6320::Graphics::Mesh::MAX_LOD_COUNT;
+
 bool eae6320::Graphics::Mesh::LoadBinaryFile(const char* const i_path) {
 	bool wereThereErrors = false;
 	{
@@ -22,15 +31,38 @@ bool eae6320::Graphics::Mesh::LoadBinaryFile(const char* const i_path) {
 
 		uint8_t* data = reinterpret_cast<uint8_t*>(binaryFile.data);
 
+		// The file is the vertex and index counts, the index size, the vertex format, the bounds, the LODs, the vertices, and then the indices
 		verticesCount = *reinterpret_cast<uint32_t*>(data);
-		indicesCount = *reinterpret_cast<uint32_t*>(data + sizeof(uint32_t));
-
-		size_t size = sizeof(eae6320::Graphics::sVertex)*verticesCount;
-		vertexData = static_cast<eae6320::Graphics::sVertex*>(malloc(size));
-		memcpy(vertexData, data + sizeof(verticesCount), size);
+		data += sizeof(uint32_t);
+		indicesCount = *reinterpret_cast<uint32_t*>(data);
+		data += sizeof(uint32_t);
+		indexSize = *reinterpret_cast<uint32_t*>(data);
+		data += sizeof(uint32_t);
+		EAE6320_ASSERTF((indexSize == sizeof(uint16_t)) || (indexSize == sizeof(uint32_t)), "An index can't be %u bytes", indexSize);
+		vertexFormat = *reinterpret_cast<sVertexFormat*>(data);
+		data += sizeof(sVertexFormat);
+		EAE6320_ASSERTF((vertexFormat.type == VertexFormats::Uncompressed) || VertexFormats::IsCompressed(vertexFormat.type),
+			"%u isn't a valid vertex format", vertexFormat.type);
+		transform_dequantization = Math::cMatrix_transformation::CreateScaleAndTranslationTransform(
+			Math::cVector(vertexFormat.positionScale[0], vertexFormat.positionScale[1], vertexFormat.positionScale[2]),
+			Math::cVector(vertexFormat.positionBias[0], vertexFormat.positionBias[1], vertexFormat.positionBias[2]));
+		boundingBox = *reinterpret_cast<Math::sAABB*>(data);
+		data += sizeof(Math::sAABB);
+		boundingSphere = *reinterpret_cast<Math::sSphere*>(data);
+		data += sizeof(Math::sSphere);
+		{
+			const uint32_t lodCount_file = *reinterpret_cast<uint32_t*>(data);
+			data += sizeof(uint32_t);
+			EAE6320_ASSERTF((lodCount_file > 0) && (lodCount_file <= MAX_LOD_COUNT), "A mesh can't have %u LODs", lodCount_file);
+			// Any extra LODs are ignored
+			lodCount = std::min(lodCount_file, MAX_LOD_COUNT);
+			memcpy(lods, data, sizeof(sLod) * lodCount);
+			data += sizeof(sLod) * lodCount_file;
+		}
 
-		vertexData = reinterpret_cast<eae6320::Graphics::sVertex*>(data + sizeof(uint32_t) + sizeof(uint32_t));
-		indices = reinterpret_cast<uint32_t*>(data + sizeof(uint32_t)*2 + sizeof(eae6320::Graphics::sVertex) * verticesCount);
+		vertexData = data;
+		const size_t vertexSize = VertexFormats::IsCompressed(vertexFormat.type) ? sizeof(sVertex_compressed) : sizeof(sVertex);
+		indices = data + vertexSize * verticesCount;
 		
 		if (!Initialize()) {
 			wereThereErrors = true;
@@ -40,21 +72,51 @@ bool eae6320::Graphics::Mesh::LoadBinaryFile(const char* const i_path) {
 	}
 	return !wereThereErrors;
 }
+
 #ifdef _DEBUG
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	// Gets the sine and cosine of the angle ( i_segment / i_segmentCount ) of the way from zero to i_rangeInRadians
+	void GetSinCos( const float i_rangeInRadians, const int i_segmentCount, const int i_segment,
+		float& o_sin, float& o_cos );
+}
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+	// The debug spheres and cylinders are made with this many slices and stacks,
+	// and so the sines and cosines that they need are calculated at compile time
+	// (any other count calculates them when the mesh is created)
+	constexpr int s_precalculatedSegmentCount = 20;
+	constexpr eae6320::Math::sSinCosTable<s_precalculatedSegmentCount> s_fullCircle =
+		eae6320::Math::CreateSinCosTable<s_precalculatedSegmentCount>( 2.0f * eae6320::Math::Pi );
+	constexpr eae6320::Math::sSinCosTable<s_precalculatedSegmentCount> s_halfCircle =
+		eae6320::Math::CreateSinCosTable<s_precalculatedSegmentCount>( eae6320::Math::Pi );
+}
+
 bool eae6320::Graphics::Mesh::DrawLine(Math::cVector start, Math::cVector end, uint8_t r, uint8_t g, uint8_t b, uint8_t a)
 {
 	bool wereThereErrors = false;
+	ReleaseShape();
 	{
 		verticesCount = 3;
 		indicesCount = 3;
-		vertexData = new sVertex[verticesCount];
+		sVertex* const vertices = new sVertex[verticesCount];
+		vertexData = vertices;
 
-		vertexData[0] = sVertex(start.x, start.y, start.z, r, g, b, a, 0, 0);
-		vertexData[1] = sVertex(end.x, end.y, end.z, r, g, b, a, 0, 0);
-		vertexData[2] = sVertex(start.x, start.y, start.z, r, g, b, a, 0, 0);
+		vertices[0] = sVertex(start.x, start.y, start.z, r, g, b, a, 0, 0);
+		vertices[1] = sVertex(end.x, end.y, end.z, r, g, b, a, 0, 0);
+		vertices[2] = sVertex(start.x, start.y, start.z, r, g, b, a, 0, 0);
 
 		indices = new uint32_t[indicesCount]{0,1,2};
 
+		InitializeBoundsAndLods();
 		if (!Initialize()) {
 			wereThereErrors = true;
 		}
@@ -65,46 +127,48 @@ bool eae6320::Graphics::Mesh::DrawLine(Math::cVector start, Math::cVector end, u
 bool eae6320::Graphics::Mesh::DrawCube(float width, float height, float depth, uint8_t r, uint8_t g, uint8_t b, uint8_t a)
 {
 	bool wereThereErrors = false;
+	ReleaseShape();
 	{
 		verticesCount = 24;
 		indicesCount = 36;
-		vertexData = new sVertex[verticesCount];
+		sVertex* const vertices = new sVertex[verticesCount];
+		vertexData = vertices;
 
 		float w2 = 0.5f*width;
 		float h2 = 0.5f*height;
 		float d2 = 0.5f*depth;
 
 		//front
-		vertexData[0] = sVertex(-w2, -h2, -d2, r, g, b, a, 0, 1);
-		vertexData[1] = sVertex(-w2, +h2, -d2, r, g, b, a, 0, 0);
-		vertexData[2] = sVertex(+w2, +h2, -d2, r, g, b, a, 1, 0);
-		vertexData[3] = sVertex(+w2, -h2, -d2, r, g, b, a, 1, 1);
+		vertices[0] = sVertex(-w2, -h2, -d2, r, g, b, a, 0, 1);
+		vertices[1] = sVertex(-w2, +h2, -d2, r, g, b, a, 0, 0);
+		vertices[2] = sVertex(+w2, +h2, -d2, r, g, b, a, 1, 0);
+		vertices[3] = sVertex(+w2, -h2, -d2, r, g, b, a, 1, 1);
 		// back
-		vertexData[4] = sVertex(-w2, -h2, +d2, r, g, b, a, 1, 1);
-		vertexData[5] = sVertex(+w2, -h2, +d2, r, g, b, a, 0, 1);
-		vertexData[6] = sVertex(+w2, +h2, +d2, r, g, b, a, 0, 0);
-		vertexData[7] = sVertex(-w2, +h2, +d2, r, g, b, a, 1, 0);
+		vertices[4] = sVertex(-w2, -h2, +d2, r, g, b, a, 1, 1);
+		vertices[5] = sVertex(+w2, -h2, +d2, r, g, b, a, 0, 1);
+		vertices[6] = sVertex(+w2, +h2, +d2, r, g, b, a, 0, 0);
+		vertices[7] = sVertex(-w2, +h2, +d2, r, g, b, a, 1, 0);
 		// top
-		vertexData[8] = sVertex(-w2, +h2, -d2, r, g, b, a, 0, 1);
-		vertexData[9] = sVertex(-w2, +h2, +d2, r, g, b, a, 0, 0);
-		vertexData[10] = sVertex(+w2, +h2, +d2, r, g, b, a, 1, 0);
-		vertexData[11] = sVertex(+w2, +h2, -d2, r, g, b, a, 1, 1);
+		vertices[8] = sVertex(-w2, +h2, -d2, r, g, b, a, 0, 1);
+		vertices[9] = sVertex(-w2, +h2, +d2, r, g, b, a, 0, 0);
+		vertices[10] = sVertex(+w2, +h2, +d2, r, g, b, a, 1, 0);
+		vertices[11] = sVertex(+w2, +h2, -d2, r, g, b, a, 1, 1);
 		// bottom
-		vertexData[12] = sVertex(-w2, -h2, -d2, r, g, b, a, 1, 1);
-		vertexData[13] = sVertex(+w2, -h2, -d2, r, g, b, a, 0, 1);
-		vertexData[14] = sVertex(+w2, -h2, +d2, r, g, b, a, 0, 0);
-		vertexData[15] = sVertex(-w2, -h2, +d2, r, g, b, a, 1, 0);
+		vertices[12] = sVertex(-w2, -h2, -d2, r, g, b, a, 1, 1);
+		vertices[13] = sVertex(+w2, -h2, -d2, r, g, b, a, 0, 1);
+		vertices[14] = sVertex(+w2, -h2, +d2, r, g, b, a, 0, 0);
+		vertices[15] = sVertex(-w2, -h2, +d2, r, g, b, a, 1, 0);
 		// left
-		vertexData[16] = sVertex(-w2, -h2, +d2, r, g, b, a, 0, 1);
-		vertexData[17] = sVertex(-w2, +h2, +d2, r, g, b, a, 0, 0);
-		vertexData[18] = sVertex(-w2, +h2, -d2, r, g, b, a, 1, 0);
-		vertexData[19] = sVertex(-w2, -h2, -d2, r, g, b, a, 1, 1);
+		vertices[16] = sVertex(-w2, -h2, +d2, r, g, b, a, 0, 1);
+		vertices[17] = sVertex(-w2, +h2, +d2, r, g, b, a, 0, 0);
+		vertices[18] = sVertex(-w2, +h2, -d2, r, g, b, a, 1, 0);
+		vertices[19] = sVertex(-w2, -h2, -d2, r, g, b, a, 1, 1);
 		// right
-		vertexData[20] = sVertex(+w2, -h2, -d2, r, g, b, a, 0, 1);
-		vertexData[21] = sVertex(+w2, +h2, -d2, r, g, b, a, 0, 0);
-		vertexData[22] = sVertex(+w2, +h2, +d2, r, g, b, a, 1, 0);
+		vertices[20] = sVertex(+w2, -h2, -d2, r, g, b, a, 0, 1);
+		vertices[21] = sVertex(+w2, +h2, -d2, r, g, b, a, 0, 0);
+		vertices[22] = sVertex(+w2, +h2, +d2, r, g, b, a, 1, 0);
 
-		vertexData[23] = sVertex(+w2, -h2, +d2, r, g, b, a, 1, 1);
+		vertices[23] = sVertex(+w2, -h2, +d2, r, g, b, a, 1, 1);
 		indices = new uint32_t[indicesCount]{
 			0,1,2,0,2,3,
 			4,5,6,4,6,7,
@@ -114,6 +178,7 @@ bool eae6320::Graphics::Mesh::DrawCube(float width, float height, float depth, u
 			20,21,22,20,22,23
 		};
 
+		InitializeBoundsAndLods();
 		if (!Initialize()) {
 			wereThereErrors = true;
 		}
@@ -124,28 +189,29 @@ bool eae6320::Graphics::Mesh::DrawCube(float width, float height, float depth, u
 bool eae6320::Graphics::Mesh::DrawSphere(float radius, int sliceCount, int stackCount, uint8_t r, uint8_t g, uint8_t b, uint8_t a)
 {
 	bool wereThereErrors = false;
+	ReleaseShape();
 	{
 		std::vector<sVertex> verticies;
 		verticies.push_back(sVertex(0.0f, radius, 0.0f, r, g, b, a, 0, 0));
 
-		float phiStep = Math::Pi / stackCount;
-		float thetaStep = 2.0f*Math::Pi / sliceCount;
-
 		for (int i = 1; i <= stackCount - 1; i++)
 		{
-			float phi = i*phiStep;
+			float sinPhi, cosPhi;
+			GetSinCos(Math::Pi, stackCount, i, sinPhi, cosPhi);
 			for (int j = 0; j <= sliceCount; j++) {
-				float theta = j*thetaStep;
-				Math::cVector p = Math::cVector((radius*sin(phi)*cos(theta)), (radius*cos(phi)), (radius* sin(phi)*sin(theta)));
+				float sinTheta, cosTheta;
+				GetSinCos(2.0f*Math::Pi, sliceCount, j, sinTheta, cosTheta);
+				Math::cVector p = Math::cVector((radius*sinPhi*cosTheta), (radius*cosPhi), (radius*sinPhi*sinTheta));
 				verticies.push_back(sVertex(p.x, p.y, p.z, r, g, b, a, 0, 0));
 			}
 		}
 		verticies.push_back(sVertex(0, -radius, 0, r, g, b, a, 0, 0));
 		verticesCount = (uint32_t)verticies.size();
-		vertexData = new sVertex[verticesCount];
+		sVertex* const vertices = new sVertex[verticesCount];
+		vertexData = vertices;
 		for (size_t i = 0; i < verticies.size(); i++)
 		{
-			vertexData[i] = verticies[i];
+			vertices[i] = verticies[i];
 		}
 
 		std::vector<uint32_t> indexList;
@@ -182,13 +248,15 @@ bool eae6320::Graphics::Mesh::DrawSphere(float radius, int sliceCount, int stack
 		}
 
 		indicesCount = (uint32_t)indexList.size();
-		indices = new uint32_t[indicesCount];
+		uint32_t* const indexData = new uint32_t[indicesCount];
 
 		for (size_t i = 0; i < indexList.size(); i++)
 		{
-			indices[i] = indexList[i];
+			indexData[i] = indexList[i];
 		}
+		indices = indexData;
 
+		InitializeBoundsAndLods();
 		if (!Initialize()) {
 			wereThereErrors = true;
 		}
@@ -199,6 +267,7 @@ bool eae6320::Graphics::Mesh::DrawSphere(float radius, int sliceCount, int stack
 bool eae6320::Graphics::Mesh::DrawCylinder(float bottomRadius, float topRadius, float height, int sliceCount, int stackCount, uint8_t r, uint8_t g, uint8_t b, uint8_t a)
 {
 	bool wereThereErrors = false;
+	ReleaseShape();
 	{
 		float stackHeight = height / stackCount;
 		float radiusStep = (topRadius - bottomRadius) / stackCount;
@@ -209,11 +278,10 @@ bool eae6320::Graphics::Mesh::DrawCylinder(float bottomRadius, float topRadius,
 		{
 			float y = -0.5f*height + i*stackHeight;
 			float radius = bottomRadius + i*radiusStep;
-			float dTheta = 2.0f*Math::Pi / sliceCount;
 			for (int j = 0; j <= sliceCount; j++)
 			{
-				float c = cos(j*dTheta);
-				float s = sin(j*dTheta);
+				float c, s;
+				GetSinCos(2.0f*Math::Pi, sliceCount, j, s, c);
 				Math::cVector v = Math::cVector(radius*c, y, radius*s);
 				verticies.push_back(sVertex(v.x, v.y, v.z, r, g, b, a, 0, 0));
 			}
@@ -238,19 +306,22 @@ bool eae6320::Graphics::Mesh::DrawCylinder(float bottomRadius, float topRadius,
 		DrawCylinderBottomCap(bottomRadius, height, sliceCount, verticies, indicies, r, g, b, a);
 
 		verticesCount = (uint32_t)verticies.size();
-		vertexData = new sVertex[verticesCount];
+		sVertex* const vertices = new sVertex[verticesCount];
+		vertexData = vertices;
 		for (size_t i = 0; i < verticies.size(); i++)
 		{
-			vertexData[i] = verticies[i];
+			vertices[i] = verticies[i];
 		}
 		indicesCount = (uint32_t)indicies.size();
-		indices = new uint32_t[indicesCount];
+		uint32_t* const indexData = new uint32_t[indicesCount];
 
 		for (size_t i = 0; i < indicies.size(); i++)
 		{
-			indices[i] = indicies[i];
+			indexData[i] = indicies[i];
 		}
+		indices = indexData;
 
+		InitializeBoundsAndLods();
 		if (!Initialize()) {
 			wereThereErrors = true;
 		}
@@ -262,11 +333,12 @@ void eae6320::Graphics::Mesh::DrawCylinderTopCap(float topRadius, float height,
 	int baseIndex = (int)verticies.size();
 
 	float y = 0.5f*height;
-	float dTheta = 2.0f*Math::Pi / sliceCount;
 
 	for (int i = 0; i <= sliceCount; i++) {
-		float x = topRadius*cos(i*dTheta);
-		float z = topRadius*sin(i*dTheta);
+		float s, c;
+		GetSinCos(2.0f*Math::Pi, sliceCount, i, s, c);
+		float x = topRadius*c;
+		float z = topRadius*s;
 
 		verticies.push_back(sVertex(x, y, z, red, green, blue, alpha, 0, 0));
 	}
@@ -284,11 +356,12 @@ void eae6320::Graphics::Mesh::DrawCylinderBottomCap(float bottomRadius, float he
 	int baseIndex = (int)verticies.size();
 
 	float y = -0.5f*height;
-	float dTheta = 2.0f*Math::Pi / sliceCount;
 
 	for (int i = 0; i <= sliceCount; i++) {
-		float x = bottomRadius*cos(i*dTheta);
-		float z = bottomRadius*sin(i*dTheta);
+		float s, c;
+		GetSinCos(2.0f*Math::Pi, sliceCount, i, s, c);
+		float x = bottomRadius*c;
+		float z = bottomRadius*s;
 
 		verticies.push_back(sVertex(x, y, z, red, green, blue, alpha, 0, 0));
 	}
@@ -300,4 +373,77 @@ void eae6320::Graphics::Mesh::DrawCylinderBottomCap(float bottomRadius, float he
 		indicies.push_back(baseIndex + i + 1);
 	}
 }
+
+void eae6320::Graphics::Mesh::ReleaseShape()
+{
+	if (!ownsShapeData)
+	{
+		return;
+	}
+	CleanUp();
+	delete [] static_cast<sVertex*>(vertexData);
+	delete [] static_cast<uint32_t*>(indices);
+	vertexData = NULL;
+	indices = NULL;
+	ownsShapeData = false;
+}
+
+void eae6320::Graphics::Mesh::InitializeBoundsAndLods()
+{
+	ownsShapeData = true;
+	EAE6320_ASSERT(verticesCount > 0);
+	const sVertex* const vertices = static_cast<const sVertex*>(vertexData);
+	boundingBox.m_min = boundingBox.m_max = Math::cVector(vertices[0].x, vertices[0].y, vertices[0].z);
+	for (uint32_t i = 1; i < verticesCount; ++i)
+	{
+		boundingBox.Expand(Math::cVector(vertices[i].x, vertices[i].y, vertices[i].z));
+	}
+	// The sphere is centered on the box
+	// (which isn't the smallest possible sphere but is always close enough for culling)
+	boundingSphere.m_center = boundingBox.GetCenter();
+	boundingSphere.m_radius = 0.0f;
+	for (uint32_t i = 0; i < verticesCount; ++i)
+	{
+		boundingSphere.m_radius = std::max(boundingSphere.m_radius,
+			(Math::cVector(vertices[i].x, vertices[i].y, vertices[i].z) - boundingSphere.m_center).GetLength());
+	}
+
+	lodCount = 1;
+	lods[0].firstIndex = 0;
+	lods[0].indexCount = indicesCount;
+
+	vertexFormat.type = VertexFormats::Uncompressed;
+	transform_dequantization = Math::cMatrix_transformation();
+	indexSize = sizeof(uint32_t);
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	void GetSinCos( const float i_rangeInRadians, const int i_segmentCount, const int i_segment,
+		float& o_sin, float& o_cos )
+	{
+		EAE6320_ASSERT( ( i_segment >= 0 ) && ( i_segment <= i_segmentCount ) );
+		if ( i_segmentCount == s_precalculatedSegmentCount )
+		{
+			if ( i_rangeInRadians == eae6320::Math::Pi )
+			{
+				o_sin = s_halfCircle.sines[i_segment];
+				o_cos = s_halfCircle.cosines[i_segment];
+				return;
+			}
+			else if ( i_rangeInRadians == ( 2.0f * eae6320::Math::Pi ) )
+			{
+				o_sin = s_fullCircle.sines[i_segment];
+				o_cos = s_fullCircle.cosines[i_segment];
+				return;
+			}
+		}
+		const float angle = i_rangeInRadians * static_cast<float>( i_segment ) / static_cast<float>( i_segmentCount );
+		o_sin = std::sin( angle );
+		o_cos = std::cos( angle );
+	}
+}
 #endif
\ No newline at end of file
@@ -8,6 +8,8 @@
 #include "VertexData.h"
 #include <stdint.h>
 #include <vector>
+#include "../Math/BoundingVolumes.h"
+#include "../Math/cMatrix_transformation.h"
 #include "../Math/cVector.h"
 #include "../../External/Lua/Includes.h"
 
@@ -28,22 +30,75 @@ namespace eae6320
 	{
 		class Mesh {
 		public:
+			// Each level of detail is a range of the index buffer
+			// (they all use the same vertices)
+			struct sLod {
+				uint32_t firstIndex;
+				uint32_t indexCount;
+			};
+			static const uint32_t MAX_LOD_COUNT = 4;
+
 			bool LoadBinaryFile(const char* const i_path);
 			bool Initialize();
 			void DrawFrame();
+			// Draws the mesh the given number of times with a single draw call
+			// (the vertex shader uses the instance ID to choose each copy's transform)
+			void DrawInstances(uint32_t instanceCount, uint32_t lod = 0);
 			bool CleanUp();
 			uint32_t getIndicesCount() {
 				return indicesCount;
 			}
 
-			sVertex * getVertexData() {
+			// The vertices are either sVertex or sVertex_compressed
+			// (depending on the vertex format)
+			void * getVertexData() {
 				return vertexData;
 			}
 
-			uint32_t *getIndices() {
+			const sVertexFormat& getVertexFormat() const {
+				return vertexFormat;
+			}
+
+			// Compressed positions must be transformed by this before the local-to-world transform
+			// (it is the identity for uncompressed meshes)
+			const Math::cMatrix_transformation& getTransform_dequantization() const {
+				return transform_dequantization;
+			}
+
+			// Each index is either a uint16_t or a uint32_t
+			// (meshes with few enough vertices are built with 16 bit indices)
+			void *getIndices() {
 				return indices;
 			}
 
+			uint32_t getIndexSize() const {
+				return indexSize;
+			}
+
+			// The bounds are in the mesh's local space
+			// (they are calculated when the mesh is built and stored in its binary file)
+			const Math::sAABB& getBoundingBox() const {
+				return boundingBox;
+			}
+
+			const Math::sSphere& getBoundingSphere() const {
+				return boundingSphere;
+			}
+
+			// LOD 0 is the full mesh and every following LOD has fewer triangles
+			uint32_t getLodCount() const {
+				return lodCount;
+			}
+
+			const sLod& getLod(uint32_t lod) const {
+				return lods[lod];
+			}
+
+			// This is unique to each mesh and is used to order draws that have the same material
+			uint32_t getSortId() const {
+				return sortId;
+			}
+
 #ifdef _DEBUG
 			bool DrawLine(Math::cVector start, Math::cVector end, uint8_t r, uint8_t g, uint8_t b, uint8_t a);
 			bool DrawCube(float width, float height, float depth, uint8_t r, uint8_t g, uint8_t b, uint8_t a);
@@ -53,14 +108,36 @@ namespace eae6320
 		
 		private:
 			uint32_t verticesCount;
-			sVertex* vertexData;
+			void* vertexData;
+			sVertexFormat vertexFormat = { VertexFormats::Uncompressed, { 1.0f, 1.0f, 1.0f }, { 0.0f, 0.0f, 0.0f } };
+			Math::cMatrix_transformation transform_dequantization;
 			uint32_t indicesCount;
-			uint32_t* indices;
+			void* indices;
+			uint32_t indexSize = sizeof(uint32_t);
+			Math::sAABB boundingBox;
+			Math::sSphere boundingSphere = { Math::cVector(), 0.0f };
+			sLod lods[MAX_LOD_COUNT];
+			uint32_t lodCount = 0;
+			uint32_t sortId = s_sortIdCount++;
+
+			static uint32_t s_sortIdCount;
 
+#ifdef _DEBUG
+			// The debug shapes aren't loaded from binary files,
+			// and so their bounds are calculated from their vertices, they only have one LOD,
+			// their vertices are never compressed, and their indices are always 32 bit
+			void InitializeBoundsAndLods();
+			// A shape that is drawn again (e.g. a line that moved or a sphere whose radius changed)
+			// releases the buffers and the vertex and index data that it was drawn with before
+			void ReleaseShape();
+			bool ownsShapeData = false;
+#endif // DEBUG
 			void DrawCylinderTopCap(float topRadius, float height, int sliceCount, std::vector<sVertex> &verticies, std::vector<uint32_t> &indicies, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha);
 			void DrawCylinderBottomCap(float bottomRadius, float height, int sliceCount, std::vector<sVertex> &verticies, std::vector<uint32_t> &indicies, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha);
 
-#if defined( EAE6320_PLATFORM_WINDOWS )
+#if defined( EAE6320_PLATFORM_NULL )
+			uint32_t s_meshId = 0;
+#elif defined( EAE6320_PLATFORM_WINDOWS )
 			HWND mainWindow;
 #if defined( EAE6320_PLATFORM_D3D )
 			ID3D11Buffer* s_vertexBuffer=NULL;
@@ -0,0 +1,237 @@
+// Header Files
+//=============
+
+#include "CommandList.h"
+
+#include <cstring>
+#include <fstream>
+#include <vector>
+#include "../../Asserts/Asserts.h"
+#include "../../Logging/Logging.h"
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+	std::vector<eae6320::Graphics::CommandList::sCommand> s_commands;
+	std::vector<uint8_t> s_data;
+	uint32_t s_resourceIdCount = 0;
+	uint32_t s_frameCount = 0;
+
+	std::ofstream s_file;
+	// Commands before this index have already been written to the file
+	size_t s_writtenCommandCount = 0;
+
+	const char* const s_commandTypeNames[] =
+	{
+		"CreateConstantBuffer",
+		"CreateEffect",
+		"CreateMesh",
+		"CreateTexture",
+		"CreateDynamicBuffer",
+		"DestroyResource",
+
+		"BindConstantBuffer",
+		"BindConstantBufferRange",
+		"UpdateConstantBuffer",
+		"BindEffect",
+		"BindRenderState",
+		"BindTexture",
+		"UpdateDynamicBuffer",
+
+		"Clear",
+		"DrawMesh",
+		"DrawMeshInstanced",
+		"DrawDynamicBuffer",
+		"Present",
+	};
+	static_assert( ( sizeof( s_commandTypeNames ) / sizeof( *s_commandTypeNames ) ) == eae6320::Graphics::CommandList::CommandTypeCount,
+		"Every command type must have a name" );
+}
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	void WritePendingCommands();
+}
+
+// Interface
+//==========
+
+// Recording
+//----------
+
+uint32_t eae6320::Graphics::CommandList::CreateResourceId()
+{
+	return ++s_resourceIdCount;
+}
+
+void eae6320::Graphics::CommandList::Record( const eCommandType i_type, const uint32_t i_resourceId, const uint32_t i_argument,
+	const void* const i_data, const size_t i_dataSize )
+{
+	EAE6320_ASSERT( i_type < CommandTypeCount );
+	EAE6320_ASSERT( ( i_data != NULL ) || ( i_dataSize == 0 ) );
+	sCommand command;
+	command.type = i_type;
+	command.resourceId = i_resourceId;
+	command.argument = i_argument;
+	command.dataOffset = static_cast<uint32_t>( s_data.size() );
+	command.dataSize = static_cast<uint32_t>( i_dataSize );
+	if ( i_dataSize > 0 )
+	{
+		s_data.resize( s_data.size() + i_dataSize );
+		std::memcpy( &s_data[command.dataOffset], i_data, i_dataSize );
+	}
+	s_commands.push_back( command );
+}
+
+void eae6320::Graphics::CommandList::BeginFrame()
+{
+	// Anything recorded since the last frame ended (e.g. loading) is kept in the file
+	WritePendingCommands();
+	// The vectors keep their memory so that recording doesn't need to allocate every frame
+	s_commands.clear();
+	s_data.clear();
+	s_writtenCommandCount = 0;
+}
+
+void eae6320::Graphics::CommandList::EndFrame()
+{
+	Record( Present, 0, s_frameCount );
+	++s_frameCount;
+	WritePendingCommands();
+}
+
+// Access
+//-------
+
+const eae6320::Graphics::CommandList::sCommand* eae6320::Graphics::CommandList::GetCommands()
+{
+	return s_commands.empty() ? NULL : &s_commands[0];
+}
+
+size_t eae6320::Graphics::CommandList::GetCommandCount()
+{
+	return s_commands.size();
+}
+
+const uint8_t* eae6320::Graphics::CommandList::GetData( const sCommand& i_command )
+{
+	return ( i_command.dataSize > 0 ) ? &s_data[i_command.dataOffset] : NULL;
+}
+
+uint32_t eae6320::Graphics::CommandList::GetFrameCount()
+{
+	return s_frameCount;
+}
+
+const char* eae6320::Graphics::CommandList::GetCommandTypeName( const eCommandType i_type )
+{
+	return ( i_type < CommandTypeCount ) ? s_commandTypeNames[i_type] : "Unknown";
+}
+
+// Serialization
+//--------------
+
+bool eae6320::Graphics::CommandList::OpenFile( const char* const i_path, std::string* const o_errorMessage )
+{
+	CloseFile();
+	s_file.open( i_path, std::ofstream::out | std::ofstream::trunc );
+	if ( !s_file.is_open() )
+	{
+		if ( o_errorMessage )
+		{
+			*o_errorMessage = std::string( "The command list file \"" ) + i_path + "\" couldn't be opened for writing";
+		}
+		return false;
+	}
+	// Nothing that was recorded before the file was opened is written
+	s_writtenCommandCount = s_commands.size();
+	return true;
+}
+
+bool eae6320::Graphics::CommandList::CloseFile()
+{
+	if ( s_file.is_open() )
+	{
+		WritePendingCommands();
+		s_file.close();
+		if ( s_file.fail() )
+		{
+			EAE6320_ASSERT( false );
+			Logging::OutputError( "Failed to write the command list file" );
+			return false;
+		}
+	}
+	return true;
+}
+
+// Clean Up
+//---------
+
+bool eae6320::Graphics::CommandList::CleanUp()
+{
+	const bool result = CloseFile();
+	std::vector<sCommand>().swap( s_commands );
+	std::vector<uint8_t>().swap( s_data );
+	s_writtenCommandCount = 0;
+	return result;
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	void WritePendingCommands()
+	{
+		if ( !s_file.is_open() )
+		{
+			s_writtenCommandCount = s_commands.size();
+			return;
+		}
+		// Each command is written on its own line with any data as hexadecimal words
+		// (the data is usually floats, and writing the bits exactly means that any difference will show up in a diff)
+		static const char* const s_hexDigits = "0123456789abcdef";
+		std::string line;
+		for ( size_t i = s_writtenCommandCount; i < s_commands.size(); ++i )
+		{
+			const eae6320::Graphics::CommandList::sCommand& command = s_commands[i];
+			s_file << eae6320::Graphics::CommandList::GetCommandTypeName( command.type )
+				<< " " << command.resourceId << " " << command.argument;
+			if ( command.dataSize > 0 )
+			{
+				line.clear();
+				const uint8_t* const data = &s_data[command.dataOffset];
+				uint32_t j = 0;
+				for ( ; ( j + 4 ) <= command.dataSize; j += 4 )
+				{
+					uint32_t word;
+					std::memcpy( &word, data + j, sizeof( word ) );
+					line += ' ';
+					for ( int shift = 28; shift >= 0; shift -= 4 )
+					{
+						line += s_hexDigits[( word >> shift ) & 0xf];
+					}
+				}
+				// Any remaining bytes are written individually
+				for ( ; j < command.dataSize; ++j )
+				{
+					line += ' ';
+					line += s_hexDigits[data[j] >> 4];
+					line += s_hexDigits[data[j] & 0xf];
+				}
+				s_file << line;
+			}
+			s_file << "\n";
+			if ( command.type == eae6320::Graphics::CommandList::Present )
+			{
+				s_file << "\n";
+			}
+		}
+		s_writtenCommandCount = s_commands.size();
+	}
+}
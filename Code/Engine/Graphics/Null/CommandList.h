@@ -0,0 +1,140 @@
+/*
+	The null platform doesn't draw anything;
+	instead every graphics call is recorded into an in-memory command list.
+
+	This makes it possible to run (and profile) everything on the CPU side of rendering
+	without a window or a GPU,
+	and the recorded commands can be saved to a text file (one command per line)
+	so that the submissions of two builds can be compared with a normal diff tool.
+*/
+
+#ifndef EAE6320_GRAPHICS_NULL_COMMANDLIST_H
+#define EAE6320_GRAPHICS_NULL_COMMANDLIST_H
+
+// Header Files
+//=============
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Enum Declarations
+//==================
+
+namespace eae6320
+{
+	namespace Graphics
+	{
+		namespace CommandList
+		{
+			enum eCommandType
+			{
+				// Resources
+				CreateConstantBuffer,
+				CreateEffect,
+				CreateMesh,
+				CreateTexture,
+				CreateDynamicBuffer,
+				DestroyResource,
+
+				// State
+				BindConstantBuffer,
+				// The data is the offset and size of the range
+				BindConstantBufferRange,
+				UpdateConstantBuffer,
+				BindEffect,
+				BindRenderState,
+				BindTexture,
+				UpdateDynamicBuffer,
+
+				// Drawing
+				Clear,
+				DrawMesh,
+				// The data is the instance count and the first index
+				DrawMeshInstanced,
+				// The data is the first index (if the draw doesn't start at the beginning)
+				DrawDynamicBuffer,
+				Present,
+
+				CommandTypeCount
+			};
+		}
+	}
+}
+
+// Struct Declarations
+//====================
+
+namespace eae6320
+{
+	namespace Graphics
+	{
+		namespace CommandList
+		{
+			struct sCommand
+			{
+				eCommandType type;
+				// The ID of the resource that the command uses (or 0 if it doesn't use one)
+				uint32_t resourceId;
+				// The meaning of this depends on the command
+				// (e.g. the texture unit, the index count, or the render state bits)
+				uint32_t argument;
+				// Some commands also copy data (e.g. the new contents of a constant buffer),
+				// which is stored separately from the commands
+				uint32_t dataOffset;
+				uint32_t dataSize;
+			};
+		}
+	}
+}
+
+// Interface
+//==========
+
+namespace eae6320
+{
+	namespace Graphics
+	{
+		namespace CommandList
+		{
+			// Recording
+			//----------
+
+			// This is the null platform's equivalent of glGen*():
+			// every resource gets a unique non-zero ID
+			uint32_t CreateResourceId();
+			void Record( const eCommandType i_type, const uint32_t i_resourceId, const uint32_t i_argument = 0,
+				const void* const i_data = NULL, const size_t i_dataSize = 0 );
+			// Resources are created outside of frames (e.g. while loading),
+			// and so the command list is only emptied at the start of a frame.
+			// If a file was opened then the finished frame is written to it first.
+			void BeginFrame();
+			void EndFrame();
+
+			// Access
+			//-------
+
+			// The commands are stored contiguously,
+			// and stay valid until the next command is recorded or the next frame begins
+			const sCommand* GetCommands();
+			size_t GetCommandCount();
+			const uint8_t* GetData( const sCommand& i_command );
+			uint32_t GetFrameCount();
+			const char* GetCommandTypeName( const eCommandType i_type );
+
+			// Serialization
+			//--------------
+
+			// Every frame that ends while the file is open is appended to it
+			bool OpenFile( const char* const i_path, std::string* const o_errorMessage = NULL );
+			bool CloseFile();
+
+			// Clean Up
+			//---------
+
+			bool CleanUp();
+		}
+	}
+}
+
+#endif	// EAE6320_GRAPHICS_NULL_COMMANDLIST_H
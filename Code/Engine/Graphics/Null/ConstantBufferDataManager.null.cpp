@@ -0,0 +1,140 @@
+// Header Files
+//=============
+
+#include "../ConstantBufferDataManager.h"
+
+#include <cstdlib>
+#include "CommandList.h"
+#include "../StateCache.h"
+#include "../../Asserts/Asserts.h"
+
+// Interface
+//==========
+
+bool eae6320::Graphics::ConstantBufferDataManager::Initialize( ConstantBufferType bufferType, size_t bufferSize, void* bufferData )
+{
+	s_bufferType = bufferType;
+	s_bufferSize = bufferSize;
+	s_constantBufferId = CommandList::CreateResourceId();
+	// A buffer without initial data (e.g. a ring buffer) is recorded without any
+	CommandList::Record( CommandList::CreateConstantBuffer, s_constantBufferId, static_cast<uint32_t>( s_bufferType ),
+		bufferData, bufferData ? s_bufferSize : 0 );
+	return true;
+}
+
+bool eae6320::Graphics::ConstantBufferDataManager::Bind()
+{
+	EAE6320_ASSERT( s_constantBufferId != 0 );
+	if ( StateCache::BindUniformBufferToBindingPoint( static_cast<unsigned int>( s_bufferType ), s_constantBufferId ) )
+	{
+		CommandList::Record( CommandList::BindConstantBuffer, s_constantBufferId, static_cast<uint32_t>( s_bufferType ) );
+	}
+	return true;
+}
+
+bool eae6320::Graphics::ConstantBufferDataManager::Update( void* bufferData )
+{
+	return Update( bufferData, s_bufferSize );
+}
+
+bool eae6320::Graphics::ConstantBufferDataManager::Update( void* bufferData, size_t updateSize )
+{
+	EAE6320_ASSERT( s_constantBufferId != 0 );
+	EAE6320_ASSERT( updateSize <= s_bufferSize );
+	CommandList::Record( CommandList::UpdateConstantBuffer, s_constantBufferId, 0, bufferData, updateSize );
+	return true;
+}
+
+bool eae6320::Graphics::ConstantBufferDataManager::CleanUp()
+{
+	if ( s_ringBufferMemory )
+	{
+		free( s_ringBufferMemory );
+		s_ringBufferMemory = NULL;
+	}
+	s_ringBuffer.Reset();
+	if ( s_constantBufferId != 0 )
+	{
+		CommandList::Record( CommandList::DestroyResource, s_constantBufferId );
+		StateCache::NotifyBufferDeleted( s_constantBufferId );
+		s_constantBufferId = 0;
+	}
+	return true;
+}
+
+// Ring Buffer
+//------------
+
+bool eae6320::Graphics::ConstantBufferDataManager::InitializeRingBuffer( ConstantBufferType bufferType, size_t ringBufferSize )
+{
+	// This is the most common uniform buffer offset alignment
+	const size_t alignment = 256;
+	if ( !s_ringBuffer.Initialize( ringBufferSize, alignment ) )
+	{
+		return false;
+	}
+	s_ringBufferMemory = static_cast<uint8_t*>( malloc( ringBufferSize ) );
+	if ( !s_ringBufferMemory )
+	{
+		EAE6320_ASSERT( false );
+		return false;
+	}
+	return Initialize( bufferType, ringBufferSize, NULL );
+}
+
+void* eae6320::Graphics::ConstantBufferDataManager::MapRingBufferRange( size_t size, size_t& o_offset )
+{
+	EAE6320_ASSERT( s_ringBufferMemory );
+	EAE6320_ASSERT( s_mappedSize == 0 );
+	while ( !s_ringBuffer.Allocate( size, o_offset ) )
+	{
+		if ( ( s_ringBuffer.GetInFlightFrameCount() == 0 ) || !WaitForOldestRingBufferFrame() )
+		{
+			EAE6320_ASSERTF( false, "The ring buffer is too small" );
+			return NULL;
+		}
+	}
+	s_mappedOffset = o_offset;
+	s_mappedSize = size;
+	return s_ringBufferMemory + o_offset;
+}
+
+bool eae6320::Graphics::ConstantBufferDataManager::UnmapRingBufferRange()
+{
+	EAE6320_ASSERT( s_mappedSize > 0 );
+	// Everything that was written while the range was mapped is recorded at once
+	CommandList::Record( CommandList::UpdateConstantBuffer, s_constantBufferId, static_cast<uint32_t>( s_mappedOffset ),
+		s_ringBufferMemory + s_mappedOffset, s_mappedSize );
+	s_mappedOffset = s_mappedSize = 0;
+	return true;
+}
+
+bool eae6320::Graphics::ConstantBufferDataManager::BindRange( size_t offset, size_t size )
+{
+	EAE6320_ASSERT( ( offset % s_ringBuffer.GetAlignment() ) == 0 );
+	EAE6320_ASSERT( ( offset + size ) <= s_ringBuffer.GetSize() );
+	const uint32_t range[] = { static_cast<uint32_t>( offset ), static_cast<uint32_t>( size ) };
+	CommandList::Record( CommandList::BindConstantBufferRange, s_constantBufferId, static_cast<uint32_t>( s_bufferType ), range, sizeof( range ) );
+	StateCache::NotifyUniformBufferRangeBound( static_cast<unsigned int>( s_bufferType ), s_constantBufferId );
+	return true;
+}
+
+bool eae6320::Graphics::ConstantBufferDataManager::EndFrame()
+{
+	// There is no GPU to wait for,
+	// and so a frame is only released when the maximum number are in flight
+	// (which uses the ring buffer the same way as a GPU that is that many frames behind)
+	if ( !s_ringBuffer.CanEndFrame() && !WaitForOldestRingBufferFrame() )
+	{
+		return false;
+	}
+	s_ringBuffer.EndFrame();
+	return true;
+}
+
+bool eae6320::Graphics::ConstantBufferDataManager::WaitForOldestRingBufferFrame()
+{
+	EAE6320_ASSERT( s_ringBuffer.GetInFlightFrameCount() > 0 );
+	s_ringBuffer.ReleaseOldestFrame();
+	return true;
+}
@@ -0,0 +1,50 @@
+// Header Files
+//=============
+
+#include "../Effect.h"
+
+#include <cstring>
+#include <string>
+#include "CommandList.h"
+#include "../StateCache.h"
+
+// Interface
+//==========
+
+bool eae6320::Graphics::cEffect::Load( const char* const i_effectBinaryFilePath )
+{
+	if ( !LoadBinaryFile( i_effectBinaryFilePath ) )
+	{
+		return false;
+	}
+	// There are no shaders to compile,
+	// but their paths are recorded so that a change of shader shows up in the command list
+	{
+		std::string shaderPaths( m_vertexShaderPath );
+		shaderPaths += '\n';
+		shaderPaths += m_fragmentShaderPath;
+		s_effectId = CommandList::CreateResourceId();
+		CommandList::Record( CommandList::CreateEffect, s_effectId, m_renderStateBits, shaderPaths.c_str(), shaderPaths.size() );
+	}
+	return m_renderState.Initialize( m_renderStateBits );
+}
+
+void eae6320::Graphics::cEffect::Bind()
+{
+	if ( StateCache::BindProgram( s_effectId ) )
+	{
+		CommandList::Record( CommandList::BindEffect, s_effectId );
+	}
+	m_renderState.Bind();
+}
+
+bool eae6320::Graphics::cEffect::CleanUp()
+{
+	if ( s_effectId != 0 )
+	{
+		CommandList::Record( CommandList::DestroyResource, s_effectId );
+		StateCache::NotifyProgramDeleted( s_effectId );
+		s_effectId = 0;
+	}
+	return m_renderState.CleanUp();
+}
@@ -0,0 +1,149 @@
+// Header Files
+//=============
+
+#include "../Graphics.h"
+
+#include <string>
+#include "CommandList.h"
+#include "../ConstantBufferDataManager.h"
+#include "../cFramePacket.h"
+#include "../cRenderQueue.h"
+#include "../Internal.h"
+#include "../cRenderState.h"
+#include "../cSpriteBatch.h"
+#include "../StateCache.h"
+#include "../../Asserts/Asserts.h"
+#include "../../Logging/Logging.h"
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+	eae6320::Graphics::ConstantBufferDataManager s_frameConstantBufferManager;
+	eae6320::Graphics::ConstantBufferDataManager s_drawCallConstantBufferManager;
+	eae6320::Graphics::sFrame s_frameData;
+	// This matches the OpenGL platform so that the ring buffer is used the same way
+	const size_t s_drawCallRingBufferSize = 1024 * 1024;
+	eae6320::Graphics::cRenderQueue s_renderQueue;
+	eae6320::Graphics::cSpriteBatch s_spriteBatch;
+}
+
+// Interface
+//==========
+
+// Render
+//-------
+
+void eae6320::Graphics::RenderFramePacket( const cFramePacket& i_framePacket, sRenderStatistics& o_statistics )
+{
+	CommandList::BeginFrame();
+	StateCache::ResetStatistics();
+
+	// The color and depth buffers are cleared to black and 1
+	// (which requires depth writes to be enabled)
+	CommandList::Record( CommandList::Clear, 0 );
+	StateCache::InvalidateRenderState( RenderStates::DepthBuffering );
+
+	s_frameData = i_framePacket.GetFrameConstants();
+	s_frameConstantBufferManager.Update( &s_frameData );
+
+	// Draw the geometry
+	{
+		s_renderQueue.SetCamera( s_frameData.g_transform_worldToCamera, s_frameData.g_transform_cameraToScreen,
+			i_framePacket.GetNearPlane(), i_framePacket.GetFarPlane() );
+		for ( const cFramePacket::sMeshObjectNode* node = i_framePacket.GetMeshObjects(); node; node = node->next )
+		{
+			s_renderQueue.Submit( node->meshObject );
+		}
+		s_renderQueue.Draw( s_drawCallConstantBufferManager );
+		s_drawCallConstantBufferManager.EndFrame();
+		o_statistics = s_renderQueue.GetStatistics();
+	}
+
+	// Draw UI Objects
+	{
+		for ( const cFramePacket::sSpriteNode* node = i_framePacket.GetSprites(); node; node = node->next )
+		{
+			s_spriteBatch.Add( *node->material, node->sprite->GetVertexData(), 1 );
+		}
+		for ( const cFramePacket::sTextNode* node = i_framePacket.GetTexts(); node; node = node->next )
+		{
+			s_spriteBatch.Add( *node->material, node->vertexData, node->characterCount );
+		}
+		o_statistics.uiDrawCount = s_spriteBatch.Draw();
+	}
+
+	CommandList::EndFrame();
+}
+
+// Threading
+//----------
+
+// There is no rendering context,
+// and so any thread can record commands
+
+bool eae6320::Graphics::MakeContextCurrent()
+{
+	return true;
+}
+
+bool eae6320::Graphics::ReleaseContext()
+{
+	return true;
+}
+
+// Initialization / Clean Up
+//==========================
+
+bool eae6320::Graphics::Initialize( const sInitializationParameters& i_initializationParameters )
+{
+	if ( i_initializationParameters.commandListPath )
+	{
+		std::string errorMessage;
+		if ( !CommandList::OpenFile( i_initializationParameters.commandListPath, &errorMessage ) )
+		{
+			EAE6320_ASSERTF( false, errorMessage.c_str() );
+			Logging::OutputError( errorMessage.c_str() );
+			return false;
+		}
+	}
+	if ( !s_frameConstantBufferManager.Initialize( FRAME_DATA, sizeof( s_frameData ), &s_frameData )
+		|| !s_drawCallConstantBufferManager.InitializeRingBuffer( DRAW_CALL_DATA, s_drawCallRingBufferSize ) )
+	{
+		EAE6320_ASSERT( false );
+		return false;
+	}
+	s_frameConstantBufferManager.Bind();
+	s_drawCallConstantBufferManager.Bind();
+	if ( !s_spriteBatch.Initialize() )
+	{
+		EAE6320_ASSERT( false );
+		return false;
+	}
+	return true;
+}
+
+bool eae6320::Graphics::CleanUp()
+{
+	bool wereThereErrors = false;
+
+	if ( !s_frameConstantBufferManager.CleanUp() )
+	{
+		wereThereErrors = true;
+	}
+	if ( !s_drawCallConstantBufferManager.CleanUp() )
+	{
+		wereThereErrors = true;
+	}
+	if ( !s_spriteBatch.CleanUp() )
+	{
+		wereThereErrors = true;
+	}
+	if ( !CommandList::CleanUp() )
+	{
+		wereThereErrors = true;
+	}
+
+	return !wereThereErrors;
+}
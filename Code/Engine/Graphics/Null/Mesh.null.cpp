@@ -0,0 +1,57 @@
+// Header Files
+//=============
+
+#include "../Mesh.h"
+
+#include "CommandList.h"
+#include "../../Asserts/Asserts.h"
+
+// Interface
+//==========
+
+bool eae6320::Graphics::Mesh::Initialize()
+{
+	// Re-initializing a mesh (e.g. a debug line that moved) replaces its old buffers
+	if ( s_meshId != 0 )
+	{
+		CommandList::Record( CommandList::DestroyResource, s_meshId );
+	}
+	s_meshId = CommandList::CreateResourceId();
+	// Only the sizes and the vertex format are recorded;
+	// copying every vertex would make the command list far larger without making it more useful
+	const uint32_t sizes[] = { verticesCount, indicesCount, indexSize, vertexFormat.type };
+	CommandList::Record( CommandList::CreateMesh, s_meshId, 0, sizes, sizeof( sizes ) );
+	return true;
+}
+
+void eae6320::Graphics::Mesh::DrawFrame()
+{
+	if ( lodCount == 0 )
+	{
+		return;
+	}
+	EAE6320_ASSERT( s_meshId != 0 );
+	CommandList::Record( CommandList::DrawMesh, s_meshId, lods[0].indexCount );
+}
+
+void eae6320::Graphics::Mesh::DrawInstances( uint32_t instanceCount, uint32_t lod )
+{
+	if ( ( lodCount == 0 ) || ( instanceCount == 0 ) )
+	{
+		return;
+	}
+	EAE6320_ASSERT( s_meshId != 0 );
+	EAE6320_ASSERT( lod < lodCount );
+	const uint32_t data[] = { instanceCount, lods[lod].firstIndex };
+	CommandList::Record( CommandList::DrawMeshInstanced, s_meshId, lods[lod].indexCount, data, sizeof( data ) );
+}
+
+bool eae6320::Graphics::Mesh::CleanUp()
+{
+	if ( s_meshId != 0 )
+	{
+		CommandList::Record( CommandList::DestroyResource, s_meshId );
+		s_meshId = 0;
+	}
+	return true;
+}
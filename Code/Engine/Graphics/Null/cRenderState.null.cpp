@@ -0,0 +1,43 @@
+// Header Files
+//=============
+
+#include "../cRenderState.h"
+
+#include "CommandList.h"
+#include "../StateCache.h"
+
+// Interface
+//==========
+
+// Render
+//-------
+
+void eae6320::Graphics::cRenderState::Bind() const
+{
+	// There's no render state object to bind,
+	// and so the bits are recorded directly
+	// (but only when some of them are different from what is currently set)
+	if ( StateCache::SetRenderState( GetRenderStateBits() ) != 0 )
+	{
+		CommandList::Record( CommandList::BindRenderState, 0, GetRenderStateBits() );
+	}
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+bool eae6320::Graphics::cRenderState::CleanUp()
+{
+	return true;
+}
+
+// Implementation
+//===============
+
+// Initialization / Clean Up
+//--------------------------
+
+bool eae6320::Graphics::cRenderState::InitializeFromBits()
+{
+	return true;
+}
@@ -0,0 +1,62 @@
+// Header Files
+//=============
+
+#include "../cSpriteBatch.h"
+
+#include "CommandList.h"
+#include "../../Asserts/Asserts.h"
+
+// Interface
+//==========
+
+// Initialization / Clean Up
+//--------------------------
+
+bool eae6320::Graphics::cSpriteBatch::Initialize()
+{
+	m_vertexBufferId = CommandList::CreateResourceId();
+	CommandList::Record( CommandList::CreateDynamicBuffer, m_vertexBufferId );
+	m_indexBufferId = CommandList::CreateResourceId();
+	CommandList::Record( CommandList::CreateDynamicBuffer, m_indexBufferId );
+	return true;
+}
+
+bool eae6320::Graphics::cSpriteBatch::CleanUp()
+{
+	if ( m_vertexBufferId != 0 )
+	{
+		CommandList::Record( CommandList::DestroyResource, m_vertexBufferId );
+		m_vertexBufferId = 0;
+	}
+	if ( m_indexBufferId != 0 )
+	{
+		CommandList::Record( CommandList::DestroyResource, m_indexBufferId );
+		m_indexBufferId = 0;
+	}
+	m_indexBufferQuadCount = 0;
+	return true;
+}
+
+// Implementation
+//===============
+
+void eae6320::Graphics::cSpriteBatch::UpdateBuffers( const size_t i_quadCount )
+{
+	EAE6320_ASSERT( ( m_vertexBufferId != 0 ) && ( m_indexBufferId != 0 ) );
+	CommandList::Record( CommandList::UpdateDynamicBuffer, m_vertexBufferId, 0, &m_vertexData_sorted[0], i_quadCount * 4 * sizeof( sVertex ) );
+	// The index buffer only changes when it needs to hold more quads
+	if ( i_quadCount > m_indexBufferQuadCount )
+	{
+		m_indexBufferQuadCount = i_quadCount;
+		CommandList::Record( CommandList::UpdateDynamicBuffer, m_indexBufferId, 0,
+			GetIndexData( i_quadCount ), i_quadCount * 6 * sizeof( uint16_t ) );
+	}
+}
+
+void eae6320::Graphics::cSpriteBatch::DrawQuads( const size_t i_firstQuad, const size_t i_quadCount )
+{
+	// The data is the first index
+	const uint32_t firstIndex = static_cast<uint32_t>( i_firstQuad * 6 );
+	CommandList::Record( CommandList::DrawDynamicBuffer, m_vertexBufferId, static_cast<uint32_t>( i_quadCount * 6 ),
+		&firstIndex, sizeof( firstIndex ) );
+}
@@ -0,0 +1,52 @@
+// Header Files
+//=============
+
+#include "../cTexture.h"
+
+#include "CommandList.h"
+#include "../StateCache.h"
+#include "../cTexture/Internal.h"
+
+// Interface
+//==========
+
+// Render
+//-------
+
+void eae6320::Graphics::cTexture::Bind( const unsigned int i_id ) const
+{
+	if ( StateCache::BindTexture( i_id, m_textureId ) )
+	{
+		CommandList::Record( CommandList::BindTexture, m_textureId, i_id );
+	}
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+bool eae6320::Graphics::cTexture::CleanUp()
+{
+	if ( m_textureId != 0 )
+	{
+		CommandList::Record( CommandList::DestroyResource, m_textureId );
+		StateCache::NotifyTextureDeleted( m_textureId );
+		m_textureId = 0;
+	}
+	return true;
+}
+
+// Implementation
+//===============
+
+bool eae6320::Graphics::cTexture::Initialize( const char* const, const sDdsInfo& i_ddsInfo )
+{
+	// The path is only used by the other platforms to name the texture for graphics debuggers
+	// The image isn't copied, only its description
+	const uint32_t description[] =
+	{
+		i_ddsInfo.width, i_ddsInfo.height, i_ddsInfo.mipLevelCount, static_cast<uint32_t>( i_ddsInfo.format )
+	};
+	m_textureId = CommandList::CreateResourceId();
+	CommandList::Record( CommandList::CreateTexture, m_textureId, 0, description, sizeof( description ) );
+	return true;
+}
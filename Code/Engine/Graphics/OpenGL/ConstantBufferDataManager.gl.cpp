@@ -1,5 +1,6 @@
 #include "../ConstantBufferDataManager.h"
 #include "../ConstantBufferData.h"
+#include "../StateCache.h"
 #include "../../Asserts/Asserts.h"
 #include "../../Logging/Logging.h"
 #include "../../Time/Time.h"
@@ -18,6 +19,7 @@ bool eae6320::Graphics::ConstantBufferDataManager::Initialize(ConstantBufferType
 		const GLenum errorCode = glGetError();
 		if (errorCode == GL_NO_ERROR)
 		{
+			StateCache::BindUniformBuffer(s_constantBufferId);
 			glBindBuffer(GL_UNIFORM_BUFFER, s_constantBufferId);
 			const GLenum errorCode = glGetError();
 			if (errorCode != GL_NO_ERROR)
@@ -61,8 +63,9 @@ OnExit:
 
 bool eae6320::Graphics::ConstantBufferDataManager::Bind() {
 	// Bind the constant buffer to the shader
+	const GLuint bindingPointAssignedInShader = s_bufferType;
+	if (StateCache::BindUniformBufferToBindingPoint(bindingPointAssignedInShader, s_constantBufferId))
 	{
-		const GLuint bindingPointAssignedInShader = s_bufferType;
 		glBindBufferBase(GL_UNIFORM_BUFFER, bindingPointAssignedInShader, s_constantBufferId);
 		EAE6320_ASSERT(glGetError() == GL_NO_ERROR);
 	}
@@ -71,10 +74,20 @@ bool eae6320::Graphics::ConstantBufferDataManager::Bind() {
 
 bool eae6320::Graphics::ConstantBufferDataManager::CleanUp() {
 	bool wereThereErrors = false;
+	for (unsigned int i = 0; i < cRingBufferAllocator::s_maxFrameCount; ++i)
+	{
+		if (s_ringBufferFences[i])
+		{
+			glDeleteSync(s_ringBufferFences[i]);
+			s_ringBufferFences[i] = NULL;
+		}
+	}
+	s_ringBuffer.Reset();
 	if (s_constantBufferId != 0)
 	{
 		const GLsizei bufferCount = 1;
 		glDeleteBuffers(bufferCount, &s_constantBufferId);
+		StateCache::NotifyBufferDeleted(s_constantBufferId);
 		const GLenum errorCode = glGetError();
 		if (errorCode != GL_NO_ERROR)
 		{
@@ -92,7 +105,14 @@ bool eae6320::Graphics::ConstantBufferDataManager::Update(void* bufferData) {
 	// Update the struct (i.e. the memory that we own)
 	//s_constantBufferId.g_elapsedSecondCount_total = Time::GetElapsedSecondCount_total();
 	
+	return Update(bufferData, s_bufferSize);
+}
+
+bool eae6320::Graphics::ConstantBufferDataManager::Update(void* bufferData, size_t updateSize) {
+	EAE6320_ASSERT(updateSize <= s_bufferSize);
+
 	// Make the uniform buffer active
+	if (StateCache::BindUniformBuffer(s_constantBufferId))
 	{
 		glBindBuffer(GL_UNIFORM_BUFFER, s_constantBufferId);
 		EAE6320_ASSERT(glGetError() == GL_NO_ERROR);
@@ -100,9 +120,170 @@ bool eae6320::Graphics::ConstantBufferDataManager::Update(void* bufferData) {
 	// Copy the updated memory to the GPU
 	{
 		GLintptr updateAtTheBeginning = 0;
-		GLsizeiptr updateTheEntireBuffer = static_cast<GLsizeiptr>(s_bufferSize);
-		glBufferSubData(GL_UNIFORM_BUFFER, updateAtTheBeginning, updateTheEntireBuffer, bufferData);
+		glBufferSubData(GL_UNIFORM_BUFFER, updateAtTheBeginning, static_cast<GLsizeiptr>(updateSize), bufferData);
+		EAE6320_ASSERT(glGetError() == GL_NO_ERROR);
+	}
+	return true;
+}
+// Ring Buffer
+//------------
+
+bool eae6320::Graphics::ConstantBufferDataManager::InitializeRingBuffer(ConstantBufferType bufferType, size_t ringBufferSize) {
+	// Every range that is bound must start at a multiple of the uniform buffer offset alignment
+	GLint alignment = 0;
+	{
+		glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+		const GLenum errorCode = glGetError();
+		if (errorCode != GL_NO_ERROR)
+		{
+			EAE6320_ASSERTF(false, reinterpret_cast<const char*>(gluErrorString(errorCode)));
+			eae6320::Logging::OutputError("OpenGL failed to get the uniform buffer offset alignment: %s",
+				reinterpret_cast<const char*>(gluErrorString(errorCode)));
+			return false;
+		}
+	}
+	if (!s_ringBuffer.Initialize(ringBufferSize, static_cast<size_t>(alignment)))
+	{
+		eae6320::Logging::OutputError("The ring buffer for constant buffer %u couldn't be initialized (size %u, alignment %d)",
+			static_cast<unsigned int>(bufferType), static_cast<unsigned int>(ringBufferSize), alignment);
+		return false;
+	}
+	// The buffer's contents are undefined until something is written to it
+	return Initialize(bufferType, ringBufferSize, NULL);
+}
+
+void* eae6320::Graphics::ConstantBufferDataManager::MapRingBufferRange(size_t size, size_t& o_offset) {
+	EAE6320_ASSERT(s_ringBuffer.GetSize() > 0);
+
+	// Any frames that the GPU has already finished with can be released without waiting
+	while (s_ringBuffer.GetInFlightFrameCount() > 0)
+	{
+		GLsync& fence = s_ringBufferFences[s_ringBuffer.GetOldestInFlightFrameIndex()];
+		const GLuint64 dontWait = 0;
+		const GLenum result = glClientWaitSync(fence, 0, dontWait);
+		if ((result != GL_ALREADY_SIGNALED) && (result != GL_CONDITION_SATISFIED))
+		{
+			break;
+		}
+		glDeleteSync(fence);
+		fence = NULL;
+		s_ringBuffer.ReleaseOldestFrame();
+	}
+	// If there still isn't enough room then the GPU must be waited for
+	while (!s_ringBuffer.Allocate(size, o_offset))
+	{
+		if (s_ringBuffer.GetInFlightFrameCount() == 0)
+		{
+			EAE6320_ASSERTF(false, "The ring buffer is too small");
+			eae6320::Logging::OutputError("%u bytes can't be allocated from a constant ring buffer whose size is %u (with %u bytes already used this frame)",
+				static_cast<unsigned int>(size), static_cast<unsigned int>(s_ringBuffer.GetSize()), static_cast<unsigned int>(s_ringBuffer.GetUsedSize()));
+			return NULL;
+		}
+		if (!WaitForOldestRingBufferFrame())
+		{
+			return NULL;
+		}
+	}
+
+	if (StateCache::BindUniformBuffer(s_constantBufferId))
+	{
+		glBindBuffer(GL_UNIFORM_BUFFER, s_constantBufferId);
+		EAE6320_ASSERT(glGetError() == GL_NO_ERROR);
+	}
+	// The fences guarantee that the GPU isn't reading this range,
+	// and so OpenGL doesn't need to synchronize anything
+	const GLbitfield access = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+	void* const memory = glMapBufferRange(GL_UNIFORM_BUFFER, static_cast<GLintptr>(o_offset), static_cast<GLsizeiptr>(size), access);
+	const GLenum errorCode = glGetError();
+	if ((errorCode != GL_NO_ERROR) || !memory)
+	{
+		EAE6320_ASSERTF(false, reinterpret_cast<const char*>(gluErrorString(errorCode)));
+		eae6320::Logging::OutputError("OpenGL failed to map a range of the constant ring buffer: %s",
+			reinterpret_cast<const char*>(gluErrorString(errorCode)));
+		return NULL;
+	}
+	return memory;
+}
+
+bool eae6320::Graphics::ConstantBufferDataManager::UnmapRingBufferRange() {
+	if (StateCache::BindUniformBuffer(s_constantBufferId))
+	{
+		glBindBuffer(GL_UNIFORM_BUFFER, s_constantBufferId);
 		EAE6320_ASSERT(glGetError() == GL_NO_ERROR);
 	}
+	// The contents are undefined if the memory became corrupt while it was mapped
+	// (e.g. because the display mode changed)
+	const GLboolean wasUnmapped = glUnmapBuffer(GL_UNIFORM_BUFFER);
+	const GLenum errorCode = glGetError();
+	if ((errorCode != GL_NO_ERROR) || (wasUnmapped == GL_FALSE))
+	{
+		EAE6320_ASSERTF(false, reinterpret_cast<const char*>(gluErrorString(errorCode)));
+		eae6320::Logging::OutputError("OpenGL failed to unmap the constant ring buffer: %s",
+			reinterpret_cast<const char*>(gluErrorString(errorCode)));
+		return false;
+	}
+	return true;
+}
+
+bool eae6320::Graphics::ConstantBufferDataManager::BindRange(size_t offset, size_t size) {
+	EAE6320_ASSERT((offset % s_ringBuffer.GetAlignment()) == 0);
+	EAE6320_ASSERT((offset + size) <= s_ringBuffer.GetSize());
+	const GLuint bindingPointAssignedInShader = s_bufferType;
+	glBindBufferRange(GL_UNIFORM_BUFFER, bindingPointAssignedInShader, s_constantBufferId,
+		static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size));
+	EAE6320_ASSERT(glGetError() == GL_NO_ERROR);
+	StateCache::NotifyUniformBufferRangeBound(bindingPointAssignedInShader, s_constantBufferId);
+	return true;
+}
+
+bool eae6320::Graphics::ConstantBufferDataManager::EndFrame() {
+	if (!s_ringBuffer.CanEndFrame())
+	{
+		if (!WaitForOldestRingBufferFrame())
+		{
+			return false;
+		}
+	}
+	s_ringBuffer.EndFrame();
+	// The fence is signaled once the GPU has finished every command up to this point
+	// (i.e. every draw call that read this frame's constants)
+	const GLbitfield noFlags = 0;
+	GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, noFlags);
+	const GLenum errorCode = glGetError();
+	if ((errorCode != GL_NO_ERROR) || !fence)
+	{
+		EAE6320_ASSERTF(false, reinterpret_cast<const char*>(gluErrorString(errorCode)));
+		eae6320::Logging::OutputError("OpenGL failed to create a fence for the constant ring buffer: %s",
+			reinterpret_cast<const char*>(gluErrorString(errorCode)));
+		return false;
+	}
+	s_ringBufferFences[s_ringBuffer.GetNewestInFlightFrameIndex()] = fence;
+	return true;
+}
+
+bool eae6320::Graphics::ConstantBufferDataManager::WaitForOldestRingBufferFrame() {
+	EAE6320_ASSERT(s_ringBuffer.GetInFlightFrameCount() > 0);
+	GLsync& fence = s_ringBufferFences[s_ringBuffer.GetOldestInFlightFrameIndex()];
+	if (fence)
+	{
+		// The commands must be flushed or else the fence might never be signaled
+		const GLuint64 oneSecondInNanoseconds = 1000000000;
+		GLenum result;
+		do
+		{
+			result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, oneSecondInNanoseconds);
+		} while (result == GL_TIMEOUT_EXPIRED);
+		if (result == GL_WAIT_FAILED)
+		{
+			const GLenum errorCode = glGetError();
+			EAE6320_ASSERTF(false, reinterpret_cast<const char*>(gluErrorString(errorCode)));
+			eae6320::Logging::OutputError("OpenGL failed to wait for a constant ring buffer fence: %s",
+				reinterpret_cast<const char*>(gluErrorString(errorCode)));
+			return false;
+		}
+		glDeleteSync(fence);
+		fence = NULL;
+	}
+	s_ringBuffer.ReleaseOldestFrame();
 	return true;
-}
\ No newline at end of file
+}
@@ -1,4 +1,5 @@
 #include "../Effect.h"
+#include "../StateCache.h"
 #include "../../Asserts/Asserts.h"
 #include "../../Logging/Logging.h"
 #include "../../Platform/Platform.h"
@@ -524,6 +525,7 @@ namespace
 void eae6320::Graphics::cEffect::Bind()
 {
 	// Set the vertex and fragment shaders
+	if (StateCache::BindProgram(s_programId))
 	{
 		glUseProgram(s_programId);
 		EAE6320_ASSERT(glGetError() == GL_NO_ERROR);
@@ -541,6 +543,7 @@ bool eae6320::Graphics::cEffect::CleanUp()
 	if (s_programId != 0)
 	{
 		glDeleteProgram(s_programId);
+		StateCache::NotifyProgramDeleted(s_programId);
 		const GLenum errorCode = glGetError();
 		if (errorCode != GL_NO_ERROR)
 		{
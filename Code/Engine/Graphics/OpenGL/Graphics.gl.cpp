@@ -12,7 +12,6 @@
 #include "../../Asserts/Asserts.h"
 #include "../../Logging/Logging.h"
 #include "../../Platform/Platform.h"
-#include "../../Time/Time.h"
 #include "../../Windows/Functions.h"
 #include "../../Windows/OpenGl.h"
 #include "../../../External/OpenGlExtensions/OpenGlExtensions.h"
@@ -20,6 +19,12 @@
 #include "../ConstantBufferDataManager.h"
 #include <vector>
 #include "../Effect.h"
+#include "../cFramePacket.h"
+#include "../cRenderQueue.h"
+#include "../Internal.h"
+#include "../cRenderState.h"
+#include "../cSpriteBatch.h"
+#include "../StateCache.h"
 
 // Static Data Initialization
 //===========================
@@ -35,11 +40,12 @@ namespace
 	eae6320::Graphics::ConstantBufferDataManager * frameConstantBufferManager = new eae6320::Graphics::ConstantBufferDataManager();
 	eae6320::Graphics::ConstantBufferDataManager * drawCallConstantBufferManager = new eae6320::Graphics::ConstantBufferDataManager();
 	eae6320::Graphics::sFrame frameData;
-	eae6320::Graphics::sDrawCall drawCallData;
-	std::vector<eae6320::Graphics::MeshObject> gameObjects;
-	std::vector<eae6320::Graphics::UIObject> uiObjects;
-	std::vector<eae6320::Graphics::UIText> uiTextArray;
-	eae6320::Graphics::Camera m_camera;
+	// Every draw call's transforms are written into a ring buffer
+	// that is big enough for several frames of the largest possible draw calls
+	const size_t s_drawCallRingBufferSize = 1024 * 1024;
+	eae6320::Graphics::cRenderQueue s_renderQueue;
+	// All of the sprites and text are drawn with this
+	eae6320::Graphics::cSpriteBatch s_spriteBatch;
 }
 
 // Helper Function Declarations
@@ -57,35 +63,13 @@ namespace
 // Interface
 //==========
 
-void eae6320::Graphics::SetMesh(Graphics::MeshObject i_gameObject) {
-	gameObjects.push_back(i_gameObject);
-}
-
-void eae6320::Graphics::SetSprite(UIObject i_uiObject)
-{
-	eae6320::Graphics::UIObject uiObject;
-	uiObject.material = i_uiObject.material;
-	uiObject.sprite = i_uiObject.sprite;
-	uiObjects.push_back(uiObject);
-}
-
-void eae6320::Graphics::AddUIText(UIText i_uiText) 
-{
-	eae6320::Graphics::UIText uiText;
-	uiText.material = i_uiText.material;
-	uiText.text = i_uiText.text;
-	uiTextArray.push_back(uiText);
-}
-
-void eae6320::Graphics::SetCamera(Graphics::Camera i_camera) {
-	m_camera = i_camera;
-}
-
 // Render
 //-------
 
-void eae6320::Graphics::RenderFrame()
+void eae6320::Graphics::RenderFramePacket(const cFramePacket& i_framePacket, sRenderStatistics& o_statistics)
 {
+	StateCache::ResetStatistics();
+
 	// Every frame an entirely new image will be created.
 	// Before drawing anything, then, the previous image will be erased
 	// by "clearing" the image buffer (filling it with a solid color)
@@ -96,6 +80,9 @@ void eae6320::Graphics::RenderFrame()
 
 		glDepthMask(GL_TRUE);
 		EAE6320_ASSERT(glGetError() == GL_NO_ERROR);
+		// The depth mask is part of the depth buffering render state
+		// and so the next render state that is bound must set it again
+		StateCache::InvalidateRenderState(RenderStates::DepthBuffering);
 
 		// Clear depth to 1
 		glClearDepth(1.0f);
@@ -105,40 +92,37 @@ void eae6320::Graphics::RenderFrame()
 		EAE6320_ASSERT(glGetError() == GL_NO_ERROR);
 	}
 
-	frameData.g_transform_worldToCamera = m_camera.CalculateWorldToCameraTransformationMatrix();
-	frameData.g_transform_cameraToScreen = m_camera.CalculateCameraToScreenTransformationMatrix();
-	frameData.g_elapsedSecondCount_total = Time::GetElapsedSecondCount_total();
+	frameData = i_framePacket.GetFrameConstants();
 	frameConstantBufferManager->Update(&frameData);
 
 	// Draw the geometry
 	{
-		for (eae6320::Graphics::MeshObject currentMeshDetail : gameObjects) {
-			currentMeshDetail.material->Bind();
-			Math::cMatrix_transformation transformationMatrix = Math::cMatrix_transformation(currentMeshDetail.rotation, currentMeshDetail.position);
-			drawCallData.g_transform_localToWorld = transformationMatrix;
-			drawCallConstantBufferManager->Update(&drawCallData);
-			currentMeshDetail.mesh->DrawFrame();
+		s_renderQueue.SetCamera(frameData.g_transform_worldToCamera, frameData.g_transform_cameraToScreen,
+			i_framePacket.GetNearPlane(), i_framePacket.GetFarPlane());
+		for (const cFramePacket::sMeshObjectNode* node = i_framePacket.GetMeshObjects(); node; node = node->next)
+		{
+			s_renderQueue.Submit(node->meshObject);
 		}
-		gameObjects.clear();
+		s_renderQueue.Draw(*drawCallConstantBufferManager);
+		drawCallConstantBufferManager->EndFrame();
+		o_statistics = s_renderQueue.GetStatistics();
 	}
 
 	// Draw UI Objects
 	{
 		//Sprites
-		for (eae6320::Graphics::UIObject currentSprite : uiObjects)
+		for (const cFramePacket::sSpriteNode* node = i_framePacket.GetSprites(); node; node = node->next)
 		{
-			currentSprite.material.Bind();
-			currentSprite.sprite->Draw();
+			s_spriteBatch.Add(*node->material, node->sprite->GetVertexData(), 1);
 		}
-		uiObjects.clear();
 		
 		//Text
-		for (eae6320::Graphics::UIText currentText : uiTextArray)
+		for (const cFramePacket::sTextNode* node = i_framePacket.GetTexts(); node; node = node->next)
 		{
-			currentText.material.Bind();
-			currentText.text->Draw();
+			s_spriteBatch.Add(*node->material, node->vertexData, node->characterCount);
 		}
-		uiTextArray.clear();
+
+		o_statistics.uiDrawCount = s_spriteBatch.Draw();
 	}
 
 	// Everything has been drawn to the "back buffer", which is just an image in memory.
@@ -150,6 +134,36 @@ void eae6320::Graphics::RenderFrame()
 	}
 }
 
+// Threading
+//----------
+
+bool eae6320::Graphics::MakeContextCurrent()
+{
+	if ( wglMakeCurrent( s_deviceContext, s_openGlRenderingContext ) == FALSE )
+	{
+		const std::string windowsErrorMessage = Windows::GetLastSystemError();
+		EAE6320_ASSERTF( false, windowsErrorMessage.c_str() );
+		Logging::OutputError( "Windows failed to set the current OpenGL rendering context: %s", windowsErrorMessage.c_str() );
+		return false;
+	}
+	return true;
+}
+
+bool eae6320::Graphics::ReleaseContext()
+{
+	// Any commands that haven't been submitted yet must be submitted before another thread uses the context
+	glFlush();
+	EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+	if ( wglMakeCurrent( s_deviceContext, NULL ) == FALSE )
+	{
+		const std::string windowsErrorMessage = Windows::GetLastSystemError();
+		EAE6320_ASSERTF( false, windowsErrorMessage.c_str() );
+		Logging::OutputError( "Windows failed to unset the current OpenGL rendering context: %s", windowsErrorMessage.c_str() );
+		return false;
+	}
+	return true;
+}
+
 // Initialization / Clean Up
 //==========================
 
@@ -172,6 +186,8 @@ bool eae6320::Graphics::Initialize(const sInitializationParameters& i_initializa
 		EAE6320_ASSERT(false);
 		return false;
 	}
+	// Nothing that the state cache remembers is valid for a new context
+	StateCache::Invalidate();
 
 	if (!CreateSamplerState()) {
 		EAE6320_ASSERT(false);
@@ -192,6 +208,11 @@ bool eae6320::Graphics::Initialize(const sInitializationParameters& i_initializa
 		EAE6320_ASSERT(false);
 		return false;
 	}
+	if (!s_spriteBatch.Initialize())
+	{
+		EAE6320_ASSERT(false);
+		return false;
+	}
 	return true;
 }
 
@@ -203,6 +224,10 @@ bool eae6320::Graphics::CleanUp()
 	{
 		frameConstantBufferManager->CleanUp();
 		drawCallConstantBufferManager->CleanUp();
+		if (!s_spriteBatch.CleanUp())
+		{
+			wereThereErrors = true;
+		}
 		
 		if ( wglMakeCurrent( s_deviceContext, NULL ) != FALSE )
 		{
@@ -248,7 +273,10 @@ namespace
 	bool CreateConstantBuffer()
 	{
 		frameConstantBufferManager->Initialize(eae6320::Graphics::FRAME_DATA, sizeof(eae6320::Graphics::sFrame), &frameData);
-		drawCallConstantBufferManager->Initialize(eae6320::Graphics::DRAW_CALL_DATA, sizeof(eae6320::Graphics::sDrawCall), &drawCallData);
+		if (!drawCallConstantBufferManager->InitializeRingBuffer(eae6320::Graphics::DRAW_CALL_DATA, s_drawCallRingBufferSize))
+		{
+			return false;
+		}
 		frameConstantBufferManager->Bind();
 		drawCallConstantBufferManager->Bind();
 		return true;
@@ -4,6 +4,7 @@
 #include "../../Logging/Logging.h"
 #include "../../../External/OpenGlExtensions/OpenGlExtensions.h"
 #include "../VertexData.h"
+#include "../StateCache.h"
 
 namespace {
 	// The vertex buffer holds the data for each vertex
@@ -28,6 +29,7 @@ bool eae6320::Graphics::Mesh::Initialize() {
 		const GLenum errorCode = glGetError();
 		if (errorCode == GL_NO_ERROR)
 		{
+			StateCache::BindVertexArray(s_vertexArrayId);
 			glBindVertexArray(s_vertexArrayId);
 			const GLenum errorCode = glGetError();
 			if (errorCode != GL_NO_ERROR)
@@ -56,6 +58,7 @@ bool eae6320::Graphics::Mesh::Initialize() {
 		const GLenum errorCode = glGetError();
 		if (errorCode == GL_NO_ERROR)
 		{
+			StateCache::BindArrayBuffer(vertexBufferId);
 			glBindBuffer(GL_ARRAY_BUFFER, vertexBufferId);
 			const GLenum errorCode = glGetError();
 			if (errorCode != GL_NO_ERROR)
@@ -107,7 +110,8 @@ bool eae6320::Graphics::Mesh::Initialize() {
 
 	// Assign the data to the buffer
 	{
-		const unsigned int bufferSize = verticesCount * sizeof(sVertex);
+		const unsigned int vertexSize = VertexFormats::IsCompressed(vertexFormat.type) ? sizeof(sVertex_compressed) : sizeof(sVertex);
+		const unsigned int bufferSize = verticesCount * vertexSize;
 
 		glBufferData(GL_ARRAY_BUFFER, bufferSize, reinterpret_cast<GLvoid*>(vertexData),
 			// In our class we won't ever read from the buffer
@@ -123,7 +127,7 @@ bool eae6320::Graphics::Mesh::Initialize() {
 		}
 	}
 	{
-		const unsigned int indexBufferSize = indicesCount*sizeof(uint32_t);
+		const unsigned int indexBufferSize = indicesCount*indexSize;
 
 		glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexBufferSize, reinterpret_cast<GLvoid*>(indices),
 			// In our class we won't ever read from the buffer
@@ -140,19 +144,27 @@ bool eae6320::Graphics::Mesh::Initialize() {
 
 	// Initialize the vertex format
 	{
+		// Compressed vertices are read as the same types that the shader expects:
+		//	* Positions are 16 bit fractions of the mesh's bounds
+		//		(they are dequantized by the transform that the render queue gives each instance)
+		//	* Texture coordinates are half floats or [0,1] fractions
+		const bool isCompressed = VertexFormats::IsCompressed(vertexFormat.type);
+		const bool areTextureCoordinatesUnorm = vertexFormat.type == VertexFormats::Compressed_unormTextureCoordinates;
 		// The "stride" defines how large a single vertex is in the stream of data
 		// (or, said another way, how far apart each position element is)
-		const GLsizei stride = sizeof(sVertex);
+		const GLsizei stride = isCompressed ? sizeof(sVertex_compressed) : sizeof(sVertex);
 
 		// Position (0)
-		// 2 floats == 8 bytes
+		// 3 floats == 12 bytes (or 3 uint16_ts == 6 bytes)
 		// Offset = 0
 		{
 			const GLuint vertexElementLocation = 0;
 			const GLint elementCount = 3;
-			const GLboolean notNormalized = GL_FALSE;	// The given floats should be used as-is
-			glVertexAttribPointer(vertexElementLocation, elementCount, GL_FLOAT, notNormalized, stride,
-				reinterpret_cast<GLvoid*>(offsetof(sVertex, x)));
+			// Compressed positions are [0,1] fractions;
+			// otherwise the given floats should be used as-is
+			const GLboolean isNormalized = isCompressed ? GL_TRUE : GL_FALSE;
+			glVertexAttribPointer(vertexElementLocation, elementCount, isCompressed ? GL_UNSIGNED_SHORT : GL_FLOAT, isNormalized, stride,
+				reinterpret_cast<GLvoid*>(isCompressed ? offsetof(sVertex_compressed, x) : offsetof(sVertex, x)));
 			const GLenum errorCode = glGetError();
 			if (errorCode == GL_NO_ERROR)
 			{
@@ -183,7 +195,7 @@ bool eae6320::Graphics::Mesh::Initialize() {
 			const GLint elementCount = 4;
 			const GLboolean isNormalized = GL_TRUE;	
 			glVertexAttribPointer(vertexElementLocation, elementCount, GL_UNSIGNED_BYTE, isNormalized, stride,
-				reinterpret_cast<GLvoid*>(offsetof(sVertex, red)));
+				reinterpret_cast<GLvoid*>(isCompressed ? offsetof(sVertex_compressed, red) : offsetof(sVertex, red)));
 			const GLenum errorCode = glGetError();
 			if (errorCode == GL_NO_ERROR)
 			{
@@ -212,9 +224,11 @@ bool eae6320::Graphics::Mesh::Initialize() {
 		{
 			const GLuint vertexElementLocation = 2;
 			const GLint elementCount = 2;
-			const GLboolean notNormalized = GL_FALSE;	// The given floats should be used as-is
-			glVertexAttribPointer(vertexElementLocation, elementCount, GL_FLOAT, notNormalized, stride,
-				reinterpret_cast<GLvoid*>(offsetof(sVertex, u)));
+			// Floats (including half floats) should be used as-is
+			const GLboolean isNormalized = areTextureCoordinatesUnorm ? GL_TRUE : GL_FALSE;
+			const GLenum type = areTextureCoordinatesUnorm ? GL_UNSIGNED_SHORT : (isCompressed ? GL_HALF_FLOAT : GL_FLOAT);
+			glVertexAttribPointer(vertexElementLocation, elementCount, type, isNormalized, stride,
+				reinterpret_cast<GLvoid*>(isCompressed ? offsetof(sVertex_compressed, u) : offsetof(sVertex, u)));
 			const GLenum errorCode = glGetError();
 			if (errorCode == GL_NO_ERROR)
 			{
@@ -248,6 +262,7 @@ OnExit:
 	{
 		// Unbind the vertex array
 		// (this must be done before deleting the vertex buffer)
+		StateCache::BindVertexArray(0);
 		glBindVertexArray(0);
 		const GLenum errorCode = glGetError();
 		if (errorCode == GL_NO_ERROR)
@@ -263,6 +278,7 @@ OnExit:
 #ifndef EAE6320_GRAPHICS_ISDEVICEDEBUGINFOENABLED
 				const GLsizei bufferCount = 1;
 				glDeleteBuffers(bufferCount, &vertexBufferId);
+				StateCache::NotifyBufferDeleted(vertexBufferId);
 				const GLenum errorCode = glGetError();
 				if (errorCode != GL_NO_ERROR)
 				{
@@ -311,28 +327,35 @@ OnExit:
 }
 
 void eae6320::Graphics::Mesh::DrawFrame() {
-	if (indicesCount == 0) {
+	DrawInstances(1);
+}
+
+void eae6320::Graphics::Mesh::DrawInstances(uint32_t instanceCount, uint32_t lod) {
+	if ((lodCount == 0) || (instanceCount == 0)) {
 		return;
 	}
+	EAE6320_ASSERT(lod < lodCount);
 	// Bind a specific vertex buffer to the device as a data source
+	// (consecutive draws of the same mesh don't need to bind it again)
+	if (StateCache::BindVertexArray(s_vertexArrayId))
+	{
 		glBindVertexArray(s_vertexArrayId);
 		EAE6320_ASSERT(glGetError() == GL_NO_ERROR);
-	
-		// Render triangles from the currently-bound vertex buffer
-		{
-			// The mode defines how to interpret multiple vertices as a single "primitive";
-			// we define a triangle list
-			// (meaning that every primitive is a triangle and will be defined by three vertices)
-			const GLenum mode = GL_TRIANGLES;
-			
-			// Every index is a 16 bit unsigned integer
-			const GLenum indexType = GL_UNSIGNED_INT;
-			// It's possible to start rendering primitives in the middle of the stream
-			const GLvoid* const offset = 0;
-			glDrawElements(mode, indicesCount, indexType, offset);
-
-			EAE6320_ASSERT(glGetError() == GL_NO_ERROR);
-		}
+	}
+	// Render every instance's triangles from the currently-bound vertex buffer
+	{
+		// The mode defines how to interpret multiple vertices as a single "primitive";
+		// we define a triangle list
+		// (meaning that every primitive is a triangle and will be defined by three vertices)
+		const GLenum mode = GL_TRIANGLES;
+		// Every index is either a 16 or a 32 bit unsigned integer
+		const GLenum indexType = (indexSize == sizeof(uint16_t)) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+		// Each LOD starts in the middle of the index buffer
+		const sLod& drawnLod = lods[lod];
+		const GLvoid* const offset = reinterpret_cast<GLvoid*>(static_cast<uintptr_t>(drawnLod.firstIndex * indexSize));
+		glDrawElementsInstanced(mode, static_cast<GLsizei>(drawnLod.indexCount), indexType, offset, static_cast<GLsizei>(instanceCount));
+		EAE6320_ASSERT(glGetError() == GL_NO_ERROR);
+	}
 }
 
 bool eae6320::Graphics::Mesh::CleanUp() {
@@ -342,6 +365,7 @@ bool eae6320::Graphics::Mesh::CleanUp() {
 	{
 		const GLsizei bufferCount = 1;
 		glDeleteBuffers(bufferCount, &s_vertexBufferId);
+		StateCache::NotifyBufferDeleted(s_vertexBufferId);
 		const GLenum errorCode = glGetError();
 		if (errorCode != GL_NO_ERROR)
 		{
@@ -370,6 +394,7 @@ bool eae6320::Graphics::Mesh::CleanUp() {
 	{
 		const GLsizei arrayCount = 1;
 		glDeleteVertexArrays(arrayCount, &s_vertexArrayId);
+		StateCache::NotifyVertexArrayDeleted(s_vertexArrayId);
 		const GLenum errorCode = glGetError();
 		if (errorCode != GL_NO_ERROR)
 		{
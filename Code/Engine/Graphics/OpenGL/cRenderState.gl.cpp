@@ -4,6 +4,7 @@
 #include "../cRenderState.h"
 
 #include "../OpenGL/Includes.h"
+#include "../StateCache.h"
 #include "../../Asserts/Asserts.h"
 
 // Interface
@@ -14,73 +15,91 @@
 
 void eae6320::Graphics::cRenderState::Bind() const
 {
-	// Alpha Transparency
-	if ( IsAlphaTransparencyEnabled() )
+	// Only the state that is different from what is currently set is changed
+	const uint8_t changedBits = StateCache::SetRenderState( m_bits );
+	if ( changedBits == 0 )
 	{
-		glEnable( GL_BLEND );
-		EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
-		// result = ( source * source.a ) + ( destination * ( 1 - source.a ) )
-		glBlendEquation( GL_FUNC_ADD );
-		EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
-		glBlendFunc( GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA );
-		EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+		return;
 	}
-	else
+	// Alpha Transparency
+	if ( changedBits & RenderStates::AlphaTransparency )
 	{
-		glDisable( GL_BLEND );
-		EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+		if ( IsAlphaTransparencyEnabled() )
+		{
+			glEnable( GL_BLEND );
+			EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+			// result = ( source * source.a ) + ( destination * ( 1 - source.a ) )
+			glBlendEquation( GL_FUNC_ADD );
+			EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+			glBlendFunc( GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA );
+			EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+		}
+		else
+		{
+			glDisable( GL_BLEND );
+			EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+		}
 	}
 	// Depth Buffering
-	if ( IsDepthBufferingEnabled() )
-	{
-		// The new fragment becomes a pixel if its depth is less than what has previously been written
-		glEnable( GL_DEPTH_TEST );
-		EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
-		glDepthFunc( GL_LESS );
-		EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
-		// Write to the depth buffer
-		glDepthMask( GL_TRUE );
-		EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
-	}
-	else
+	if ( changedBits & RenderStates::DepthBuffering )
 	{
-		// Don't test the depth buffer
-		glDisable( GL_DEPTH_TEST );
-		EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
-		// Don't write to the depth buffer
-		glDepthMask( GL_FALSE );
-		EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+		if ( IsDepthBufferingEnabled() )
+		{
+			// The new fragment becomes a pixel if its depth is less than what has previously been written
+			glEnable( GL_DEPTH_TEST );
+			EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+			glDepthFunc( GL_LESS );
+			EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+			// Write to the depth buffer
+			glDepthMask( GL_TRUE );
+			EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+		}
+		else
+		{
+			// Don't test the depth buffer
+			glDisable( GL_DEPTH_TEST );
+			EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+			// Don't write to the depth buffer
+			glDepthMask( GL_FALSE );
+			EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+		}
 	}
 	// Draw Both Triangle Sides
-	if ( ShouldBothTriangleSidesBeDrawn() )
+	if ( changedBits & RenderStates::DrawBothTriangleSides )
 	{
-		// Don't cull any triangles
-		glDisable( GL_CULL_FACE );
-		EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
-	}
-	else
-	{
-		// Cull triangles that are facing backwards
-		glEnable( GL_CULL_FACE );
-		EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
-		// Triangles use right-handed winding order
-		// (opposite from Direct3D)
-		glFrontFace( GL_CCW );
-		EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+		if ( ShouldBothTriangleSidesBeDrawn() )
+		{
+			// Don't cull any triangles
+			glDisable( GL_CULL_FACE );
+			EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+		}
+		else
+		{
+			// Cull triangles that are facing backwards
+			glEnable( GL_CULL_FACE );
+			EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+			// Triangles use right-handed winding order
+			// (opposite from Direct3D)
+			glFrontFace( GL_CCW );
+			EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+		}
 	}
 	//WireFrame
-	if (IsWireFrameEnabled())
+	if ( changedBits & RenderStates::WireFrame )
 	{
-		glFrontFace(GL_CCW);
-		EAE6320_ASSERT(glGetError() == GL_NO_ERROR);
+		if (IsWireFrameEnabled())
+		{
+			glFrontFace(GL_CCW);
+			EAE6320_ASSERT(glGetError() == GL_NO_ERROR);
 
-		glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
-		EAE6320_ASSERT(glGetError() == GL_NO_ERROR);
-	}
-	else
-	{
-		glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
-		EAE6320_ASSERT(glGetError() == GL_NO_ERROR);
+			glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
+			EAE6320_ASSERT(glGetError() == GL_NO_ERROR);
+		}
+		else
+		{
+			glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+			EAE6320_ASSERT(glGetError() == GL_NO_ERROR);
+		}
 	}
 }
 
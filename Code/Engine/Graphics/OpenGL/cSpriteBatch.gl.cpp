@@ -1,143 +1,20 @@
 // Header Files
 //=============
 
-#include "../cSprite.h"
+#include "../cSpriteBatch.h"
 
-#include "../VertexData.h"
+#include <algorithm>
+#include "../StateCache.h"
 #include "../../Asserts/Asserts.h"
 #include "../../Logging/Logging.h"
 
-// Static Data Initialization
-//===========================
-
-GLuint eae6320::Graphics::cSprite::ms_vertexArrayId = 0;
-GLuint eae6320::Graphics::cSprite::ms_vertexBufferId = 0;
-
-namespace
-{
-	// When the topology is a quad OpenGL only needs 4 vertices
-	const unsigned int s_vertexCount = 4;
-}
-
 // Interface
 //==========
 
-// Render
-//-------
-
-void eae6320::Graphics::cSprite::Draw() const
-{
-	// Update the vertex buffer
-	{
-		sVertex vertexData[s_vertexCount];
-		{
-			// Position
-			{
-				// Lower Left
-				{
-					sVertex& vertex = vertexData[0];
-					vertex.x = m_position_screen.left;
-					vertex.y = m_position_screen.bottom;
-					vertex.z = -1.0f;
-				}
-				// Lower Right
-				{
-					sVertex& vertex = vertexData[1];
-					vertex.x = m_position_screen.right;
-					vertex.y = m_position_screen.bottom;
-					vertex.z = -1.0f;
-				}
-				// Upper Left
-				{
-					sVertex& vertex = vertexData[2];
-					vertex.x = m_position_screen.left;
-					vertex.y = m_position_screen.top;
-					vertex.z = -1.0f;
-				}
-				// Upper Right
-				{
-					sVertex& vertex = vertexData[3];
-					vertex.x = m_position_screen.right;
-					vertex.y = m_position_screen.top;
-					vertex.z = -1.0f;
-				}
-			}
-			// Texture Coordinates
-			{
-				// Lower Left
-				{
-					sVertex& vertex = vertexData[0];
-					vertex.u = m_textureCoordinates.left;
-					vertex.v = m_textureCoordinates.bottom;
-				}
-				// Lower Right
-				{
-					sVertex& vertex = vertexData[1];
-					vertex.u = m_textureCoordinates.right;
-					vertex.v = m_textureCoordinates.bottom;
-				}
-				// Upper Left
-				{
-					sVertex& vertex = vertexData[2];
-					vertex.u = m_textureCoordinates.left;
-					vertex.v = m_textureCoordinates.top;
-				}
-				// Upper Right
-				{
-					sVertex& vertex = vertexData[3];
-					vertex.u = m_textureCoordinates.right;
-					vertex.v = m_textureCoordinates.top;
-				}
-			}
-			// Colors
-			for ( unsigned int i = 0; i < s_vertexCount; ++i )
-			{
-				sVertex& vertex = vertexData[i];
-				vertex.red = vertex.green = vertex.blue = vertex.alpha = 255;
-			}
-		}
-		// Make the vertex buffer active
-		{
-			glBindBuffer( GL_ARRAY_BUFFER, ms_vertexBufferId );
-			EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
-		}
-		// Invalidate the old data
-		{
-			// This is to tell OpenGL that synchronization isn't necessary
-			// (it can finish drawing with the contents of the previous buffer,
-			// but there's no need to wait for the next update before drawing anything else)
-			glInvalidateBufferData( ms_vertexBufferId );
-			EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
-		}
-		// Re-allocate and copy the new data to the GPU
-		{
-			glBufferData( GL_ARRAY_BUFFER, static_cast<GLsizeiptr>( sizeof( vertexData ) ), vertexData, GL_STREAM_DRAW );
-			EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
-		}
-	}
-	// Bind the vertex buffer to the device as a data source
-	{
-		glBindVertexArray( ms_vertexArrayId );
-		EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
-	}
-	// Render triangles from the currently-bound vertex buffer
-	{
-		// The mode defines how to interpret multiple vertices as a single "primitive";
-		// we have defined the vertex buffer as a quad, which means that a triangle "strip" will work
-		// (meaning that the first primitive will be a triangle defined by three vertices
-		// and the second primitive will be a triangle defined by the two most recent vertices and one new vertex)
-		const GLenum mode = GL_TRIANGLE_STRIP;
-		// It's possible to start rendering primitives in the middle of the stream
-		const GLint indexOfFirstVertexToRender = 0;
-		glDrawArrays( mode, indexOfFirstVertexToRender, static_cast<GLsizei>( s_vertexCount ) );
-		EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
-	}
-}
-
 // Initialization / Clean Up
 //--------------------------
 
-bool eae6320::Graphics::cSprite::Initialize()
+bool eae6320::Graphics::cSpriteBatch::Initialize()
 {
 	bool wereThereErrors = false;
 
@@ -146,11 +23,12 @@ bool eae6320::Graphics::cSprite::Initialize()
 		// Create a vertex array object and make it active
 		{
 			const GLsizei arrayCount = 1;
-			glGenVertexArrays( arrayCount, &ms_vertexArrayId );
+			glGenVertexArrays( arrayCount, &m_vertexArrayId );
 			const GLenum errorCode = glGetError();
 			if ( errorCode == GL_NO_ERROR )
 			{
-				glBindVertexArray( ms_vertexArrayId );
+				StateCache::BindVertexArray( m_vertexArrayId );
+				glBindVertexArray( m_vertexArrayId );
 				const GLenum errorCode = glGetError();
 				if ( errorCode != GL_NO_ERROR )
 				{
@@ -174,11 +52,12 @@ bool eae6320::Graphics::cSprite::Initialize()
 		// Create a vertex buffer object and make it active
 		{
 			const GLsizei bufferCount = 1;
-			glGenBuffers( bufferCount, &ms_vertexBufferId );
+			glGenBuffers( bufferCount, &m_vertexBufferId );
 			const GLenum errorCode = glGetError();
 			if ( errorCode == GL_NO_ERROR )
 			{
-				glBindBuffer( GL_ARRAY_BUFFER, ms_vertexBufferId );
+				StateCache::BindArrayBuffer( m_vertexBufferId );
+				glBindBuffer( GL_ARRAY_BUFFER, m_vertexBufferId );
 				const GLenum errorCode = glGetError();
 				if ( errorCode != GL_NO_ERROR )
 				{
@@ -198,69 +77,8 @@ bool eae6320::Graphics::cSprite::Initialize()
 				goto OnExit;
 			}
 		}
-		// Assign initial data to the buffer
-		{
-			sVertex vertexData[s_vertexCount];
-			{
-				// Lower Left
-				{
-					sVertex& vertex = vertexData[0];
-					vertex.x = -1.0f;
-					vertex.y = -1.0f;
-					vertex.z = -1.0f;
-					vertex.u = 0.0f;
-					vertex.v = 0.0f;
-					vertex.red = vertex.green = vertex.blue = vertex.alpha = 255;
-				}
-				// Lower Right
-				{
-					sVertex& vertex = vertexData[1];
-					vertex.x = 1.0f;
-					vertex.y = -1.0f;
-					vertex.z = -1.0f;
-					vertex.u = 1.0f;
-					vertex.v = 0.0f;
-					vertex.red = vertex.green = vertex.blue = vertex.alpha = 255;
-				}
-				// Upper Left
-				{
-					sVertex& vertex = vertexData[2];
-					vertex.x = -1.0f;
-					vertex.y = 1.0f;
-					vertex.z = -1.0f;
-					vertex.u = 0.0f;
-					vertex.v = 1.0f;
-					vertex.red = vertex.green = vertex.blue = vertex.alpha = 255;
-				}
-				// Upper Right
-				{
-					sVertex& vertex = vertexData[3];
-					vertex.x = 1.0f;
-					vertex.y = 1.0f;
-					vertex.z = -1.0f;
-					vertex.u = 1.0f;
-					vertex.v = 1.0f;
-					vertex.red = vertex.green = vertex.blue = vertex.alpha = 255;
-				}
-			}
-			glBufferData( GL_ARRAY_BUFFER, sizeof( vertexData ), reinterpret_cast<const GLvoid*>( vertexData ),
-				// The buffer will change frequently, and each update will only be used once for a draw call
-				GL_STREAM_DRAW );
-			const GLenum errorCode = glGetError();
-			if ( errorCode != GL_NO_ERROR )
-			{
-				wereThereErrors = true;
-				EAE6320_ASSERTF( false, reinterpret_cast<const char*>( gluErrorString( errorCode ) ) );
-				eae6320::Logging::OutputError( "OpenGL failed to allocate the sprites' vertex buffer: %s",
-					reinterpret_cast<const char*>( gluErrorString( errorCode ) ) );
-				goto OnExit;
-			}
-		}
 		// Initialize the vertex format
 		{
-			// This code is the same as in the mesh representation :(
-			// If I didn't have to try and make it easy for you all to update
-			// I would move this to a shared function
 			const GLsizei stride = sizeof( eae6320::Graphics::sVertex );
 			// Position (0)
 			// 3 floats == 12 bytes
@@ -364,6 +182,35 @@ bool eae6320::Graphics::cSprite::Initialize()
 				}
 			}
 		}
+
+		// Create an index buffer object
+		// (the vertex array is still bound, and so it will use this index buffer)
+		{
+			const GLsizei bufferCount = 1;
+			glGenBuffers( bufferCount, &m_indexBufferId );
+			const GLenum errorCode = glGetError();
+			if ( errorCode == GL_NO_ERROR )
+			{
+				glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, m_indexBufferId );
+				const GLenum errorCode = glGetError();
+				if ( errorCode != GL_NO_ERROR )
+				{
+					wereThereErrors = true;
+					EAE6320_ASSERTF( false, reinterpret_cast<const char*>( gluErrorString( errorCode ) ) );
+					eae6320::Logging::OutputError( "OpenGL failed to bind the sprites' new index buffer: %s",
+						reinterpret_cast<const char*>( gluErrorString( errorCode ) ) );
+					goto OnExit;
+				}
+			}
+			else
+			{
+				wereThereErrors = true;
+				EAE6320_ASSERTF( false, reinterpret_cast<const char*>( gluErrorString( errorCode ) ) );
+				eae6320::Logging::OutputError( "OpenGL failed to get an unused index buffer ID for the sprites: %s",
+					reinterpret_cast<const char*>( gluErrorString( errorCode ) ) );
+				goto OnExit;
+			}
+		}
 	}
 
 OnExit:
@@ -371,13 +218,14 @@ OnExit:
 	return !wereThereErrors;
 }
 
-bool eae6320::Graphics::cSprite::CleanUp()
+bool eae6320::Graphics::cSpriteBatch::CleanUp()
 {
 	bool wereThereErrors = false;
 
 	// Make sure that the vertex array isn't bound
 	{
 		// Unbind the vertex array
+		StateCache::BindVertexArray( 0 );
 		glBindVertexArray( 0 );
 		const GLenum errorCode = glGetError();
 		if ( errorCode != GL_NO_ERROR )
@@ -388,10 +236,11 @@ bool eae6320::Graphics::cSprite::CleanUp()
 				reinterpret_cast<const char*>( gluErrorString( errorCode ) ) );
 		}
 	}
-	if ( ms_vertexBufferId != 0 )
+	if ( m_vertexBufferId != 0 )
 	{
 		const GLsizei bufferCount = 1;
-		glDeleteBuffers( bufferCount, &ms_vertexBufferId );
+		glDeleteBuffers( bufferCount, &m_vertexBufferId );
+		StateCache::NotifyBufferDeleted( m_vertexBufferId );
 		const GLenum errorCode = glGetError();
 		if ( errorCode != GL_NO_ERROR )
 		{
@@ -400,12 +249,13 @@ bool eae6320::Graphics::cSprite::CleanUp()
 			Logging::OutputError( "OpenGL failed to delete the sprites' vertex buffer: %s",
 				reinterpret_cast<const char*>( gluErrorString( errorCode ) ) );
 		}
-		ms_vertexBufferId = 0;
+		m_vertexBufferId = 0;
 	}
-	if ( ms_vertexArrayId != 0 )
+	if ( m_vertexArrayId != 0 )
 	{
 		const GLsizei arrayCount = 1;
-		glDeleteVertexArrays( arrayCount, &ms_vertexArrayId );
+		glDeleteVertexArrays( arrayCount, &m_vertexArrayId );
+		StateCache::NotifyVertexArrayDeleted( m_vertexArrayId );
 		const GLenum errorCode = glGetError();
 		if ( errorCode != GL_NO_ERROR )
 		{
@@ -413,8 +263,92 @@ bool eae6320::Graphics::cSprite::CleanUp()
 			Logging::OutputError( "OpenGL failed to delete the sprites' vertex array: %s",
 				reinterpret_cast<const char*>( gluErrorString( errorCode ) ) );
 		}
-		ms_vertexArrayId = 0;
+		m_vertexArrayId = 0;
 	}
+	if ( m_indexBufferId != 0 )
+	{
+		const GLsizei bufferCount = 1;
+		glDeleteBuffers( bufferCount, &m_indexBufferId );
+		const GLenum errorCode = glGetError();
+		if ( errorCode != GL_NO_ERROR )
+		{
+			wereThereErrors = true;
+			EAE6320_ASSERTF( false, reinterpret_cast<const char*>( gluErrorString( errorCode ) ) );
+			Logging::OutputError( "OpenGL failed to delete the sprites' index buffer: %s",
+				reinterpret_cast<const char*>( gluErrorString( errorCode ) ) );
+		}
+		m_indexBufferId = 0;
+	}
+	m_vertexBufferQuadCount = 0;
+	m_indexBufferQuadCount = 0;
 
 	return !wereThereErrors;
 }
+
+// Implementation
+//===============
+
+void eae6320::Graphics::cSpriteBatch::UpdateBuffers( const size_t i_quadCount )
+{
+	// Bind the vertex array first
+	// (the element array buffer binding is part of the vertex array's state,
+	// and so binding the index buffer below would otherwise change whichever vertex array was bound)
+	if ( StateCache::BindVertexArray( m_vertexArrayId ) )
+	{
+		glBindVertexArray( m_vertexArrayId );
+		EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+	}
+
+	// Make the vertex buffer active
+	if ( StateCache::BindArrayBuffer( m_vertexBufferId ) )
+	{
+		glBindBuffer( GL_ARRAY_BUFFER, m_vertexBufferId );
+		EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+	}
+	if ( i_quadCount > m_vertexBufferQuadCount )
+	{
+		// The buffer is made bigger than it needs to be
+		// so that it doesn't have to grow again every time a frame has a few more quads
+		m_vertexBufferQuadCount = std::max( i_quadCount, m_vertexBufferQuadCount * 2 );
+		glBufferData( GL_ARRAY_BUFFER, static_cast<GLsizeiptr>( m_vertexBufferQuadCount * 4 * sizeof( sVertex ) ), NULL,
+			// The buffer will change every frame, and each update will only be used for that frame's draw calls
+			GL_STREAM_DRAW );
+		EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+	}
+	else
+	{
+		// This is to tell OpenGL that synchronization isn't necessary
+		// (it can finish drawing with the contents of the previous frame,
+		// but there's no need to wait for that before the new contents are copied)
+		glInvalidateBufferData( m_vertexBufferId );
+		EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+	}
+	glBufferSubData( GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>( i_quadCount * 4 * sizeof( sVertex ) ),
+		reinterpret_cast<const GLvoid*>( &m_vertexData_sorted[0] ) );
+	EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+
+	// The index buffer only changes when it needs to hold more quads
+	if ( i_quadCount > m_indexBufferQuadCount )
+	{
+		m_indexBufferQuadCount = std::min( std::max( i_quadCount, m_indexBufferQuadCount * 2 ), static_cast<size_t>( s_maxQuadCount ) );
+		glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, m_indexBufferId );
+		EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+		glBufferData( GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>( m_indexBufferQuadCount * 6 * sizeof( uint16_t ) ),
+			reinterpret_cast<const GLvoid*>( GetIndexData( m_indexBufferQuadCount ) ), GL_STATIC_DRAW );
+		EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+	}
+}
+
+void eae6320::Graphics::cSpriteBatch::DrawQuads( const size_t i_firstQuad, const size_t i_quadCount )
+{
+	// Render triangles from the currently-bound vertex buffer
+	{
+		// Every quad is two triangles
+		const GLenum mode = GL_TRIANGLES;
+		const GLenum indexType = GL_UNSIGNED_SHORT;
+		// It's possible to start rendering primitives in the middle of the stream
+		const GLvoid* const offset = reinterpret_cast<GLvoid*>( i_firstQuad * 6 * sizeof( uint16_t ) );
+		glDrawElements( mode, static_cast<GLsizei>( i_quadCount * 6 ), indexType, offset );
+		EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+	}
+}
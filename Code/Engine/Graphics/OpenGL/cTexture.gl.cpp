@@ -4,6 +4,7 @@
 #include "../cTexture.h"
 
 #include <algorithm>
+#include "../StateCache.h"
 #include "../cTexture/Internal.h"
 #include "../../Asserts/Asserts.h"
 #include "../../Logging/Logging.h"
@@ -16,16 +17,20 @@
 
 void eae6320::Graphics::cTexture::Bind( const unsigned int i_id ) const
 {
-	// Make the texture unit active
+	EAE6320_ASSERT( m_textureId != 0 );
+	if ( StateCache::BindTexture( i_id, m_textureId ) )
 	{
-		glActiveTexture( GL_TEXTURE0 + static_cast<GLint>( i_id ) );
-		EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
-	}
-	// Bind the texture to the texture unit
-	{
-		EAE6320_ASSERT( m_textureId != 0 );
-		glBindTexture( GL_TEXTURE_2D, m_textureId );
-		EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+		// Make the texture unit active
+		if ( StateCache::SetActiveTextureUnit( i_id ) )
+		{
+			glActiveTexture( GL_TEXTURE0 + static_cast<GLint>( i_id ) );
+			EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+		}
+		// Bind the texture to the texture unit
+		{
+			glBindTexture( GL_TEXTURE_2D, m_textureId );
+			EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+		}
 	}
 }
 
@@ -40,6 +45,7 @@ bool eae6320::Graphics::cTexture::CleanUp()
 	{
 		const GLsizei textureCount = 1;
 		glDeleteTextures( textureCount, &m_textureId );
+		StateCache::NotifyTextureDeleted( m_textureId );
 		const GLenum errorCode = glGetError();
 		if ( errorCode != GL_NO_ERROR )
 		{
@@ -73,6 +79,14 @@ bool eae6320::Graphics::cTexture::Initialize( const char* const i_path, const sD
 		{
 			if ( m_textureId != 0 )
 			{
+				// The new texture is bound to whichever texture unit is active,
+				// and so the cache needs to know which one that is
+				if ( StateCache::SetActiveTextureUnit( 0 ) )
+				{
+					glActiveTexture( GL_TEXTURE0 );
+					EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
+				}
+				StateCache::BindTexture( 0, m_textureId );
 				glBindTexture( GL_TEXTURE_2D, m_textureId );
 				const GLenum errorCode = glGetError();
 				if ( errorCode != GL_NO_ERROR )
@@ -156,6 +170,10 @@ bool eae6320::Graphics::cTexture::Initialize( const char* const i_path, const sD
 			}
 		}
 		EAE6320_ASSERTF( currentPosition == endOfFile, "The DDS file %s has more data than it should", i_path );
+		// A texture that doesn't have every MIP level (e.g. an atlas, whose gutters are only wide enough for a few)
+		// can only be sampled with MIP maps if OpenGL knows which level is the last one
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>( i_ddsInfo.mipLevelCount ) - 1 );
+		EAE6320_ASSERT( glGetError() == GL_NO_ERROR );
 	}
 
 OnExit:
@@ -165,6 +183,7 @@ OnExit:
 		const GLsizei textureCount = 1;
 		glDeleteTextures( textureCount, &m_textureId );
 		EAE6320_ASSERT( glGetError == GL_NO_ERROR );
+		StateCache::NotifyTextureDeleted( m_textureId );
 		m_textureId = 0;
 	}
 	
@@ -0,0 +1,243 @@
+// Header Files
+//=============
+
+#include "StateCache.h"
+
+#include "../Asserts/Asserts.h"
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+	// This is never a valid ID,
+	// and so anything compared against it will be bound
+	const eae6320::Graphics::StateCache::tId s_unknownId = ~eae6320::Graphics::StateCache::tId( 0 );
+	const unsigned int s_unknownTextureUnit = ~0u;
+
+	const unsigned int s_textureUnitCount = 16;
+	const unsigned int s_uniformBufferBindingPointCount = 16;
+
+	eae6320::Graphics::StateCache::tId s_programId = s_unknownId;
+	eae6320::Graphics::StateCache::tId s_vertexArrayId = s_unknownId;
+	unsigned int s_activeTextureUnit = s_unknownTextureUnit;
+	eae6320::Graphics::StateCache::tId s_textureIds[s_textureUnitCount] =
+	{
+		s_unknownId, s_unknownId, s_unknownId, s_unknownId, s_unknownId, s_unknownId, s_unknownId, s_unknownId,
+		s_unknownId, s_unknownId, s_unknownId, s_unknownId, s_unknownId, s_unknownId, s_unknownId, s_unknownId,
+	};
+	eae6320::Graphics::StateCache::tId s_arrayBufferId = s_unknownId;
+	eae6320::Graphics::StateCache::tId s_uniformBufferId = s_unknownId;
+	eae6320::Graphics::StateCache::tId s_uniformBufferBindingIds[s_uniformBufferBindingPointCount] =
+	{
+		s_unknownId, s_unknownId, s_unknownId, s_unknownId, s_unknownId, s_unknownId, s_unknownId, s_unknownId,
+		s_unknownId, s_unknownId, s_unknownId, s_unknownId, s_unknownId, s_unknownId, s_unknownId, s_unknownId,
+	};
+	uint8_t s_renderStateBits = 0;
+	// Only the bits set in this mask are known to match the GPU
+	uint8_t s_knownRenderStateBits = 0;
+
+	eae6320::Graphics::StateCache::sStatistics s_statistics = {};
+}
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	// Updates the cached value and the statistics,
+	// and returns whether the new value must be bound
+	template<typename tValue>
+	bool Bind( tValue& io_cachedValue, const tValue i_newValue, const eae6320::Graphics::StateCache::eStateType i_stateType );
+	void ForgetId( eae6320::Graphics::StateCache::tId& io_cachedId, const eae6320::Graphics::StateCache::tId i_deletedId );
+}
+
+// Interface
+//==========
+
+// Binding
+//--------
+
+bool eae6320::Graphics::StateCache::BindProgram( const tId i_programId )
+{
+	return Bind( s_programId, i_programId, Program );
+}
+
+bool eae6320::Graphics::StateCache::BindVertexArray( const tId i_vertexArrayId )
+{
+	return Bind( s_vertexArrayId, i_vertexArrayId, VertexArray );
+}
+
+bool eae6320::Graphics::StateCache::SetActiveTextureUnit( const unsigned int i_textureUnit )
+{
+	EAE6320_ASSERT( i_textureUnit < s_textureUnitCount );
+	return Bind( s_activeTextureUnit, i_textureUnit, ActiveTextureUnit );
+}
+
+bool eae6320::Graphics::StateCache::BindTexture( const unsigned int i_textureUnit, const tId i_textureId )
+{
+	EAE6320_ASSERT( i_textureUnit < s_textureUnitCount );
+	return Bind( s_textureIds[i_textureUnit], i_textureId, Texture );
+}
+
+bool eae6320::Graphics::StateCache::BindArrayBuffer( const tId i_bufferId )
+{
+	return Bind( s_arrayBufferId, i_bufferId, Buffer );
+}
+
+bool eae6320::Graphics::StateCache::BindUniformBuffer( const tId i_bufferId )
+{
+	return Bind( s_uniformBufferId, i_bufferId, Buffer );
+}
+
+bool eae6320::Graphics::StateCache::BindUniformBufferToBindingPoint( const unsigned int i_bindingPoint, const tId i_bufferId )
+{
+	EAE6320_ASSERT( i_bindingPoint < s_uniformBufferBindingPointCount );
+	const bool shouldBind = Bind( s_uniformBufferBindingIds[i_bindingPoint], i_bufferId, UniformBufferBinding );
+	if ( shouldBind )
+	{
+		s_uniformBufferId = i_bufferId;
+	}
+	return shouldBind;
+}
+
+void eae6320::Graphics::StateCache::NotifyUniformBufferRangeBound( const unsigned int i_bindingPoint, const tId i_bufferId )
+{
+	EAE6320_ASSERT( i_bindingPoint < s_uniformBufferBindingPointCount );
+	s_uniformBufferBindingIds[i_bindingPoint] = s_unknownId;
+	s_uniformBufferId = i_bufferId;
+	++s_statistics.issuedCounts[UniformBufferBinding];
+}
+
+uint8_t eae6320::Graphics::StateCache::SetRenderState( const uint8_t i_renderStateBits )
+{
+	const uint8_t changedBits = static_cast<uint8_t>( ( i_renderStateBits ^ s_renderStateBits ) | ~s_knownRenderStateBits );
+	s_renderStateBits = i_renderStateBits;
+	s_knownRenderStateBits = 0xff;
+	if ( changedBits != 0 )
+	{
+		++s_statistics.issuedCounts[RenderState];
+	}
+	else
+	{
+		++s_statistics.skippedCounts[RenderState];
+	}
+	return changedBits;
+}
+
+// Invalidation
+//-------------
+
+void eae6320::Graphics::StateCache::Invalidate()
+{
+	s_programId = s_unknownId;
+	s_vertexArrayId = s_unknownId;
+	s_activeTextureUnit = s_unknownTextureUnit;
+	for ( unsigned int i = 0; i < s_textureUnitCount; ++i )
+	{
+		s_textureIds[i] = s_unknownId;
+	}
+	s_arrayBufferId = s_unknownId;
+	s_uniformBufferId = s_unknownId;
+	for ( unsigned int i = 0; i < s_uniformBufferBindingPointCount; ++i )
+	{
+		s_uniformBufferBindingIds[i] = s_unknownId;
+	}
+	s_knownRenderStateBits = 0;
+}
+
+void eae6320::Graphics::StateCache::InvalidateRenderState( const uint8_t i_renderStateBits )
+{
+	s_knownRenderStateBits &= ~i_renderStateBits;
+}
+
+void eae6320::Graphics::StateCache::NotifyProgramDeleted( const tId i_programId )
+{
+	ForgetId( s_programId, i_programId );
+}
+
+void eae6320::Graphics::StateCache::NotifyVertexArrayDeleted( const tId i_vertexArrayId )
+{
+	ForgetId( s_vertexArrayId, i_vertexArrayId );
+}
+
+void eae6320::Graphics::StateCache::NotifyTextureDeleted( const tId i_textureId )
+{
+	for ( unsigned int i = 0; i < s_textureUnitCount; ++i )
+	{
+		ForgetId( s_textureIds[i], i_textureId );
+	}
+}
+
+void eae6320::Graphics::StateCache::NotifyBufferDeleted( const tId i_bufferId )
+{
+	ForgetId( s_arrayBufferId, i_bufferId );
+	ForgetId( s_uniformBufferId, i_bufferId );
+	for ( unsigned int i = 0; i < s_uniformBufferBindingPointCount; ++i )
+	{
+		ForgetId( s_uniformBufferBindingIds[i], i_bufferId );
+	}
+}
+
+// Statistics
+//-----------
+
+uint32_t eae6320::Graphics::StateCache::sStatistics::GetIssuedCount() const
+{
+	uint32_t count = 0;
+	for ( unsigned int i = 0; i < StateTypeCount; ++i )
+	{
+		count += issuedCounts[i];
+	}
+	return count;
+}
+
+uint32_t eae6320::Graphics::StateCache::sStatistics::GetSkippedCount() const
+{
+	uint32_t count = 0;
+	for ( unsigned int i = 0; i < StateTypeCount; ++i )
+	{
+		count += skippedCounts[i];
+	}
+	return count;
+}
+
+const eae6320::Graphics::StateCache::sStatistics& eae6320::Graphics::StateCache::GetStatistics()
+{
+	return s_statistics;
+}
+
+void eae6320::Graphics::StateCache::ResetStatistics()
+{
+	s_statistics = sStatistics();
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	template<typename tValue>
+	bool Bind( tValue& io_cachedValue, const tValue i_newValue, const eae6320::Graphics::StateCache::eStateType i_stateType )
+	{
+		if ( io_cachedValue != i_newValue )
+		{
+			io_cachedValue = i_newValue;
+			++s_statistics.issuedCounts[i_stateType];
+			return true;
+		}
+		else
+		{
+			++s_statistics.skippedCounts[i_stateType];
+			return false;
+		}
+	}
+
+	void ForgetId( eae6320::Graphics::StateCache::tId& io_cachedId, const eae6320::Graphics::StateCache::tId i_deletedId )
+	{
+		if ( io_cachedId == i_deletedId )
+		{
+			io_cachedId = s_unknownId;
+		}
+	}
+}
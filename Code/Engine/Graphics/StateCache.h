@@ -0,0 +1,151 @@
+/*
+	The state cache remembers what is currently bound on the GPU
+	so that binding something that is already bound can be skipped
+
+	It doesn't call the graphics API itself:
+	each function returns whether the caller needs to make the call,
+	and so the same cache is used by every platform.
+	Anything that changes bound state without going through the cache
+	must tell the cache (with one of the Invalidate or Notify functions)
+	or later binds may be skipped incorrectly.
+*/
+
+#ifndef EAE6320_GRAPHICS_STATECACHE_H
+#define EAE6320_GRAPHICS_STATECACHE_H
+
+// Header Files
+//=============
+
+#include "Configuration.h"
+
+#include <cstdint>
+
+#ifdef EAE6320_PLATFORM_GL
+	#include "OpenGL/Includes.h"
+#endif
+
+// Type Definitions
+//=================
+
+namespace eae6320
+{
+	namespace Graphics
+	{
+		namespace StateCache
+		{
+#if defined( EAE6320_PLATFORM_GL )
+			typedef GLuint tId;
+#else
+			typedef uint32_t tId;
+#endif
+		}
+	}
+}
+
+// Enum Declarations
+//==================
+
+namespace eae6320
+{
+	namespace Graphics
+	{
+		namespace StateCache
+		{
+			enum eStateType
+			{
+				Program,
+				VertexArray,
+				ActiveTextureUnit,
+				Texture,
+				// The generic (non-indexed) array and uniform buffer binding points
+				Buffer,
+				// The indexed uniform buffer binding points that shaders read from
+				UniformBufferBinding,
+				RenderState,
+
+				StateTypeCount
+			};
+		}
+	}
+}
+
+// Struct Declarations
+//====================
+
+namespace eae6320
+{
+	namespace Graphics
+	{
+		namespace StateCache
+		{
+			struct sStatistics
+			{
+				uint32_t issuedCounts[StateTypeCount];
+				uint32_t skippedCounts[StateTypeCount];
+
+				uint32_t GetIssuedCount() const;
+				uint32_t GetSkippedCount() const;
+			};
+		}
+	}
+}
+
+// Interface
+//==========
+
+namespace eae6320
+{
+	namespace Graphics
+	{
+		namespace StateCache
+		{
+			// Binding
+			//--------
+
+			// Each of these returns true if the state is different from what is cached
+			// (and so the caller must bind it)
+			bool BindProgram( const tId i_programId );
+			bool BindVertexArray( const tId i_vertexArrayId );
+			bool SetActiveTextureUnit( const unsigned int i_textureUnit );
+			// The caller must make the texture unit active before binding
+			// (i.e. call SetActiveTextureUnit() if this returns true)
+			bool BindTexture( const unsigned int i_textureUnit, const tId i_textureId );
+			bool BindArrayBuffer( const tId i_bufferId );
+			bool BindUniformBuffer( const tId i_bufferId );
+			// Binding a buffer to an indexed binding point also binds it to the generic one
+			bool BindUniformBufferToBindingPoint( const unsigned int i_bindingPoint, const tId i_bufferId );
+			// Binding a range of a buffer can't be skipped (the range is different every time),
+			// and so the cache is only told about it
+			// (and the next call to BindUniformBufferToBindingPoint() for the same binding point will be made)
+			void NotifyUniformBufferRangeBound( const unsigned int i_bindingPoint, const tId i_bufferId );
+			// Returns the bits (from RenderStates::eRenderState) whose state needs to be set,
+			// and so only the fixed-function state that actually changed is touched
+			uint8_t SetRenderState( const uint8_t i_renderStateBits );
+
+			// Invalidation
+			//-------------
+
+			// Forgets everything, and so the next bind of anything will be made
+			// (this must be called whenever a new context is made current)
+			void Invalidate();
+			// Forgets the state of specific render state bits
+			// (e.g. after the depth mask is changed to clear the depth buffer)
+			void InvalidateRenderState( const uint8_t i_renderStateBits = 0xff );
+
+			// A deleted ID can be reused by a new object,
+			// and so the cache must forget about it
+			void NotifyProgramDeleted( const tId i_programId );
+			void NotifyVertexArrayDeleted( const tId i_vertexArrayId );
+			void NotifyTextureDeleted( const tId i_textureId );
+			void NotifyBufferDeleted( const tId i_bufferId );
+
+			// Statistics
+			//-----------
+
+			const sStatistics& GetStatistics();
+			void ResetStatistics();
+		}
+	}
+}
+
+#endif	// EAE6320_GRAPHICS_STATECACHE_H
@@ -4,19 +4,26 @@
 
 void eae6320::Graphics::Transform::Move(Math::cVector i_position)
 {
-	position = i_position;
-	updateTransform();
+	if (i_position != position)
+	{
+		position = i_position;
+		isLocalToWorldDirty = true;
+	}
 }
 
 void eae6320::Graphics::Transform::Rotate(Math::cVector i_rotation)
 {
-	euler = i_rotation;
-	updateTransform();
+	if (i_rotation != euler)
+	{
+		euler = i_rotation;
+		isOrientationDirty = true;
+		isLocalToWorldDirty = true;
+	}
 }
 
-void eae6320::Graphics::Transform::updateTransform()
+void eae6320::Graphics::Transform::updateOrientation() const
 {
-	orientation = Math::cQuaternion(Math::ConvertDegreesToRadians(euler.x), Math::cVector(1, 0, 0)) * Math::cQuaternion(Math::ConvertDegreesToRadians(euler.y), Math::cVector(0, 1, 0)) * Math::cQuaternion(Math::ConvertDegreesToRadians(euler.z), Math::cVector(0, 0, 1));
+	orientation = Math::cQuaternion::CreateFromEulerAngles(Math::cVector(Math::ConvertDegreesToRadians(euler.x), Math::ConvertDegreesToRadians(euler.y), Math::ConvertDegreesToRadians(euler.z)));
 	Math::cVector front;
 	Math::cQuaternion inversedOrientation;
 	inversedOrientation = orientation.CreateInverse();
@@ -24,4 +31,11 @@ void eae6320::Graphics::Transform::updateTransform()
 	forward = front.CreateNormalized();
 	right = Math::Cross(forward, Math::cVector(0, 1, 0)).CreateNormalized();
 	up = Math::Cross(right, forward);
+	isOrientationDirty = false;
+}
+
+void eae6320::Graphics::Transform::updateLocalToWorld() const
+{
+	localToWorld = Math::cMatrix_transformation(getOrientation(), position);
+	isLocalToWorldDirty = false;
 }
\ No newline at end of file
@@ -14,31 +14,39 @@ namespace eae6320
 		private:
 			Math::cVector position;
 			Math::cVector euler;
-			Math::cQuaternion orientation;
-			Math::cVector forward;
-			Math::cVector right;
-			Math::cVector up;
-			void updateTransform();
+			// Everything below is derived from the position and the Euler angles.
+			// Changing either only marks the derived values as dirty,
+			// and they are recalculated the first time they are read afterwards
+			// (so an object that is moved many times in a frame only pays once,
+			// and an object that never moves only pays once ever)
+			mutable Math::cQuaternion orientation;
+			mutable Math::cVector forward;
+			mutable Math::cVector right;
+			mutable Math::cVector up;
+			mutable Math::cMatrix_transformation localToWorld;
+			mutable bool isOrientationDirty;
+			mutable bool isLocalToWorldDirty;
+			void updateOrientation() const;
+			void updateLocalToWorld() const;
 		public:
 			Transform()
+				: isOrientationDirty(true), isLocalToWorldDirty(true)
 			{
-				updateTransform();
 			}
 			Transform(Math::cVector initialPosition, Math::cVector initialRotation)
+				: position(initialPosition), euler(initialRotation), isOrientationDirty(true), isLocalToWorldDirty(true)
 			{
-				position = initialPosition;
-				euler = initialRotation;
-				updateTransform();
 			}
 			void Move(Math::cVector);
 			void Rotate(Math::cVector);
 			Math::cVector getPosition() const { return position; }
-			Math::cVector getRotation() { return euler; }
+			Math::cVector getRotation() const { return euler; }
 
-			Math::cQuaternion getOrientation() { return orientation; }
-			Math::cVector getForward() const { return forward; }
-			Math::cVector getRight() const { return right; }
-			Math::cVector getUp() const { return up; }
+			Math::cQuaternion getOrientation() const { if (isOrientationDirty) updateOrientation(); return orientation; }
+			Math::cVector getForward() const { if (isOrientationDirty) updateOrientation(); return forward; }
+			Math::cVector getRight() const { if (isOrientationDirty) updateOrientation(); return right; }
+			Math::cVector getUp() const { if (isOrientationDirty) updateOrientation(); return up; }
+			const Math::cMatrix_transformation& getLocalToWorldTransform() const { if (isLocalToWorldDirty) updateLocalToWorld(); return localToWorld; }
 		};
 	}
 }
@@ -20,6 +20,51 @@ namespace eae6320
 				u = i_u; v = i_v;
 			}
 		};
+
+		// Built meshes can store their vertices in this smaller layout instead
+		// (16 bytes instead of 24)
+		struct sVertex_compressed
+		{
+			// Each component is a 16 bit fraction of the way across the mesh's bounds
+			// (the GPU reads it as [0,1] and the mesh's position dequantization turns it back into local space)
+			uint16_t x, y, z;
+			uint16_t padding;
+			uint8_t red, blue, green, alpha;
+			// Half floats, or 16 bit fractions of [0,1] (see VertexFormats below)
+			uint16_t u, v;
+		};
+
+		namespace VertexFormats
+		{
+			enum eVertexFormat
+			{
+				// sVertex
+				Uncompressed,
+				// sVertex_compressed with half float texture coordinates
+				Compressed,
+				// sVertex_compressed with texture coordinates that are 16 bit fractions of [0,1].
+				// Half floats only have a precision of 1/2048 between 0.5 and 1,
+				// which is a whole texel of a 2048 texture,
+				// and so meshes whose texture coordinates were moved into an atlas use this instead
+				// (its precision is 1/65535 everywhere)
+				Compressed_unormTextureCoordinates,
+			};
+
+			inline bool IsCompressed( const uint32_t i_type )
+			{
+				return ( i_type == Compressed ) || ( i_type == Compressed_unormTextureCoordinates );
+			}
+		}
+
+		// This is stored in every built mesh so that the game knows how to read its vertices
+		struct sVertexFormat
+		{
+			uint32_t type;	// VertexFormats::eVertexFormat
+			// A compressed position is multiplied by the scale and then has the bias added to it
+			// (an uncompressed mesh has a scale of one and a bias of zero)
+			float positionScale[3];
+			float positionBias[3];
+		};
 	}
 }
-#endif // EAE6320_VERTEX_DATA_H
\ No newline at end of file
+#endif // EAE6320_VERTEX_DATA_H
@@ -0,0 +1,114 @@
+// Header Files
+//=============
+
+#include "cFrameArena.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include "../Asserts/Asserts.h"
+#include "../Logging/Logging.h"
+
+// Interface
+//==========
+
+// Allocation
+//-----------
+
+void* eae6320::Graphics::cFrameArena::Allocate( const size_t i_size, const size_t i_alignment )
+{
+	EAE6320_ASSERT( ( i_alignment != 0 ) && ( ( i_alignment & ( i_alignment - 1 ) ) == 0 ) );
+
+	// Try the current block and then any empty blocks after it
+	// (a block that is too small for this allocation is skipped for the rest of the frame)
+	while ( m_currentBlock )
+	{
+		const uintptr_t blockMemory = reinterpret_cast<uintptr_t>( m_currentBlock + 1 );
+		const uintptr_t allocation = ( blockMemory + m_currentBlock->usedSize + ( i_alignment - 1 ) ) & ~uintptr_t( i_alignment - 1 );
+		const size_t usedSize = static_cast<size_t>( allocation - blockMemory ) + i_size;
+		if ( usedSize <= m_currentBlock->size )
+		{
+			m_currentBlock->usedSize = usedSize;
+			return reinterpret_cast<void*>( allocation );
+		}
+		if ( !m_currentBlock->next )
+		{
+			break;
+		}
+		m_currentBlock = m_currentBlock->next;
+	}
+
+	// Allocate a new block that is big enough for the allocation no matter how its memory is aligned
+	size_t blockSize = i_size + i_alignment;
+	if ( blockSize < s_minBlockSize )
+	{
+		blockSize = s_minBlockSize;
+	}
+	sBlock* const newBlock = static_cast<sBlock*>( malloc( sizeof( sBlock ) + blockSize ) );
+	if ( !newBlock )
+	{
+		EAE6320_ASSERTF( false, "A frame arena couldn't allocate a new block" );
+		Logging::OutputError( "Failed to allocate %u bytes for a frame arena", static_cast<unsigned int>( sizeof( sBlock ) + blockSize ) );
+		return NULL;
+	}
+	newBlock->next = NULL;
+	newBlock->size = blockSize;
+	newBlock->usedSize = 0;
+	if ( m_currentBlock )
+	{
+		m_currentBlock->next = newBlock;
+	}
+	else
+	{
+		m_firstBlock = newBlock;
+	}
+	m_currentBlock = newBlock;
+
+	return Allocate( i_size, i_alignment );
+}
+
+void eae6320::Graphics::cFrameArena::Reset()
+{
+	for ( sBlock* block = m_firstBlock; block; block = block->next )
+	{
+		block->usedSize = 0;
+	}
+	m_currentBlock = m_firstBlock;
+}
+
+// Access
+//-------
+
+size_t eae6320::Graphics::cFrameArena::GetUsedSize() const
+{
+	size_t usedSize = 0;
+	for ( const sBlock* block = m_firstBlock; block; block = block->next )
+	{
+		usedSize += block->usedSize;
+	}
+	return usedSize;
+}
+
+size_t eae6320::Graphics::cFrameArena::GetReservedSize() const
+{
+	size_t reservedSize = 0;
+	for ( const sBlock* block = m_firstBlock; block; block = block->next )
+	{
+		reservedSize += block->size;
+	}
+	return reservedSize;
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::Graphics::cFrameArena::~cFrameArena()
+{
+	sBlock* block = m_firstBlock;
+	while ( block )
+	{
+		sBlock* const nextBlock = block->next;
+		free( block );
+		block = nextBlock;
+	}
+	m_firstBlock = m_currentBlock = NULL;
+}
@@ -0,0 +1,94 @@
+/*
+	A frame arena is a linear allocator for memory that only needs to last until a frame has been drawn
+
+	Allocating only increments an offset,
+	and everything that was allocated is freed at once by Reset().
+	The memory is kept in blocks that never move
+	(and so anything that was allocated stays where it is until Reset() is called)
+	and that are kept after a reset,
+	and so once the arena has grown to the size that a frame needs nothing else is allocated from the system.
+
+	No destructors are called,
+	and so only types that don't need to be destroyed should be allocated from an arena.
+*/
+
+#ifndef EAE6320_GRAPHICS_CFRAMEARENA_H
+#define EAE6320_GRAPHICS_CFRAMEARENA_H
+
+// Header Files
+//=============
+
+#include <cstddef>
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+	namespace Graphics
+	{
+		class cFrameArena
+		{
+			// Interface
+			//==========
+
+		public:
+
+			// Allocation
+			//-----------
+
+			// The alignment must be a power of two.
+			// Returns NULL if the system is out of memory.
+			void* Allocate( const size_t i_size, const size_t i_alignment );
+			// Frees everything that has been allocated
+			// (but keeps the memory so that it can be allocated again)
+			void Reset();
+
+			// Access
+			//-------
+
+			// This includes memory that is skipped for alignment
+			size_t GetUsedSize() const;
+			size_t GetReservedSize() const;
+
+			// Initialization / Clean Up
+			//--------------------------
+
+			cFrameArena() {}
+			~cFrameArena();
+
+			// Data
+			//=====
+
+		private:
+
+			// Every block's memory immediately follows its header
+			struct sBlock
+			{
+				sBlock* next;
+				size_t size;
+				size_t usedSize;
+			};
+
+			// Nothing is allocated from the system until the first allocation,
+			// and blocks smaller than this are never allocated
+			static const size_t s_minBlockSize = 64 * 1024;
+
+			sBlock* m_firstBlock = NULL;
+			// Every block before this one is full (as far as the current frame is concerned)
+			// and every block after it is empty
+			sBlock* m_currentBlock = NULL;
+
+			// Implementation
+			//===============
+
+		private:
+
+			// An arena owns its memory, and so it can't be copied
+			cFrameArena( const cFrameArena& ) = delete;
+			cFrameArena& operator =( const cFrameArena& ) = delete;
+		};
+	}
+}
+
+#endif	// EAE6320_GRAPHICS_CFRAMEARENA_H
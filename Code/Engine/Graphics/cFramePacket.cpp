@@ -0,0 +1,121 @@
+// Header Files
+//=============
+
+#include "cFramePacket.h"
+
+#include <cstring>
+#include <new>
+#include "VertexData.h"
+#include "../Asserts/Asserts.h"
+
+// Interface
+//==========
+
+// Submission
+//-----------
+
+void eae6320::Graphics::cFramePacket::AddMeshObject( const MeshObject& i_meshObject )
+{
+	EAE6320_ASSERT( i_meshObject.material && i_meshObject.mesh );
+	if ( sMeshObjectNode* const node = AddNode( m_meshObjects ) )
+	{
+		node->meshObject = i_meshObject;
+	}
+}
+
+void eae6320::Graphics::cFramePacket::AddSprite( const UIObject& i_uiObject )
+{
+	EAE6320_ASSERT( i_uiObject.material && i_uiObject.sprite );
+	if ( sSpriteNode* const node = AddNode( m_sprites ) )
+	{
+		node->material = i_uiObject.material;
+		node->sprite = i_uiObject.sprite;
+	}
+}
+
+void eae6320::Graphics::cFramePacket::AddText( const UIText& i_uiText )
+{
+	EAE6320_ASSERT( i_uiText.material && i_uiText.text );
+	const size_t characterCount = i_uiText.text->GetCharacterCount();
+	if ( characterCount == 0 )
+	{
+		return;
+	}
+	// The characters are copied so that the game thread can change the text while the render thread is drawing this packet
+	const size_t vertexDataSize = characterCount * 4 * sizeof( sVertex );
+	void* const vertexData = m_arena.Allocate( vertexDataSize, alignof( sVertex ) );
+	if ( !vertexData )
+	{
+		// The error has already been reported
+		return;
+	}
+	std::memcpy( vertexData, i_uiText.text->GetVertexData(), vertexDataSize );
+	if ( sTextNode* const node = AddNode( m_texts ) )
+	{
+		node->material = i_uiText.material;
+		node->vertexData = static_cast<const sVertex*>( vertexData );
+		node->characterCount = static_cast<uint32_t>( characterCount );
+	}
+}
+
+void eae6320::Graphics::cFramePacket::SetFrameConstants( const sFrame& i_frameData, const float i_nearPlane, const float i_farPlane )
+{
+	m_frameData = i_frameData;
+	m_nearPlane = i_nearPlane;
+	m_farPlane = i_farPlane;
+}
+
+void eae6320::Graphics::cFramePacket::AddTask( const std::function<void()>& i_task )
+{
+	m_tasks.push_back( i_task );
+}
+
+// Access
+//-------
+
+void eae6320::Graphics::cFramePacket::RunTasks()
+{
+	// The tasks are run in the order that they were added
+	// (e.g. a mesh must be created before it can be changed)
+	for ( const std::function<void()>& task : m_tasks )
+	{
+		task();
+	}
+	m_tasks.clear();
+}
+
+void eae6320::Graphics::cFramePacket::Reset()
+{
+	EAE6320_ASSERTF( m_tasks.empty(), "A frame packet's tasks must be run before it is reset" );
+	m_meshObjects = sList<sMeshObjectNode>();
+	m_sprites = sList<sSpriteNode>();
+	m_texts = sList<sTextNode>();
+	m_arena.Reset();
+}
+
+// Implementation
+//===============
+
+template<typename tNode>
+tNode* eae6320::Graphics::cFramePacket::AddNode( sList<tNode>& io_list )
+{
+	void* const memory = m_arena.Allocate( sizeof( tNode ), alignof( tNode ) );
+	if ( !memory )
+	{
+		// The error has already been reported
+		return NULL;
+	}
+	tNode* const node = new ( memory ) tNode;
+	node->next = NULL;
+	if ( io_list.last )
+	{
+		io_list.last->next = node;
+	}
+	else
+	{
+		io_list.first = node;
+	}
+	io_list.last = node;
+	++io_list.count;
+	return node;
+}
@@ -0,0 +1,124 @@
+/*
+	A frame packet holds everything that the render thread needs to draw a single frame
+
+	The game thread fills one packet while the render thread draws another one,
+	and so nothing that the render thread reads is ever changed while it is drawing.
+	Mesh objects and the laid out characters of text are copied into the packet's arena when they are submitted
+	(and so a text can be changed as soon as it has been submitted).
+	UI sprites and materials are only referenced,
+	and so they must not be destroyed until the frame has been drawn.
+*/
+
+#ifndef EAE6320_GRAPHICS_CFRAMEPACKET_H
+#define EAE6320_GRAPHICS_CFRAMEPACKET_H
+
+// Header Files
+//=============
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include "cFrameArena.h"
+#include "ConstantBufferData.h"
+#include "Graphics.h"
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+	namespace Graphics
+	{
+		class cFramePacket
+		{
+			// Interface
+			//==========
+
+		public:
+
+			// Every list is stored in the arena as a singly-linked list in the order that things were submitted
+			struct sMeshObjectNode
+			{
+				MeshObject meshObject;
+				const sMeshObjectNode* next;
+			};
+			struct sSpriteNode
+			{
+				const cMaterial* material;
+				const cSprite* sprite;
+				const sSpriteNode* next;
+			};
+			struct sTextNode
+			{
+				const cMaterial* material;
+				// There are 4 vertices for every character
+				const sVertex* vertexData;
+				uint32_t characterCount;
+				const sTextNode* next;
+			};
+
+			// Submission
+			//-----------
+
+			// These are only called by the game thread
+			void AddMeshObject( const MeshObject& i_meshObject );
+			void AddSprite( const UIObject& i_uiObject );
+			void AddText( const UIText& i_uiText );
+			void SetFrameConstants( const sFrame& i_frameData, const float i_nearPlane, const float i_farPlane );
+			// Tasks are run by the render thread before the packet is drawn
+			void AddTask( const std::function<void()>& i_task );
+
+			// Access
+			//-------
+
+			// These are only called by the render thread
+			const sMeshObjectNode* GetMeshObjects() const { return m_meshObjects.first; }
+			uint32_t GetMeshObjectCount() const { return m_meshObjects.count; }
+			const sSpriteNode* GetSprites() const { return m_sprites.first; }
+			const sTextNode* GetTexts() const { return m_texts.first; }
+			const sFrame& GetFrameConstants() const { return m_frameData; }
+			float GetNearPlane() const { return m_nearPlane; }
+			float GetFarPlane() const { return m_farPlane; }
+			void RunTasks();
+
+			// Empties the packet so that it can be filled again
+			// (the memory is kept so that nothing needs to be allocated in later frames)
+			void Reset();
+
+			// Data
+			//=====
+
+		private:
+
+			template<typename tNode>
+			struct sList
+			{
+				tNode* first = NULL;
+				tNode* last = NULL;
+				uint32_t count = 0;
+			};
+
+			cFrameArena m_arena;
+			sList<sMeshObjectNode> m_meshObjects;
+			sList<sSpriteNode> m_sprites;
+			sList<sTextNode> m_texts;
+			sFrame m_frameData;
+			float m_nearPlane = 0.0f;
+			float m_farPlane = 1.0f;
+			// Tasks are rare (they are only used to change graphics resources while the game is running)
+			// and can capture anything, and so they aren't kept in the arena
+			std::vector<std::function<void()>> m_tasks;
+
+			// Implementation
+			//===============
+
+		private:
+
+			// Allocates a node from the arena and adds it to the end of a list
+			template<typename tNode>
+			tNode* AddNode( sList<tNode>& io_list );
+		};
+	}
+}
+
+#endif	// EAE6320_GRAPHICS_CFRAMEPACKET_H
@@ -1,8 +1,39 @@
 #include "cMaterial.h"
+
+#include <cstring>
+#include <map>
+#include <string>
+#include "Graphics.h"
 #include "../Platform/Platform.h"
 #include "../Logging/Logging.h"
 #include "../Asserts/Asserts.h"
 
+// Static Data Initialization
+//===========================
+
+uint32_t eae6320::Graphics::cMaterial::s_sortIdCount = 0;
+
+namespace
+{
+	// Materials that use the same texture file share a single texture
+	// (e.g. materials whose images were packed into the same atlas),
+	// and so it isn't bound again when they are drawn one after another
+	struct sLoadedTexture
+	{
+		eae6320::Graphics::cTexture* texture;
+		unsigned int referenceCount;
+	};
+	std::map<std::string, sLoadedTexture> s_loadedTextures;
+
+	// Materials that were loaded with LoadShared()
+	// (these are only used by the game thread)
+	struct sLoadedMaterial
+	{
+		eae6320::Graphics::cMaterial* material;
+		unsigned int referenceCount;
+	};
+	std::map<std::string, sLoadedMaterial> s_loadedMaterials;
+}
 
 bool eae6320::Graphics::cMaterial::Load(const char * i_materialPath)
 {
@@ -26,8 +57,14 @@ bool eae6320::Graphics::cMaterial::Load(const char * i_materialPath)
 		m_effect->Load(effectPath);
 
 		const char* const texturePath = reinterpret_cast<char*>(data + sizeof(eae6320::Graphics::sMaterial) + std::strlen(effectPath) + 1);
-		m_texture = new eae6320::Graphics::cTexture();
-		m_texture->Load(texturePath);
+		sLoadedTexture& loadedTexture = s_loadedTextures[texturePath];
+		if (!loadedTexture.texture)
+		{
+			loadedTexture.texture = new eae6320::Graphics::cTexture();
+			loadedTexture.texture->Load(texturePath);
+		}
+		++loadedTexture.referenceCount;
+		m_texture = loadedTexture.texture;
 		
 		return true;
 	}
@@ -35,20 +72,109 @@ bool eae6320::Graphics::cMaterial::Load(const char * i_materialPath)
 	return !wereThereErrors;
 }
 
-void eae6320::Graphics::cMaterial::Bind()
+unsigned int eae6320::Graphics::cMaterial::Bind(const cMaterial* const i_previousMaterial) const
 {
-	if (m_materialConstantBuffer)
+	if (i_previousMaterial == this)
+	{
+		return 0;
+	}
+	unsigned int stateChangeCount = 0;
+	if (m_materialConstantBuffer && (!i_previousMaterial || (i_previousMaterial->m_materialConstantBuffer != m_materialConstantBuffer)))
+	{
 		m_materialConstantBuffer->Bind();
-	if (m_effect)
+		++stateChangeCount;
+	}
+	if (m_effect && (!i_previousMaterial || (i_previousMaterial->m_effect != m_effect)))
+	{
 		m_effect->Bind();
-	if (m_texture)
+		++stateChangeCount;
+	}
+	if (m_texture && (!i_previousMaterial || (i_previousMaterial->m_texture != m_texture)))
+	{
 		m_texture->Bind(0);
+		++stateChangeCount;
+	}
+	return stateChangeCount;
+}
+
+unsigned int eae6320::Graphics::cMaterial::CountStateChanges(const cMaterial* const i_previousMaterial) const
+{
+	if (i_previousMaterial == this)
+	{
+		return 0;
+	}
+	unsigned int stateChangeCount = 0;
+	if (m_materialConstantBuffer && (!i_previousMaterial || (i_previousMaterial->m_materialConstantBuffer != m_materialConstantBuffer)))
+		++stateChangeCount;
+	if (m_effect && (!i_previousMaterial || (i_previousMaterial->m_effect != m_effect)))
+		++stateChangeCount;
+	if (m_texture && (!i_previousMaterial || (i_previousMaterial->m_texture != m_texture)))
+		++stateChangeCount;
+	return stateChangeCount;
 }
 
 bool eae6320::Graphics::cMaterial::CleanUp()
 {
-	m_materialConstantBuffer->CleanUp();
-	m_effect->CleanUp();
-	m_texture->CleanUp();
+	// A material that was never loaded has nothing to clean up
+	if (m_materialConstantBuffer)
+		m_materialConstantBuffer->CleanUp();
+	if (m_effect)
+		m_effect->CleanUp();
+	// A material can be cleaned up more than once,
+	// and so it stops referencing its texture the first time
+	if (m_texture)
+	{
+		for (std::map<std::string, sLoadedTexture>::iterator i = s_loadedTextures.begin(); i != s_loadedTextures.end(); ++i)
+		{
+			if (i->second.texture == m_texture)
+			{
+				if (--i->second.referenceCount == 0)
+				{
+					// The destructor cleans up the texture
+					delete i->second.texture;
+					s_loadedTextures.erase(i);
+				}
+				break;
+			}
+		}
+		m_texture = NULL;
+	}
 	return true;
+}
+
+eae6320::Graphics::cMaterial* eae6320::Graphics::cMaterial::LoadShared(const char* i_materialPath)
+{
+	sLoadedMaterial& loadedMaterial = s_loadedMaterials[i_materialPath];
+	if (!loadedMaterial.material)
+	{
+		cMaterial* const material = loadedMaterial.material = new cMaterial();
+		const std::string path = i_materialPath;
+		ExecuteOnRenderThread([material, path]() { material->Load(path.c_str()); });
+	}
+	++loadedMaterial.referenceCount;
+	return loadedMaterial.material;
+}
+
+void eae6320::Graphics::cMaterial::ReleaseShared(cMaterial*& io_material)
+{
+	if (!io_material)
+	{
+		return;
+	}
+	for (std::map<std::string, sLoadedMaterial>::iterator i = s_loadedMaterials.begin(); i != s_loadedMaterials.end(); ++i)
+	{
+		if (i->second.material == io_material)
+		{
+			if (--i->second.referenceCount == 0)
+			{
+				// The render thread might still be drawing the material,
+				// and so it is cleaned up before the next frame
+				cMaterial* const material = io_material;
+				ExecuteOnRenderThread([material]() { material->CleanUp(); delete material; });
+				s_loadedMaterials.erase(i);
+			}
+			break;
+		}
+	}
+	io_material = NULL;
 }
\ No newline at end of file
@@ -14,12 +14,33 @@ namespace eae6320
 		{
 		public:
 			bool Load(const char* i_materialPath);
-			void Bind();
+			// Anything that is shared with the previously bound material isn't bound again.
+			// Returns how many things were bound.
+			unsigned int Bind(const cMaterial* const i_previousMaterial = NULL) const;
+			// Returns how many things Bind() would bind
+			unsigned int CountStateChanges(const cMaterial* const i_previousMaterial) const;
 			bool CleanUp();
+
+			// Everything that loads a material from the same file with this shares a single material
+			// (e.g. every sprite and text that uses the same image or font),
+			// and so it can all be drawn with a single draw call.
+			// The material is loaded on the render thread (see ExecuteOnRenderThread()).
+			static cMaterial* LoadShared(const char* i_materialPath);
+			// The material is cleaned up on the render thread once nothing is using it any more,
+			// and so it must not be submitted again in the frame that it is released in
+			// (the pointer is set to NULL)
+			static void ReleaseShared(cMaterial*& io_material);
+
+			const cEffect* GetEffect() const { return m_effect; }
+			// This is unique to each material and is used to group draws with the same material together
+			uint32_t GetSortId() const { return m_sortId; }
 		private:
-			ConstantBufferDataManager* m_materialConstantBuffer;
-			cEffect* m_effect;
-			cTexture* m_texture;
+			ConstantBufferDataManager* m_materialConstantBuffer = NULL;
+			cEffect* m_effect = NULL;
+			cTexture* m_texture = NULL;
+			uint32_t m_sortId = s_sortIdCount++;
+
+			static uint32_t s_sortIdCount;
 		};
 		
 	} // namespace Graphics
@@ -0,0 +1,441 @@
+// Header Files
+//=============
+
+#include "cRenderQueue.h"
+
+#include <algorithm>
+#include "ConstantBufferData.h"
+#include "ConstantBufferDataManager.h"
+#include "Effect.h"
+#include "Mesh.h"
+#include "cMaterial.h"
+#include "../Asserts/Asserts.h"
+#include "../Math/cVector.h"
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+	// The number of bits of each field in the key
+	const unsigned int s_passBitCount = 2;
+	const unsigned int s_translucencyBitCount = 1;
+	const unsigned int s_depthBitCount = 16;
+	const unsigned int s_effectBitCount = 10;
+	const unsigned int s_materialBitCount = 14;
+	const unsigned int s_meshBitCount = 21;
+	static_assert( ( s_passBitCount + s_translucencyBitCount + s_depthBitCount + s_effectBitCount + s_materialBitCount + s_meshBitCount ) == 64,
+		"The key's fields must fill all 64 bits" );
+
+	// The pass and translucency are always the most significant bits
+	const unsigned int s_translucencyShift = 64 - s_passBitCount - s_translucencyBitCount;
+	const unsigned int s_passShift = s_translucencyShift + s_translucencyBitCount;
+
+	// Translucent meshes are sorted by depth before anything else
+	namespace Translucent
+	{
+		const unsigned int s_meshShift = 0;
+		const unsigned int s_materialShift = s_meshShift + s_meshBitCount;
+		const unsigned int s_effectShift = s_materialShift + s_materialBitCount;
+		const unsigned int s_depthShift = s_effectShift + s_effectBitCount;
+		static_assert( ( s_depthShift + s_depthBitCount ) == s_translucencyShift, "The translucent key's fields must not overlap" );
+	}
+	// Opaque meshes are sorted by depth after everything else
+	namespace Opaque
+	{
+		const unsigned int s_depthShift = 0;
+		const unsigned int s_meshShift = s_depthShift + s_depthBitCount;
+		const unsigned int s_materialShift = s_meshShift + s_meshBitCount;
+		const unsigned int s_effectShift = s_materialShift + s_materialBitCount;
+		static_assert( ( s_effectShift + s_effectBitCount ) == s_translucencyShift, "The opaque key's fields must not overlap" );
+	}
+
+	// A mesh object uses LOD i + 1 when the diameter of its bounding sphere is less than this fraction of the screen's height.
+	// An object must go past a threshold by the hysteresis fraction before it switches
+	// so that an object that stays near a threshold doesn't keep switching back and forth.
+	const float s_lodScreenSizes[eae6320::Graphics::Mesh::MAX_LOD_COUNT - 1] = { 0.25f, 0.12f, 0.06f };
+	const float s_lodHysteresis = 0.15f;
+
+	const unsigned int s_radixBitCount = 8;
+	const unsigned int s_radixCount = 1 << s_radixBitCount;
+	const unsigned int s_digitCount = 64 / s_radixBitCount;
+}
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	// The IDs wrap around if there are more objects than the field can hold.
+	// That only makes the grouping worse, though;
+	// it can't cause anything to be drawn incorrectly because the draw loop compares the objects themselves.
+	uint64_t MakeField( const uint32_t i_value, const unsigned int i_bitCount, const unsigned int i_shift );
+}
+
+// Interface
+//==========
+
+void eae6320::Graphics::cRenderQueue::SetCamera( const Math::cMatrix_transformation& i_transform_worldToCamera,
+	const Math::cMatrix_transformation& i_transform_cameraToScreen, const float i_nearPlane, const float i_farPlane )
+{
+	EAE6320_ASSERT( i_farPlane > i_nearPlane );
+	m_frustum = Math::sFrustum::CreateFromTransform( i_transform_worldToCamera * i_transform_cameraToScreen );
+	// The projection scales the camera-space Y by this (before the divide by depth),
+	// and the screen is 2 units high after the divide
+	m_screenSizeScale = i_transform_cameraToScreen.TransformDirection( Math::cVector( 0.0f, 1.0f, 0.0f ) ).y;
+	m_transform_worldToCamera = i_transform_worldToCamera;
+	m_nearPlane = i_nearPlane;
+	m_depthScale = 1.0f / ( i_farPlane - i_nearPlane );
+}
+
+void eae6320::Graphics::cRenderQueue::Submit( const MeshObject& i_meshObject )
+{
+	EAE6320_ASSERT( i_meshObject.material && i_meshObject.mesh );
+	sEntry entry;
+	entry.key = 0;
+	entry.meshObject = &i_meshObject;
+	entry.lod = 0;
+	m_entries.push_back( entry );
+}
+
+void eae6320::Graphics::cRenderQueue::Draw( ConstantBufferDataManager& io_drawCallConstantBuffer )
+{
+	// Culling first means that nothing else has to be done for the meshes that can't be seen
+	{
+		const size_t submittedCount = m_entries.size();
+		CullEntries();
+		m_statistics.culledCount = static_cast<uint32_t>( submittedCount - m_entries.size() );
+	}
+	SelectLods();
+
+	// The keys aren't calculated until now
+	// because the camera is usually updated after the meshes have been submitted
+	for ( sEntry& entry : m_entries )
+	{
+		entry.key = CalculateKey( entry );
+	}
+
+	m_statistics.instanceCount = static_cast<uint32_t>( m_entries.size() );
+	m_statistics.stateChangeCount = 0;
+	m_statistics.stateChangeCount_unsorted = 0;
+	{
+		// The entries are still in the order that they were submitted
+		const cMaterial* previousMaterial = NULL;
+		for ( const sEntry& entry : m_entries )
+		{
+			m_statistics.stateChangeCount_unsorted += entry.meshObject->material->CountStateChanges( previousMaterial );
+			previousMaterial = entry.meshObject->material;
+		}
+	}
+
+	SortEntries();
+
+	// Every following mesh object that uses the same mesh and material is an instance of the same draw call
+	// (the objects themselves are compared rather than the keys' IDs because the IDs can wrap around)
+	size_t constantsSize = 0;
+	const size_t alignment = io_drawCallConstantBuffer.GetRingBufferAlignment();
+	const size_t transformSize = sizeof( Math::cMatrix_transformation );
+	// The shader's uniform block is always the full array,
+	// and so every batch binds the block's whole size even though it only writes its own instances' transforms
+	// (the rest of the range overlaps the following batches and is never read)
+	const size_t bindSize = sizeof( sInstancedDrawCall );
+	{
+		const size_t entryCount = m_entries.size();
+		for ( size_t i = 0; i < entryCount; )
+		{
+			const MeshObject& firstMeshObject = *m_entries[i].meshObject;
+			sBatch batch;
+			batch.firstEntry = static_cast<uint32_t>( i );
+			batch.instanceCount = 0;
+			do
+			{
+				++batch.instanceCount;
+				++i;
+			} while ( ( i < entryCount ) && ( batch.instanceCount < MAX_INSTANCE_COUNT_PER_DRAW_CALL )
+				&& ( m_entries[i].meshObject->mesh == firstMeshObject.mesh )
+				&& ( m_entries[i].meshObject->material == firstMeshObject.material )
+				&& ( m_entries[i].lod == m_entries[batch.firstEntry].lod ) );
+			// Each batch's range must start at the alignment that the graphics API requires
+			batch.constantsOffset = constantsSize;
+			constantsSize += ( ( batch.instanceCount * transformSize ) + ( alignment - 1 ) ) & ~( alignment - 1 );
+			m_batches.push_back( batch );
+		}
+		// The last batch's bound range must also be inside of the mapped range
+		// (which also keeps it from extending past the end of the ring buffer)
+		if ( !m_batches.empty() && ( ( m_batches.back().constantsOffset + bindSize ) > constantsSize ) )
+		{
+			constantsSize = m_batches.back().constantsOffset + bindSize;
+		}
+	}
+
+	// Every batch's transforms are written into the ring buffer at once
+	if ( constantsSize > 0 )
+	{
+		size_t ringBufferOffset;
+		uint8_t* const constants = static_cast<uint8_t*>( io_drawCallConstantBuffer.MapRingBufferRange( constantsSize, ringBufferOffset ) );
+		if ( !constants )
+		{
+			// The error has already been reported
+			m_batches.clear();
+		}
+		for ( sBatch& batch : m_batches )
+		{
+			Math::cMatrix_transformation* const transforms = reinterpret_cast<Math::cMatrix_transformation*>( constants + batch.constantsOffset );
+			const Mesh& mesh = *m_entries[batch.firstEntry].meshObject->mesh;
+			if ( VertexFormats::IsCompressed( mesh.getVertexFormat().type ) )
+			{
+				// The mesh's positions are dequantized by the same matrix multiplication in the vertex shader
+				// that transforms them into world space
+				const Math::cMatrix_transformation& transform_dequantization = mesh.getTransform_dequantization();
+				for ( uint32_t i = 0; i < batch.instanceCount; ++i )
+				{
+					transforms[i] = transform_dequantization * m_entries[batch.firstEntry + i].meshObject->transform_localToWorld;
+				}
+			}
+			else
+			{
+				for ( uint32_t i = 0; i < batch.instanceCount; ++i )
+				{
+					transforms[i] = m_entries[batch.firstEntry + i].meshObject->transform_localToWorld;
+				}
+			}
+			batch.constantsOffset += ringBufferOffset;
+		}
+		if ( constants )
+		{
+			io_drawCallConstantBuffer.UnmapRingBufferRange();
+		}
+	}
+
+	// Nothing is known about what was bound before the queue is drawn,
+	// and so the first material binds everything
+	const cMaterial* previousMaterial = NULL;
+	m_statistics.triangleCount = 0;
+	for ( const sBatch& batch : m_batches )
+	{
+		const sEntry& firstEntry = m_entries[batch.firstEntry];
+		const MeshObject& meshObject = *firstEntry.meshObject;
+		if ( meshObject.material != previousMaterial )
+		{
+			m_statistics.stateChangeCount += meshObject.material->Bind( previousMaterial );
+			previousMaterial = meshObject.material;
+		}
+		io_drawCallConstantBuffer.BindRange( batch.constantsOffset, bindSize );
+		meshObject.mesh->DrawInstances( batch.instanceCount, firstEntry.lod );
+		if ( meshObject.mesh->getLodCount() > 0 )
+		{
+			m_statistics.triangleCount += batch.instanceCount * ( meshObject.mesh->getLod( firstEntry.lod ).indexCount / 3 );
+		}
+	}
+	m_statistics.drawCount = static_cast<uint32_t>( m_batches.size() );
+
+	// The vectors keep their memory so that nothing needs to be allocated in later frames
+	m_entries.clear();
+	m_batches.clear();
+}
+
+// Implementation
+//===============
+
+void eae6320::Graphics::cRenderQueue::CullEntries()
+{
+	const size_t entryCount = m_entries.size();
+	if ( entryCount == 0 )
+	{
+		return;
+	}
+
+	// The meshes' boxes are in their local space,
+	// and so they are transformed into boxes that contain them in world space.
+	// The extra boxes at the end are only there so that every group has a full set of boxes;
+	// their results are ignored.
+#if defined( __AVX__ )
+	const size_t boxesPerTest = 8;
+#else
+	const size_t boxesPerTest = 4;
+#endif
+	const size_t boxCount = ( entryCount + ( boxesPerTest - 1 ) ) & ~( boxesPerTest - 1 );
+	m_boxes_world.resize( boxCount );
+	for ( size_t i = 0; i < entryCount; ++i )
+	{
+		const MeshObject& meshObject = *m_entries[i].meshObject;
+		m_boxes_world[i] = Math::sAABB::CreateFromTransformedBox( meshObject.mesh->getBoundingBox(), meshObject.transform_localToWorld );
+	}
+
+	// The visible entries are moved to the front of the vector (keeping their order)
+	size_t visibleCount = 0;
+	for ( size_t i = 0; i < entryCount; i += boxesPerTest )
+	{
+#if defined( __AVX__ )
+		uint32_t visibleMask = Math::Overlaps8( m_frustum, &m_boxes_world[i] );
+#else
+		uint32_t visibleMask = Math::Overlaps4( m_frustum, &m_boxes_world[i] );
+#endif
+		if ( ( i + boxesPerTest ) > entryCount )
+		{
+			visibleMask &= ( 1u << ( entryCount - i ) ) - 1;
+		}
+		for ( size_t j = 0; j < boxesPerTest; ++j )
+		{
+			if ( visibleMask & ( 1u << j ) )
+			{
+				m_entries[visibleCount++] = m_entries[i + j];
+			}
+		}
+	}
+	m_entries.resize( visibleCount );
+}
+
+void eae6320::Graphics::cRenderQueue::SelectLods()
+{
+	for ( sEntry& entry : m_entries )
+	{
+		const MeshObject& meshObject = *entry.meshObject;
+		const uint32_t lodCount = meshObject.mesh->getLodCount();
+		if ( lodCount < 2 )
+		{
+			entry.lod = 0;
+			continue;
+		}
+
+		// The size on screen is approximated by dividing the sphere's radius by the depth of its center
+		// (which is clamped to the near plane so that the size doesn't go to infinity when the camera is inside of the sphere)
+		float screenSize;
+		{
+			const Math::sSphere& sphere = meshObject.mesh->getBoundingSphere();
+			const Math::cVector center_world = meshObject.transform_localToWorld.TransformPoint( sphere.m_center );
+			const Math::cVector center_camera = m_transform_worldToCamera.TransformPoint( center_world );
+			// The camera looks down the negative Z axis
+			const float depth = std::max( -center_camera.z, m_nearPlane );
+			// The diameter is the radius times two, but the screen's height is also two
+			screenSize = ( sphere.m_radius * m_screenSizeScale ) / depth;
+		}
+
+		// The object starts at the LOD it used last frame (if it is known)
+		// and only moves past a threshold if it is far enough past it
+		uint32_t lod = meshObject.previousLod ? std::min( *meshObject.previousLod, lodCount - 1 ) : 0;
+		while ( ( lod < ( lodCount - 1 ) ) && ( screenSize < ( s_lodScreenSizes[lod] * ( 1.0f - s_lodHysteresis ) ) ) )
+		{
+			++lod;
+		}
+		while ( ( lod > 0 ) && ( screenSize > ( s_lodScreenSizes[lod - 1] * ( 1.0f + s_lodHysteresis ) ) ) )
+		{
+			--lod;
+		}
+		entry.lod = lod;
+		if ( meshObject.previousLod )
+		{
+			*meshObject.previousLod = lod;
+		}
+	}
+}
+
+uint64_t eae6320::Graphics::cRenderQueue::CalculateKey( const sEntry& i_entry ) const
+{
+	const MeshObject& meshObject = *i_entry.meshObject;
+	const cEffect* const effect = meshObject.material->GetEffect();
+	const bool isTranslucent = effect && effect->IsTranslucent();
+
+	// The depth of the object's origin is used,
+	// mapped from the near plane to the far plane as [0, 1]
+	uint32_t depth;
+	{
+		const Math::cVector position_world = meshObject.transform_localToWorld.TransformPoint( Math::cVector() );
+		const Math::cVector position_camera = m_transform_worldToCamera.TransformPoint( position_world );
+		// The camera looks down the negative Z axis
+		const float depth_normalized = std::min( std::max( ( -position_camera.z - m_nearPlane ) * m_depthScale, 0.0f ), 1.0f );
+		const uint32_t maxDepth = ( uint32_t( 1 ) << s_depthBitCount ) - 1;
+		depth = static_cast<uint32_t>( depth_normalized * static_cast<float>( maxDepth ) );
+		// Translucent meshes are drawn back-to-front and opaque meshes front-to-back
+		if ( isTranslucent )
+		{
+			depth = maxDepth - depth;
+		}
+	}
+	const uint32_t effectId = effect ? effect->GetSortId() : 0;
+	const uint32_t materialId = meshObject.material->GetSortId();
+	// The LOD is part of the mesh's ID so that the instances of each LOD are next to each other
+	const uint32_t meshId = ( meshObject.mesh->getSortId() * Mesh::MAX_LOD_COUNT ) + i_entry.lod;
+
+	const uint64_t key = MakeField( static_cast<uint32_t>( meshObject.pass ), s_passBitCount, s_passShift )
+		| MakeField( isTranslucent ? 1 : 0, s_translucencyBitCount, s_translucencyShift );
+	if ( isTranslucent )
+	{
+		return key
+			| MakeField( depth, s_depthBitCount, Translucent::s_depthShift )
+			| MakeField( effectId, s_effectBitCount, Translucent::s_effectShift )
+			| MakeField( materialId, s_materialBitCount, Translucent::s_materialShift )
+			| MakeField( meshId, s_meshBitCount, Translucent::s_meshShift );
+	}
+	else
+	{
+		return key
+			| MakeField( effectId, s_effectBitCount, Opaque::s_effectShift )
+			| MakeField( materialId, s_materialBitCount, Opaque::s_materialShift )
+			| MakeField( meshId, s_meshBitCount, Opaque::s_meshShift )
+			| MakeField( depth, s_depthBitCount, Opaque::s_depthShift );
+	}
+}
+
+void eae6320::Graphics::cRenderQueue::SortEntries()
+{
+	const size_t entryCount = m_entries.size();
+	if ( entryCount < 2 )
+	{
+		return;
+	}
+	m_entries_scratch.resize( entryCount );
+
+	// The histograms of every digit are counted in a single pass
+	uint32_t histograms[s_digitCount][s_radixCount] = {};
+	for ( const sEntry& entry : m_entries )
+	{
+		for ( unsigned int i = 0; i < s_digitCount; ++i )
+		{
+			++histograms[i][( entry.key >> ( i * s_radixBitCount ) ) & ( s_radixCount - 1 )];
+		}
+	}
+
+	sEntry* source = m_entries.data();
+	sEntry* destination = m_entries_scratch.data();
+	for ( unsigned int i = 0; i < s_digitCount; ++i )
+	{
+		const unsigned int shift = i * s_radixBitCount;
+		uint32_t* const histogram = histograms[i];
+		// If every key has the same value for this digit then sorting by it wouldn't change anything
+		// (this is common for the most significant digits)
+		if ( histogram[( source[0].key >> shift ) & ( s_radixCount - 1 )] == entryCount )
+		{
+			continue;
+		}
+		// Convert the counts into the index where each value's first entry goes
+		uint32_t offset = 0;
+		for ( unsigned int j = 0; j < s_radixCount; ++j )
+		{
+			const uint32_t count = histogram[j];
+			histogram[j] = offset;
+			offset += count;
+		}
+		for ( size_t j = 0; j < entryCount; ++j )
+		{
+			const sEntry& entry = source[j];
+			destination[histogram[( entry.key >> shift ) & ( s_radixCount - 1 )]++] = entry;
+		}
+		std::swap( source, destination );
+	}
+	if ( source != m_entries.data() )
+	{
+		m_entries.swap( m_entries_scratch );
+	}
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	uint64_t MakeField( const uint32_t i_value, const unsigned int i_bitCount, const unsigned int i_shift )
+	{
+		return ( static_cast<uint64_t>( i_value ) & ( ( uint64_t( 1 ) << i_bitCount ) - 1 ) ) << i_shift;
+	}
+}
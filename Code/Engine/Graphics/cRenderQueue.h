@@ -0,0 +1,125 @@
+/*
+	A render queue collects everything that will be drawn in a frame
+	and sorts it so that the draws that share state are drawn together
+
+	Each submitted mesh gets a 64-bit key, from the most significant bits to the least:
+		* Pass (2 bits)
+		* Translucency (1 bit)
+		* Translucent meshes:
+			* Depth (16 bits)
+			* Effect (10 bits)
+			* Material (14 bits)
+			* Mesh and LOD (21 bits)
+		* Opaque meshes:
+			* Effect (10 bits)
+			* Material (14 bits)
+			* Mesh and LOD (21 bits)
+			* Depth (16 bits)
+	Translucent meshes use the (inverted) depth first so that they are blended back-to-front.
+	Opaque meshes are grouped by effect, material, and mesh first
+	so that every opaque mesh that shares a mesh and a material is next to the others
+	and can be drawn with a single instanced draw call;
+	the depth then orders the instances front-to-back (which lets the depth test reject hidden fragments).
+
+	Before anything is sorted every mesh object's bounding box is tested against the camera's frustum
+	(eight at a time with AVX and four at a time otherwise)
+	and the ones that can't be seen are removed from the queue.
+	Each remaining mesh object then chooses a level of detail
+	based on how large its bounding sphere is on screen
+	(a different LOD of the same mesh is a different draw call).
+*/
+
+#ifndef EAE6320_GRAPHICS_CRENDERQUEUE_H
+#define EAE6320_GRAPHICS_CRENDERQUEUE_H
+
+// Header Files
+//=============
+
+#include <cstdint>
+#include <vector>
+#include "Graphics.h"
+#include "../Math/BoundingVolumes.h"
+#include "../Math/cMatrix_transformation.h"
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+	namespace Graphics
+	{
+		class cRenderQueue
+		{
+			// Interface
+			//==========
+
+		public:
+
+			// The camera is used to cull the meshes, choose their LODs, and calculate their depths when the queue is drawn
+			void SetCamera( const Math::cMatrix_transformation& i_transform_worldToCamera, const Math::cMatrix_transformation& i_transform_cameraToScreen,
+				const float i_nearPlane, const float i_farPlane );
+			// The mesh object is only referenced,
+			// and so it must stay valid until the queue has been drawn
+			// (the mesh objects in a frame packet stay in its arena until the packet is reset)
+			void Submit( const MeshObject& i_meshObject );
+			// Draws everything that was submitted and is in the camera's frustum in sorted order and then empties the queue.
+			// Consecutive meshes with the same mesh and material are drawn as instances of a single draw call.
+			// The draw call constant buffer must be a ring buffer:
+			// every draw call's transforms are written into it at once
+			// and then each draw call binds its own range.
+			void Draw( ConstantBufferDataManager& io_drawCallConstantBuffer );
+
+			// These are the statistics of the most recent call to Draw()
+			const sRenderStatistics& GetStatistics() const { return m_statistics; }
+
+			// Data
+			//=====
+
+		private:
+
+			struct sEntry
+			{
+				uint64_t key;
+				const MeshObject* meshObject;
+				uint32_t lod;
+			};
+			struct sBatch
+			{
+				// The index of the batch's first entry
+				uint32_t firstEntry;
+				uint32_t instanceCount;
+				// Where the batch's transforms are in the draw call constant buffer
+				size_t constantsOffset;
+			};
+
+			// The entries are sorted rather than the mesh objects themselves because they are much smaller
+			std::vector<sEntry> m_entries;
+			std::vector<sEntry> m_entries_scratch;
+			std::vector<sBatch> m_batches;
+			// The world-space bounding box of every entry
+			// (padded to a multiple of the number of boxes that are tested at once)
+			std::vector<Math::sAABB> m_boxes_world;
+			Math::sFrustum m_frustum;
+			Math::cMatrix_transformation m_transform_worldToCamera;
+			// This converts a radius divided by a depth into a fraction of the screen's height
+			float m_screenSizeScale = 0.0f;
+			float m_nearPlane = 0.0f;
+			float m_depthScale = 0.0f;
+			sRenderStatistics m_statistics = {};
+
+			// Implementation
+			//===============
+
+		private:
+
+			// Removes every entry whose bounding box is outside of the frustum
+			void CullEntries();
+			void SelectLods();
+			uint64_t CalculateKey( const sEntry& i_entry ) const;
+			// A least-significant-digit radix sort that uses 8 bits per digit
+			void SortEntries();
+		};
+	}
+}
+
+#endif	// EAE6320_GRAPHICS_CRENDERQUEUE_H
@@ -0,0 +1,107 @@
+// Header Files
+//=============
+
+#include "cRingBufferAllocator.h"
+
+#include "../Asserts/Asserts.h"
+
+// Interface
+//==========
+
+// Allocation
+//-----------
+
+bool eae6320::Graphics::cRingBufferAllocator::Allocate( const size_t i_size, size_t& o_offset )
+{
+	EAE6320_ASSERT( m_size > 0 );
+	const size_t alignedSize = ( i_size + ( m_alignment - 1 ) ) & ~( m_alignment - 1 );
+	if ( ( alignedSize == 0 ) || ( alignedSize > m_size ) )
+	{
+		return false;
+	}
+	// When nothing is in use there's no reason to skip any memory at the end
+	if ( m_usedSize == 0 )
+	{
+		m_head = 0;
+	}
+	// If the range doesn't fit before the end of the buffer
+	// the memory at the end is skipped and the range starts at the beginning
+	size_t offset = m_head;
+	size_t skippedSize = 0;
+	if ( ( m_head + alignedSize ) > m_size )
+	{
+		offset = 0;
+		skippedSize = m_size - m_head;
+	}
+	const size_t requiredSize = skippedSize + alignedSize;
+	if ( ( m_usedSize + requiredSize ) > m_size )
+	{
+		return false;
+	}
+	m_head = offset + alignedSize;
+	if ( m_head == m_size )
+	{
+		m_head = 0;
+	}
+	m_usedSize += requiredSize;
+	m_currentFrameSize += requiredSize;
+	o_offset = offset;
+	return true;
+}
+
+// Frames
+//-------
+
+void eae6320::Graphics::cRingBufferAllocator::EndFrame()
+{
+	EAE6320_ASSERT( CanEndFrame() );
+	const unsigned int newestFrame = ( m_oldestInFlightFrame + m_inFlightFrameCount ) % s_maxFrameCount;
+	m_inFlightFrameSizes[newestFrame] = m_currentFrameSize;
+	++m_inFlightFrameCount;
+	m_currentFrameSize = 0;
+}
+
+void eae6320::Graphics::cRingBufferAllocator::ReleaseOldestFrame()
+{
+	EAE6320_ASSERT( m_inFlightFrameCount > 0 );
+	const size_t frameSize = m_inFlightFrameSizes[m_oldestInFlightFrame];
+	EAE6320_ASSERT( frameSize <= m_usedSize );
+	m_usedSize -= frameSize;
+	m_inFlightFrameSizes[m_oldestInFlightFrame] = 0;
+	m_oldestInFlightFrame = ( m_oldestInFlightFrame + 1 ) % s_maxFrameCount;
+	--m_inFlightFrameCount;
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+bool eae6320::Graphics::cRingBufferAllocator::Initialize( const size_t i_size, const size_t i_alignment )
+{
+	if ( ( i_alignment == 0 ) || ( ( i_alignment & ( i_alignment - 1 ) ) != 0 ) )
+	{
+		EAE6320_ASSERTF( false, "A ring buffer's alignment must be a power of two" );
+		return false;
+	}
+	if ( i_size < i_alignment )
+	{
+		EAE6320_ASSERTF( false, "A ring buffer must be able to hold at least one allocation" );
+		return false;
+	}
+	m_size = i_size;
+	m_alignment = i_alignment;
+	Reset();
+	return true;
+}
+
+void eae6320::Graphics::cRingBufferAllocator::Reset()
+{
+	m_head = 0;
+	m_usedSize = 0;
+	m_currentFrameSize = 0;
+	for ( unsigned int i = 0; i < s_maxFrameCount; ++i )
+	{
+		m_inFlightFrameSizes[i] = 0;
+	}
+	m_oldestInFlightFrame = 0;
+	m_inFlightFrameCount = 0;
+}
@@ -0,0 +1,100 @@
+/*
+	A ring buffer allocator hands out ranges of a fixed-size buffer
+	that the CPU writes every frame and the GPU reads some time later
+
+	It only keeps track of offsets and doesn't own any memory
+	(the platform-specific code owns the actual buffer and the fences),
+	and so it can be used (and tested) without a GPU.
+
+	Every allocation is made in the current frame.
+	When a frame ends its allocations stay "in flight"
+	until the GPU has finished with them (i.e. its fence has been signaled),
+	at which point ReleaseOldestFrame() must be called to make the memory available again.
+*/
+
+#ifndef EAE6320_GRAPHICS_CRINGBUFFERALLOCATOR_H
+#define EAE6320_GRAPHICS_CRINGBUFFERALLOCATOR_H
+
+// Header Files
+//=============
+
+#include <cstddef>
+#include <cstdint>
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+	namespace Graphics
+	{
+		class cRingBufferAllocator
+		{
+			// Interface
+			//==========
+
+		public:
+
+			// The number of frames that can be in flight at once
+			static const unsigned int s_maxFrameCount = 4;
+
+			// Allocation
+			//-----------
+
+			// Returns false if there isn't enough free memory
+			// (in which case the caller should wait for the oldest frame's fence and call ReleaseOldestFrame()).
+			// A range is never split between the end and the beginning of the buffer.
+			bool Allocate( const size_t i_size, size_t& o_offset );
+
+			// Frames
+			//-------
+
+			// Returns false if there are already s_maxFrameCount frames in flight
+			// (in which case the caller should wait for the oldest frame's fence and call ReleaseOldestFrame())
+			bool CanEndFrame() const { return m_inFlightFrameCount < s_maxFrameCount; }
+			void EndFrame();
+			// This must only be called when the GPU has finished reading the oldest frame's allocations
+			void ReleaseOldestFrame();
+			unsigned int GetInFlightFrameCount() const { return m_inFlightFrameCount; }
+			// These return indices in [0, s_maxFrameCount)
+			// so that per-frame data (like fences) can be kept in a parallel array
+			unsigned int GetOldestInFlightFrameIndex() const { return m_oldestInFlightFrame; }
+			unsigned int GetNewestInFlightFrameIndex() const { return ( m_oldestInFlightFrame + m_inFlightFrameCount + s_maxFrameCount - 1 ) % s_maxFrameCount; }
+
+			// Access
+			//-------
+
+			size_t GetSize() const { return m_size; }
+			// This includes the current frame's allocations and any in-flight frames
+			size_t GetUsedSize() const { return m_usedSize; }
+			size_t GetAlignment() const { return m_alignment; }
+
+			// Initialization / Clean Up
+			//--------------------------
+
+			// The alignment must be a power of two
+			// (every offset that is returned will be a multiple of it)
+			bool Initialize( const size_t i_size, const size_t i_alignment );
+			void Reset();
+
+			// Data
+			//=====
+
+		private:
+
+			size_t m_size = 0;
+			size_t m_alignment = 1;
+			// Where the next allocation will be made
+			size_t m_head = 0;
+			size_t m_usedSize = 0;
+			// This includes any memory at the end of the buffer that was skipped when an allocation wrapped around
+			size_t m_currentFrameSize = 0;
+			// A circular queue of the sizes of the frames that are in flight
+			size_t m_inFlightFrameSizes[s_maxFrameCount] = {};
+			unsigned int m_oldestInFlightFrame = 0;
+			unsigned int m_inFlightFrameCount = 0;
+		};
+	}
+}
+
+#endif	// EAE6320_GRAPHICS_CRINGBUFFERALLOCATOR_H
@@ -3,9 +3,32 @@
 
 #include "cSprite.h"
 
+#include "../Asserts/Asserts.h"
+
 // Interface
 //==========
 
+// Texture Atlases
+//----------------
+
+eae6320::Graphics::cSprite::sRectangle eae6320::Graphics::cSprite::GetTextureCoordinates( const unsigned int i_texel_left, const unsigned int i_texel_top,
+	const unsigned int i_width, const unsigned int i_height,
+	const unsigned int i_atlasWidth, const unsigned int i_atlasHeight )
+{
+	EAE6320_ASSERT( ( i_atlasWidth > 0 ) && ( i_atlasHeight > 0 ) );
+	EAE6320_ASSERT( ( ( i_texel_left + i_width ) <= i_atlasWidth ) && ( ( i_texel_top + i_height ) <= i_atlasHeight ) );
+	// The texture coordinates are on the edges of the texels,
+	// and so the sprite shows exactly the given texels when it is drawn at the same size
+	// (any filtering past the edges reads the gutter that the atlas builder puts around each image)
+	sRectangle textureCoordinates;
+	textureCoordinates.left = static_cast<float>( i_texel_left ) / static_cast<float>( i_atlasWidth );
+	textureCoordinates.right = static_cast<float>( i_texel_left + i_width ) / static_cast<float>( i_atlasWidth );
+	// OpenGL-style texture coordinates have the first row of the image at the bottom
+	textureCoordinates.top = 1.0f - ( static_cast<float>( i_texel_top ) / static_cast<float>( i_atlasHeight ) );
+	textureCoordinates.bottom = 1.0f - ( static_cast<float>( i_texel_top + i_height ) / static_cast<float>( i_atlasHeight ) );
+	return textureCoordinates;
+}
+
 // Initialization / Clean Up
 //--------------------------
 
@@ -21,4 +44,57 @@ eae6320::Graphics::cSprite::cSprite( const float i_position_left, const float i_
 	m_textureCoordinates.right = i_texcoord_right;
 	m_textureCoordinates.top = i_texcoord_top;
 	m_textureCoordinates.bottom = i_texcoord_bottom;
+
+	GenerateVertices();
+}
+
+eae6320::Graphics::cSprite::cSprite( const sRectangle& i_position_screen, const sRectangle& i_textureCoordinates )
+	:
+	m_position_screen( i_position_screen ), m_textureCoordinates( i_textureCoordinates )
+{
+	GenerateVertices();
+}
+
+// Implementation
+//===============
+
+void eae6320::Graphics::cSprite::GenerateVertices()
+{
+	// Lower Left
+	{
+		sVertex& vertex = m_vertexData[0];
+		vertex.x = m_position_screen.left;
+		vertex.y = m_position_screen.bottom;
+		vertex.u = m_textureCoordinates.left;
+		vertex.v = m_textureCoordinates.bottom;
+	}
+	// Lower Right
+	{
+		sVertex& vertex = m_vertexData[1];
+		vertex.x = m_position_screen.right;
+		vertex.y = m_position_screen.bottom;
+		vertex.u = m_textureCoordinates.right;
+		vertex.v = m_textureCoordinates.bottom;
+	}
+	// Upper Left
+	{
+		sVertex& vertex = m_vertexData[2];
+		vertex.x = m_position_screen.left;
+		vertex.y = m_position_screen.top;
+		vertex.u = m_textureCoordinates.left;
+		vertex.v = m_textureCoordinates.top;
+	}
+	// Upper Right
+	{
+		sVertex& vertex = m_vertexData[3];
+		vertex.x = m_position_screen.right;
+		vertex.y = m_position_screen.top;
+		vertex.u = m_textureCoordinates.right;
+		vertex.v = m_textureCoordinates.top;
+	}
+	for ( sVertex& vertex : m_vertexData )
+	{
+		vertex.z = -1.0f;
+		vertex.red = vertex.green = vertex.blue = vertex.alpha = 255;
+	}
 }
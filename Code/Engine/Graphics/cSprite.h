@@ -11,10 +11,7 @@
 #include "Configuration.h"
 
 #include <cstdint>
-
-#ifdef EAE6320_PLATFORM_GL
-	#include "OpenGL/Includes.h"
-#endif
+#include "VertexData.h"
 
 // Forward Declarations
 //=====================
@@ -37,9 +34,35 @@ namespace eae6320
 
 		public:
 
+			// Positions are on the screen:
+			//	left = -1, right = 1, top = 1, bottom = -1
+			// and texture coordinates are OpenGL-style:
+			//	left = 0, right = 1, top = 1, bottom = 0
+			struct sRectangle
+			{
+				float left, right, top, bottom;
+			};
+
+			// Texture Atlases
+			//----------------
+
+			// Many sprites can share a single texture (and so a single material and draw call)
+			// by each using a different part of it.
+			// The part is given in texels with (0,0) at the top left of the image
+			// (which is how images and the atlas builder's tables are laid out),
+			// and the returned texture coordinates are OpenGL-style.
+			static sRectangle GetTextureCoordinates( const unsigned int i_texel_left, const unsigned int i_texel_top,
+				const unsigned int i_width, const unsigned int i_height,
+				const unsigned int i_atlasWidth, const unsigned int i_atlasHeight );
+
 			// Render
 			//-------
 
+			// Sprites are drawn by adding these to a cSpriteBatch
+			// (lower left, lower right, upper left, upper right)
+			const sVertex* GetVertexData() const { return m_vertexData; }
+
+#if defined( EAE6320_PLATFORM_D3D )
 			void Draw() const;
 
 			// Initialization / Clean Up
@@ -47,9 +70,11 @@ namespace eae6320
 
 			static bool Initialize();
 			static bool CleanUp();
+#endif
 
 			cSprite( const float i_position_left, const float i_position_right, const float i_position_top, const float i_position_bottom,
 				const float i_texcoord_left, const float i_texcoord_right, const float i_texcoord_top, const float i_texcoord_bottom );
+			cSprite( const sRectangle& i_position_screen, const sRectangle& i_textureCoordinates );
 
 			// Data
 			//=====
@@ -58,34 +83,24 @@ namespace eae6320
 
 			// The positions and texture coordinates are stored as a quad
 			// (meaning that only rectangular sprites can be made),
-			// and are converted into an sVertex when the draw call is made
-			struct
-			{
-				// Left of screen = -1
-				// Right of screen = 1
-				// Top of screen = 1
-				// Bottom of screen = -1
-				float left, right, top, bottom;
-			} m_position_screen;
-			struct
-			{
-				// Left of texture = 0
-				// Right of texture = 1
-				// Top of texture = 1 (OpenGL-style)
-				// Bottom of texture = 0 (OpenGL-style)
-				float left, right, top, bottom;
-			} m_textureCoordinates;
+			// and are converted into vertices when the sprite is made
+			sRectangle m_position_screen;
+			sRectangle m_textureCoordinates;
+			sVertex m_vertexData[4];
 
+#if defined( EAE6320_PLATFORM_D3D )
 			// A single dynamic vertex buffer is created for _all_ sprites,
 			// and its contents are changed every draw call
-#if defined( EAE6320_PLATFORM_D3D )
 			// A vertex buffer holds the data for each vertex
 			static ID3D11Buffer* ms_vertexBuffer;
-#elif defined( EAE6320_PLATFORM_GL )
-			// A vertex array encapsulates the vertex data and the vertex input layout
-			static GLuint ms_vertexArrayId;
-			static GLuint ms_vertexBufferId;
 #endif
+
+			// Implementation
+			//===============
+
+		private:
+
+			void GenerateVertices();
 		};
 	}
 }
@@ -0,0 +1,111 @@
+// Header Files
+//=============
+
+#include "cSpriteBatch.h"
+
+#include <algorithm>
+#include <cstring>
+#include "cMaterial.h"
+#include "../Asserts/Asserts.h"
+#include "../Logging/Logging.h"
+
+// Interface
+//==========
+
+// Render
+//-------
+
+void eae6320::Graphics::cSpriteBatch::Add( const cMaterial& i_material, const sVertex* const i_vertexData, const size_t i_quadCount )
+{
+	if ( i_quadCount == 0 )
+	{
+		return;
+	}
+	const size_t firstQuad = m_vertexData_added.size() / 4;
+	if ( ( firstQuad + i_quadCount ) > s_maxQuadCount )
+	{
+		EAE6320_ASSERTF( false, "A frame can't draw more than %u sprites and characters", static_cast<unsigned int>( s_maxQuadCount ) );
+		Logging::OutputError( "%u sprites and characters were drawn and the rest of them weren't", static_cast<unsigned int>( firstQuad ) );
+		return;
+	}
+	const sGroup group = { &i_material, static_cast<uint32_t>( m_groups.size() ),
+		static_cast<uint32_t>( firstQuad ), static_cast<uint32_t>( i_quadCount ) };
+	m_groups.push_back( group );
+	m_vertexData_added.insert( m_vertexData_added.end(), i_vertexData, i_vertexData + ( i_quadCount * 4 ) );
+}
+
+uint32_t eae6320::Graphics::cSpriteBatch::Draw()
+{
+	if ( m_groups.empty() )
+	{
+		return 0;
+	}
+
+	// Groups with the same material are put next to each other
+	// (std::sort() is used instead of std::stable_sort() because it doesn't allocate a temporary buffer)
+	std::sort( m_groups.begin(), m_groups.end(),
+		[]( const sGroup& i_lhs, const sGroup& i_rhs )
+		{
+			const uint32_t sortId_lhs = i_lhs.material->GetSortId(), sortId_rhs = i_rhs.material->GetSortId();
+			return ( sortId_lhs != sortId_rhs ) ? ( sortId_lhs < sortId_rhs ) : ( i_lhs.submissionIndex < i_rhs.submissionIndex );
+		} );
+	const size_t quadCount_total = m_vertexData_added.size() / 4;
+	m_vertexData_sorted.resize( m_vertexData_added.size() );
+	{
+		size_t quadCount = 0;
+		for ( const sGroup& group : m_groups )
+		{
+			std::memcpy( &m_vertexData_sorted[quadCount * 4], &m_vertexData_added[group.firstQuad * 4], group.quadCount * 4 * sizeof( sVertex ) );
+			quadCount += group.quadCount;
+		}
+	}
+	UpdateBuffers( quadCount_total );
+
+	// Every material is bound once and draws all of its quads
+	uint32_t drawCount = 0;
+	{
+		const cMaterial* previousMaterial = NULL;
+		size_t firstQuad = 0, quadCount = 0;
+		for ( const sGroup& group : m_groups )
+		{
+			if ( group.material != previousMaterial )
+			{
+				if ( quadCount > 0 )
+				{
+					DrawQuads( firstQuad, quadCount );
+					++drawCount;
+				}
+				group.material->Bind( previousMaterial );
+				previousMaterial = group.material;
+				firstQuad += quadCount;
+				quadCount = 0;
+			}
+			quadCount += group.quadCount;
+		}
+		DrawQuads( firstQuad, quadCount );
+		++drawCount;
+	}
+
+	// The memory is kept for the next frame
+	m_groups.clear();
+	m_vertexData_added.clear();
+	return drawCount;
+}
+
+// Implementation
+//===============
+
+const uint16_t* eae6320::Graphics::cSpriteBatch::GetIndexData( const size_t i_quadCount )
+{
+	EAE6320_ASSERT( i_quadCount <= s_maxQuadCount );
+	for ( size_t i = ( m_indexData.size() / 6 ); i < i_quadCount; ++i )
+	{
+		const uint16_t firstVertex = static_cast<uint16_t>( i * 4 );
+		const uint16_t quadIndices[] = { 0, 1, 2, 3, 2, 1 };
+		for ( const uint16_t quadIndex : quadIndices )
+		{
+			m_indexData.push_back( static_cast<uint16_t>( firstVertex + quadIndex ) );
+		}
+	}
+	return &m_indexData[0];
+}
@@ -0,0 +1,132 @@
+/*
+	A sprite batch collects every textured quad that will be drawn in 2D in a frame
+	(sprites and the characters of text)
+	and draws all of the quads that share a material with a single draw call
+
+	Every quad is 4 vertices (lower left, lower right, upper left, upper right),
+	and all of the quads are copied into a single dynamic vertex buffer.
+	The vertex buffer and the memory that the quads are collected in are kept between frames
+	and only grow when a frame has more quads than any before it,
+	and so nothing is allocated in a frame that doesn't.
+	Every quad uses the same 6 indices (offset by its first vertex),
+	and so the index buffer only changes when it needs to hold more quads.
+
+	Quads are grouped by material,
+	and the quads of each material are drawn in the order that they were added.
+	Quads with different materials aren't drawn in the order that they were added, though,
+	and so anything that needs to be drawn on top of something else
+	should use the same material (e.g. by putting both images in the same texture atlas).
+*/
+
+#ifndef EAE6320_GRAPHICS_CSPRITEBATCH_H
+#define EAE6320_GRAPHICS_CSPRITEBATCH_H
+
+// Header Files
+//=============
+
+#include "Configuration.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "VertexData.h"
+
+#ifdef EAE6320_PLATFORM_GL
+	#include "OpenGL/Includes.h"
+#endif
+
+// Forward Declarations
+//=====================
+
+namespace eae6320
+{
+	namespace Graphics
+	{
+		class cMaterial;
+	}
+}
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+	namespace Graphics
+	{
+		class cSpriteBatch
+		{
+			// Interface
+			//==========
+
+		public:
+
+			// The indices are 16 bit, and so a single frame can't draw more than this many quads
+			static const size_t s_maxQuadCount = 0x10000 / 4;
+
+			// Render
+			//-------
+
+			// The vertices are copied
+			// (there must be 4 for every quad)
+			void Add( const cMaterial& i_material, const sVertex* const i_vertexData, const size_t i_quadCount );
+			// Draws everything that was added and then empties the batch
+			// (returns how many draw calls were made)
+			uint32_t Draw();
+
+			// Initialization / Clean Up
+			//--------------------------
+
+			bool Initialize();
+			bool CleanUp();
+
+			// Data
+			//=====
+
+		private:
+
+			// Everything that is added at once is kept together
+			struct sGroup
+			{
+				const cMaterial* material;
+				// Groups with the same material are drawn in the order that they were added
+				uint32_t submissionIndex;
+				uint32_t firstQuad;
+				uint32_t quadCount;
+			};
+			std::vector<sGroup> m_groups;
+			// The vertices are stored in the order that they were added
+			// and then copied in the order that they will be drawn
+			std::vector<sVertex> m_vertexData_added;
+			std::vector<sVertex> m_vertexData_sorted;
+			std::vector<uint16_t> m_indexData;
+
+#if defined( EAE6320_PLATFORM_GL )
+			// A vertex array encapsulates the vertex data and the vertex input layout
+			GLuint m_vertexArrayId = 0;
+			GLuint m_vertexBufferId = 0;
+			GLuint m_indexBufferId = 0;
+			// This is how many quads the buffers have room for
+			size_t m_vertexBufferQuadCount = 0;
+			size_t m_indexBufferQuadCount = 0;
+#elif defined( EAE6320_PLATFORM_NULL )
+			uint32_t m_vertexBufferId = 0;
+			uint32_t m_indexBufferId = 0;
+			size_t m_indexBufferQuadCount = 0;
+#endif
+
+			// Implementation
+			//===============
+
+		private:
+
+			// Makes sure that the indices for this many quads have been generated
+			const uint16_t* GetIndexData( const size_t i_quadCount );
+
+			// These are platform-specific
+			void UpdateBuffers( const size_t i_quadCount );
+			void DrawQuads( const size_t i_firstQuad, const size_t i_quadCount );
+		};
+	}
+}
+
+#endif	// EAE6320_GRAPHICS_CSPRITEBATCH_H
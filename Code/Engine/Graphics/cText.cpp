@@ -1,12 +1,126 @@
 #include "cText.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include "VertexData.h"
+#include "../Asserts/Asserts.h"
+#include "../UserSettings/UserSettings.h"
+
 eae6320::Graphics::cText::sFont* eae6320::Graphics::cText::m_Font = new cText::sFont[95];
 
-eae6320::Graphics::cText::cText(char * text, int x, int y)
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	// These write to a buffer that has room for cText::s_maxCharacterCount characters
+	// and cut off anything that doesn't fit
+	void AppendString(const char* const i_string, char* const io_text, size_t& io_length);
+	void AppendInteger(const uint64_t i_integer, const unsigned int i_minDigitCount, char* const io_text, size_t& io_length);
+}
+
+eae6320::Graphics::cText::cText(const char* const i_text, const int i_x, const int i_y)
+{
+	m_text[0] = '\0';
+	m_x = static_cast<int16_t>(i_x);
+	m_y = static_cast<int16_t>(i_y);
+	SetText(i_text);
+}
+
+bool eae6320::Graphics::cText::SetText(const char* const i_text)
+{
+	// The new text is built separately so that it can be compared with the current text
+	char text[s_maxCharacterCount + 1];
+	size_t characterCount = 0;
+	for (; (i_text[characterCount] != '\0') && (characterCount < s_maxCharacterCount); ++characterCount)
+	{
+		// The font only has the printable ASCII characters
+		const char character = i_text[characterCount];
+		text[characterCount] = ((character >= ' ') && (character <= '~')) ? character : '?';
+	}
+	text[characterCount] = '\0';
+	EAE6320_ASSERTF(i_text[characterCount] == '\0', "Text can't be longer than %u characters", static_cast<unsigned int>(s_maxCharacterCount));
+
+	if (std::strcmp(text, m_text) == 0)
+	{
+		return false;
+	}
+	std::memcpy(m_text, text, characterCount + 1);
+	m_characterCount = characterCount;
+	GenerateGeometry();
+	return true;
+}
+
+bool eae6320::Graphics::cText::SetNumber(const int i_number, const char* const i_prefix)
 {
-	m_text = text;
-	m_x = x;
-	m_y = y;
+	char text[s_maxCharacterCount + 1];
+	size_t length = 0;
+	AppendString(i_prefix, text, length);
+	if (i_number < 0)
+	{
+		AppendString("-", text, length);
+	}
+	// The magnitude is calculated with 64 bits so that the most negative integer doesn't overflow
+	AppendInteger(static_cast<uint64_t>(std::abs(static_cast<int64_t>(i_number))), 1, text, length);
+	text[length] = '\0';
+	return SetText(text);
+}
+
+bool eae6320::Graphics::cText::SetNumber(const float i_number, const unsigned int i_decimalCount, const char* const i_prefix)
+{
+	char text[s_maxCharacterCount + 1];
+	size_t length = 0;
+	AppendString(i_prefix, text, length);
+	if (std::isnan(i_number))
+	{
+		AppendString("NaN", text, length);
+	}
+	else
+	{
+		if (std::signbit(i_number))
+		{
+			AppendString("-", text, length);
+		}
+		// The number is rounded to the last decimal that is shown
+		// (and so e.g. 0.96 with 1 decimal is shown as 1.0)
+		const unsigned int decimalCount = std::min(i_decimalCount, 9u);
+		uint64_t decimalMultiplier = 1;
+		for (unsigned int i = 0; i < decimalCount; ++i)
+		{
+			decimalMultiplier *= 10;
+		}
+		const double number_scaled = std::floor((std::abs(static_cast<double>(i_number)) * decimalMultiplier) + 0.5);
+		// Numbers that are too big to be rounded with 64 bits are shown the same as infinity
+		if (!(number_scaled < 1.8e19))
+		{
+			AppendString("Infinity", text, length);
+		}
+		else
+		{
+			const uint64_t number_rounded = static_cast<uint64_t>(number_scaled);
+			AppendInteger(number_rounded / decimalMultiplier, 1, text, length);
+			if (decimalCount > 0)
+			{
+				AppendString(".", text, length);
+				AppendInteger(number_rounded % decimalMultiplier, decimalCount, text, length);
+			}
+		}
+	}
+	text[length] = '\0';
+	return SetText(text);
+}
+
+bool eae6320::Graphics::cText::SetPosition(const int i_x, const int i_y)
+{
+	if ((i_x == m_x) && (i_y == m_y))
+	{
+		return false;
+	}
+	m_x = static_cast<int16_t>(i_x);
+	m_y = static_cast<int16_t>(i_y);
+	GenerateGeometry();
+	return true;
 }
 
 bool eae6320::Graphics::cText::LoadFontData(char* filename)
@@ -44,4 +158,80 @@ bool eae6320::Graphics::cText::LoadFontData(char* filename)
 	}
 	inputStream.close();
 	return true;
-}
\ No newline at end of file
+}
+
+void eae6320::Graphics::cText::GenerateGeometry()
+{
+	const size_t length = m_characterCount;
+
+	const float widthMultiplier = 2.0f / UserSettings::GetResolutionWidth();
+	const float heightMultiplier = 2.0f / UserSettings::GetResolutionHeight();
+
+	const float top = (float)m_y*heightMultiplier;
+	const float bottom = (float)(m_y - 32)*heightMultiplier;
+	float right = 0.0f;
+	for (size_t i = 0; i < length; i++)
+	{
+		const sFont& glyph = m_Font[m_text[i] - 32];
+		const float left = (i > 0) ? (right + 5.0f * widthMultiplier) : ((float)m_x*widthMultiplier);
+		right = left + ((static_cast<int32_t>(glyph.size) + 10)*widthMultiplier);
+
+		sVertex* const vertices = m_vertexData + (i * 4);
+		vertices[0].x = left;
+		vertices[0].y = bottom;
+		vertices[0].u = glyph.left;
+		vertices[0].v = 0.02f;
+
+		vertices[1].x = right;
+		vertices[1].y = bottom;
+		vertices[1].u = glyph.right;
+		vertices[1].v = 0.02f;
+
+		vertices[2].x = left;
+		vertices[2].y = top;
+		vertices[2].u = glyph.left;
+		vertices[2].v = 1;
+
+		vertices[3].x = right;
+		vertices[3].y = top;
+		vertices[3].u = glyph.right;
+		vertices[3].v = 1;
+
+		for (size_t j = 0; j < 4; j++)
+		{
+			vertices[j].z = 0;
+			vertices[j].red = vertices[j].green = vertices[j].blue = vertices[j].alpha = 255;
+		}
+	}
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	void AppendString(const char* const i_string, char* const io_text, size_t& io_length)
+	{
+		for (const char* character = i_string; (*character != '\0') && (io_length < eae6320::Graphics::cText::s_maxCharacterCount); ++character)
+		{
+			io_text[io_length++] = *character;
+		}
+	}
+
+	void AppendInteger(const uint64_t i_integer, const unsigned int i_minDigitCount, char* const io_text, size_t& io_length)
+	{
+		// The digits are found from the last to the first
+		char digits[20];
+		unsigned int digitCount = 0;
+		uint64_t integer = i_integer;
+		do
+		{
+			digits[digitCount++] = static_cast<char>('0' + (integer % 10));
+			integer /= 10;
+		} while ((integer != 0) || (digitCount < i_minDigitCount));
+		while ((digitCount > 0) && (io_length < eae6320::Graphics::cText::s_maxCharacterCount))
+		{
+			io_text[io_length++] = digits[--digitCount];
+		}
+	}
+}
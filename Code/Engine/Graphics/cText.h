@@ -4,14 +4,7 @@
 #include "Configuration.h"
 #include <fstream>
 #include <cstdint>
-
-#ifdef EAE6320_PLATFORM_GL
-#include "OpenGL/Includes.h"
-#endif
-
-#ifdef EAE6320_PLATFORM_D3D
-struct ID3D11Buffer;
-#endif
+#include "VertexData.h"
 
 namespace eae6320
 {
@@ -20,11 +13,31 @@ namespace eae6320
 		class cText
 		{
 		public:
-			void Draw() const;
-			static bool Initialize();
-			static bool CleanUp();
 			static bool LoadFontData(char* filename);
-			cText(char * text, int x, int y);
+
+			// A text can't be longer than this
+			// (the text and its laid out characters are stored inside of the cText,
+			// and so changing it never allocates anything)
+			static const size_t s_maxCharacterCount = 63;
+
+			// Text is only laid out again when it changes,
+			// and so these can be called every frame with the same values.
+			// They return whether anything changed.
+			// Text that is too long is cut off,
+			// and characters that the font doesn't have are replaced with '?'.
+			bool SetText(const char* const i_text);
+			// The number is written after the prefix
+			bool SetNumber(const int i_number, const char* const i_prefix = "");
+			bool SetNumber(const float i_number, const unsigned int i_decimalCount, const char* const i_prefix = "");
+			bool SetPosition(const int i_x, const int i_y);
+
+			const char* GetText() const { return m_text; }
+			size_t GetCharacterCount() const { return m_characterCount; }
+			// Text is drawn by adding these to a cSpriteBatch
+			// (there are 4 vertices for every character)
+			const sVertex* GetVertexData() const { return m_vertexData; }
+
+			cText(const char* const i_text, const int i_x, const int i_y);
 		
 			struct sScreenPosition
 			{
@@ -38,19 +51,16 @@ namespace eae6320
 			};
 
 		private:
+			// Lays out the text as a quad for each character
+			// (4 vertices per character)
+			void GenerateGeometry();
+
 			static sFont* m_Font;
-			char * m_text;
+			char m_text[s_maxCharacterCount + 1];
+			size_t m_characterCount = 0;
+			sVertex m_vertexData[s_maxCharacterCount * 4];
 			int16_t m_x;
 			int16_t m_y;
-
-#if defined( EAE6320_PLATFORM_D3D )
-
-#elif defined( EAE6320_PLATFORM_GL )
-			// A vertex array encapsulates the vertex data and the vertex input layout
-			static GLuint ms_vertexArrayId;
-			static GLuint ms_vertexBufferId;
-			static GLuint ms_indexBufferId;
-#endif
 		};
 	}
 }
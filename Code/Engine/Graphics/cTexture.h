@@ -12,6 +12,8 @@
 
 #include "Configuration.h"
 
+#include <cstdint>
+
 #ifdef EAE6320_PLATFORM_GL
 	#include "OpenGL/Includes.h"
 #endif
@@ -82,6 +84,8 @@ namespace eae6320
 			ID3D11ShaderResourceView* m_textureView;
 #elif defined( EAE6320_PLATFORM_GL )
 			GLuint m_textureId;
+#elif defined( EAE6320_PLATFORM_NULL )
+			uint32_t m_textureId;
 #endif
 
 			// Implementation
@@ -0,0 +1,86 @@
+/*
+	This file contains the parts of DirectXTex's DDS.h that loading a texture needs
+
+	DDS.h #includes dxgiformat.h and uses __declspec(),
+	and so platforms without the Windows SDK (i.e. the Linux build of the null platform)
+	use these definitions instead.
+	The names and layouts are the same as in DDS.h.
+*/
+
+#ifndef EAE6320_GRAPHICS_CTEXTURE_DDSFORMAT_H
+#define EAE6320_GRAPHICS_CTEXTURE_DDSFORMAT_H
+
+// Header Files
+//=============
+
+#include <cstdint>
+
+// Interface
+//==========
+
+#define DDS_FOURCC 0x00000004
+#define DDS_HEADER_FLAGS_VOLUME 0x00800000
+#define DDS_CUBEMAP 0x00000200
+
+#ifndef MAKEFOURCC
+	#define MAKEFOURCC( ch0, ch1, ch2, ch3 )	\
+		( static_cast<uint32_t>( static_cast<uint8_t>( ch0 ) ) | ( static_cast<uint32_t>( static_cast<uint8_t>( ch1 ) ) << 8 )	\
+		| ( static_cast<uint32_t>( static_cast<uint8_t>( ch2 ) ) << 16 ) | ( static_cast<uint32_t>( static_cast<uint8_t>( ch3 ) ) << 24 ) )
+#endif
+
+namespace DirectX
+{
+#pragma pack( push, 1 )
+
+	const uint32_t DDS_MAGIC = 0x20534444;	// "DDS "
+
+	struct DDS_PIXELFORMAT
+	{
+		uint32_t dwSize;
+		uint32_t dwFlags;
+		uint32_t dwFourCC;
+		uint32_t dwRGBBitCount;
+		uint32_t dwRBitMask;
+		uint32_t dwGBitMask;
+		uint32_t dwBBitMask;
+		uint32_t dwABitMask;
+	};
+
+	const DDS_PIXELFORMAT DDSPF_DXT1 = { sizeof( DDS_PIXELFORMAT ), DDS_FOURCC, MAKEFOURCC( 'D', 'X', 'T', '1' ), 0, 0, 0, 0, 0 };
+	const DDS_PIXELFORMAT DDSPF_DXT5 = { sizeof( DDS_PIXELFORMAT ), DDS_FOURCC, MAKEFOURCC( 'D', 'X', 'T', '5' ), 0, 0, 0, 0, 0 };
+
+	struct DDS_HEADER
+	{
+		uint32_t dwSize;
+		uint32_t dwFlags;
+		uint32_t dwHeight;
+		uint32_t dwWidth;
+		uint32_t dwPitchOrLinearSize;
+		uint32_t dwDepth;
+		uint32_t dwMipMapCount;
+		uint32_t dwReserved1[11];
+		DDS_PIXELFORMAT ddspf;
+		uint32_t dwCaps;
+		uint32_t dwCaps2;
+		uint32_t dwCaps3;
+		uint32_t dwCaps4;
+		uint32_t dwReserved2;
+	};
+
+	struct DDS_HEADER_DXT10
+	{
+		// This is a DXGI_FORMAT in DDS.h
+		uint32_t dxgiFormat;
+		uint32_t resourceDimension;
+		uint32_t miscFlag;
+		uint32_t arraySize;
+		uint32_t miscFlags2;
+	};
+
+#pragma pack( pop )
+
+	static_assert( sizeof( DDS_HEADER ) == 124, "DDS Header size mismatch" );
+	static_assert( sizeof( DDS_HEADER_DXT10 ) == 20, "DDS DX10 Extended Header size mismatch" );
+}
+
+#endif	// EAE6320_GRAPHICS_CTEXTURE_DDSFORMAT_H
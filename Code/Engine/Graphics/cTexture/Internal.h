@@ -5,6 +5,11 @@
 #ifndef EAE6320_GRAPHICS_CTEXTURE_INTERNAL_H
 #define EAE6320_GRAPHICS_CTEXTURE_INTERNAL_H
 
+// Header Files
+//=============
+
+#include <cstddef>
+
 namespace eae6320
 {
 	namespace Graphics
@@ -43,6 +48,7 @@ namespace eae6320
 					case BC6h: return 16; break;
 					// RGBA
 					case BC7: return 16; break;
+					case Unknown: break;
 				}
 
 				// The format doesn't use block compression
@@ -7,7 +7,11 @@
 #include "../../Asserts/Asserts.h"
 #include "../../Logging/Logging.h"
 #include "../../Platform/Platform.h"
-#include "../../../External/DirectXTex/DirectXTex/DDS.h"
+#if defined( EAE6320_PLATFORM_WINDOWS )
+	#include "../../../External/DirectXTex/DirectXTex/DDS.h"
+#else
+	#include "DdsFormat.h"
+#endif
 
 // Interface
 //==========
@@ -20,6 +24,12 @@ bool eae6320::Graphics::cTexture::Load( const char* const i_path )
 	bool wereThereErrors = false;
 
 	Platform::sDataFromFile dataFromFile;
+	// These are declared before the first jump to OnExit
+	// (C++ doesn't allow a goto to skip over an initialization)
+	const uint8_t* currentPosition = NULL;
+	size_t remainingSize = 0;
+	const DirectX::DDS_HEADER* header = NULL;
+	const DirectX::DDS_HEADER_DXT10* header_dxt10 = NULL;
 
 	// Load the binary data
 	{
@@ -35,8 +45,8 @@ bool eae6320::Graphics::cTexture::Load( const char* const i_path )
 	}
 
 	// DDS files must begin with a "magic number" that spells "DDS " (4 characters in a uint32_t)
-	const uint8_t* currentPosition = reinterpret_cast<uint8_t*>( dataFromFile.data );
-	size_t remainingSize = dataFromFile.size;
+	currentPosition = reinterpret_cast<uint8_t*>( dataFromFile.data );
+	remainingSize = dataFromFile.size;
 	if ( ( remainingSize >= sizeof( DirectX::DDS_MAGIC ) )
 		&& ( *reinterpret_cast<const uint32_t*>( currentPosition ) == DirectX::DDS_MAGIC ) )
 	{
@@ -51,7 +61,6 @@ bool eae6320::Graphics::cTexture::Load( const char* const i_path )
 		goto OnExit;
 	}
 	// A header follows the magic number
-	const DirectX::DDS_HEADER* header;
 	if ( remainingSize >= sizeof( DirectX::DDS_HEADER ) )
 	{
 		header = reinterpret_cast<const DirectX::DDS_HEADER*>( currentPosition );
@@ -75,7 +84,6 @@ bool eae6320::Graphics::cTexture::Load( const char* const i_path )
 		goto OnExit;
 	}
 	// Newer DDS files can have an extra header with more advanced information
-	const DirectX::DDS_HEADER_DXT10* header_dxt10 = NULL;
 	if ( ( header->ddspf.dwFlags & DDS_FOURCC )
 		&& ( header->ddspf.dwFourCC == MAKEFOURCC( 'D', 'X', '1', '0' ) ) )
 	{
@@ -177,6 +185,7 @@ bool eae6320::Graphics::cTexture::Load( const char* const i_path )
 		}
 		if ( !Initialize( i_path, ddsInfo ) )
 		{
+			wereThereErrors = true;
 			goto OnExit;
 		}
 	}
@@ -194,6 +203,8 @@ eae6320::Graphics::cTexture::cTexture()
 	m_textureView( NULL )
 #elif defined( EAE6320_PLATFORM_GL )
 	m_textureId( 0 )
+#elif defined( EAE6320_PLATFORM_NULL )
+	m_textureId( 0 )
 #endif
 {
 
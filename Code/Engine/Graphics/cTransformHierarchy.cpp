@@ -0,0 +1,139 @@
+// Header Files
+//=============
+
+#include "cTransformHierarchy.h"
+
+#include "../Asserts/Asserts.h"
+
+// Interface
+//==========
+
+// Nodes
+//------
+
+eae6320::Graphics::cTransformHierarchy::tNodeId eae6320::Graphics::cTransformHierarchy::AddNode( const tNodeId i_parent,
+	const Math::cVector& i_localPosition, const Math::cQuaternion& i_localOrientation )
+{
+	// Since a parent must already exist it is always stored before its children
+	EAE6320_ASSERTF( ( i_parent == InvalidNodeId ) || ( i_parent < m_parents.size() ), "The parent node must be added before the child" );
+	const tNodeId node = static_cast<tNodeId>( m_parents.size() );
+	m_parents.push_back( i_parent );
+	m_localPositions.push_back( i_localPosition );
+	m_localOrientations.push_back( i_localOrientation );
+	m_localTransforms.push_back( Math::cMatrix_transformation() );
+	m_worldTransforms.push_back( Math::cMatrix_transformation() );
+	m_isDirty.push_back( 1 );
+	m_wasUpdated.push_back( 0 );
+	return node;
+}
+
+// Local Transforms
+//-----------------
+
+void eae6320::Graphics::cTransformHierarchy::SetLocalPosition( const tNodeId i_node, const Math::cVector& i_position )
+{
+	EAE6320_ASSERT( i_node < m_parents.size() );
+	if ( m_localPositions[i_node] != i_position )
+	{
+		m_localPositions[i_node] = i_position;
+		m_isDirty[i_node] = 1;
+	}
+}
+
+void eae6320::Graphics::cTransformHierarchy::SetLocalOrientation( const tNodeId i_node, const Math::cQuaternion& i_orientation )
+{
+	EAE6320_ASSERT( i_node < m_parents.size() );
+	m_localOrientations[i_node] = i_orientation;
+	m_isDirty[i_node] = 1;
+}
+
+void eae6320::Graphics::cTransformHierarchy::SetLocalTransform( const tNodeId i_node,
+	const Math::cVector& i_position, const Math::cQuaternion& i_orientation )
+{
+	EAE6320_ASSERT( i_node < m_parents.size() );
+	m_localPositions[i_node] = i_position;
+	m_localOrientations[i_node] = i_orientation;
+	m_isDirty[i_node] = 1;
+}
+
+// World Transforms
+//-----------------
+
+void eae6320::Graphics::cTransformHierarchy::UpdateWorldTransforms()
+{
+	const size_t nodeCount = m_parents.size();
+	// Nothing before the first dirty node can change,
+	// and every node from there on might need its local transform
+	// (either because it is dirty or because an ancestor is)
+	size_t firstDirtyNode = 0;
+	while ( ( firstDirtyNode < nodeCount ) && ( m_isDirty[firstDirtyNode] == 0 ) )
+	{
+		m_wasUpdated[firstDirtyNode] = 0;
+		++firstDirtyNode;
+	}
+	if ( firstDirtyNode >= nodeCount )
+	{
+		return;
+	}
+	// The local transforms are all converted from quaternions at once,
+	// which is much faster than converting them individually in the loop below
+	Math::CreateTransforms( &m_localOrientations[firstDirtyNode], &m_localPositions[firstDirtyNode],
+		&m_localTransforms[firstDirtyNode], nodeCount - firstDirtyNode );
+	for ( size_t i = firstDirtyNode; i < nodeCount; ++i )
+	{
+		const tNodeId parent = m_parents[i];
+		// Parents are always before their children,
+		// and so by the time a child is reached its parent has already been updated (if it needed to be)
+		const bool isParentUpdated = ( parent != InvalidNodeId ) && ( m_wasUpdated[parent] != 0 );
+		if ( m_isDirty[i] || isParentUpdated )
+		{
+			const Math::cMatrix_transformation& transform_localToParent = m_localTransforms[i];
+			// The vectors are rows, and so the local transform is applied first
+			m_worldTransforms[i] = ( parent != InvalidNodeId ) ?
+				( transform_localToParent * m_worldTransforms[parent] ) : transform_localToParent;
+			m_isDirty[i] = 0;
+			m_wasUpdated[i] = 1;
+		}
+		else
+		{
+			m_wasUpdated[i] = 0;
+		}
+	}
+}
+
+const eae6320::Math::cMatrix_transformation& eae6320::Graphics::cTransformHierarchy::GetWorldTransform( const tNodeId i_node ) const
+{
+	EAE6320_ASSERT( i_node < m_parents.size() );
+	EAE6320_ASSERTF( m_isDirty[i_node] == 0, "The world transforms must be updated after a local transform changes" );
+	return m_worldTransforms[i_node];
+}
+
+eae6320::Math::cVector eae6320::Graphics::cTransformHierarchy::GetWorldPosition( const tNodeId i_node ) const
+{
+	return GetWorldTransform( i_node ).TransformPoint( Math::cVector() );
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+void eae6320::Graphics::cTransformHierarchy::Reserve( const size_t i_nodeCount )
+{
+	m_parents.reserve( i_nodeCount );
+	m_localPositions.reserve( i_nodeCount );
+	m_localOrientations.reserve( i_nodeCount );
+	m_localTransforms.reserve( i_nodeCount );
+	m_worldTransforms.reserve( i_nodeCount );
+	m_isDirty.reserve( i_nodeCount );
+	m_wasUpdated.reserve( i_nodeCount );
+}
+
+void eae6320::Graphics::cTransformHierarchy::Clear()
+{
+	m_parents.clear();
+	m_localPositions.clear();
+	m_localOrientations.clear();
+	m_localTransforms.clear();
+	m_worldTransforms.clear();
+	m_isDirty.clear();
+	m_wasUpdated.clear();
+}
@@ -0,0 +1,97 @@
+/*
+	This class stores parent/child transforms (a scene graph)
+	so that attached objects follow whatever they are attached to
+
+	The nodes are stored as parallel arrays (structure-of-arrays),
+	and a node can only be added after its parent.
+	This means that every parent is stored before all of its children,
+	and so all of the world transforms can be updated with one linear pass over the arrays
+	without any recursion or pointer chasing.
+	Only nodes whose local transform changed (and their descendants) are recalculated.
+*/
+
+#ifndef EAE6320_GRAPHICS_CTRANSFORMHIERARCHY_H
+#define EAE6320_GRAPHICS_CTRANSFORMHIERARCHY_H
+
+// Header Files
+//=============
+
+#include <cstdint>
+#include <vector>
+#include "../Math/cMatrix_transformation.h"
+#include "../Math/cQuaternion.h"
+#include "../Math/cVector.h"
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+	namespace Graphics
+	{
+		class cTransformHierarchy
+		{
+			// Interface
+			//==========
+
+		public:
+
+			// A node is identified by its index,
+			// which never changes because nodes are never reordered
+			typedef uint32_t tNodeId;
+			static const tNodeId InvalidNodeId = ~tNodeId( 0 );
+
+			// Nodes
+			//------
+
+			// i_parent can be InvalidNodeId to make a root node
+			tNodeId AddNode( const tNodeId i_parent,
+				const Math::cVector& i_localPosition = Math::cVector(), const Math::cQuaternion& i_localOrientation = Math::cQuaternion() );
+			size_t GetNodeCount() const { return m_parents.size(); }
+
+			// Local Transforms
+			//-----------------
+
+			// These are relative to the parent (or to the world for a root node)
+			// and only mark the node as dirty;
+			// nothing is recalculated until UpdateWorldTransforms() is called
+			void SetLocalPosition( const tNodeId i_node, const Math::cVector& i_position );
+			void SetLocalOrientation( const tNodeId i_node, const Math::cQuaternion& i_orientation );
+			void SetLocalTransform( const tNodeId i_node, const Math::cVector& i_position, const Math::cQuaternion& i_orientation );
+
+			// World Transforms
+			//-----------------
+
+			void UpdateWorldTransforms();
+			// These are only valid after UpdateWorldTransforms() has been called
+			const Math::cMatrix_transformation& GetWorldTransform( const tNodeId i_node ) const;
+			Math::cVector GetWorldPosition( const tNodeId i_node ) const;
+
+			// Initialization / Clean Up
+			//--------------------------
+
+			void Reserve( const size_t i_nodeCount );
+			void Clear();
+
+			// Data
+			//=====
+
+		private:
+
+			std::vector<tNodeId> m_parents;
+			std::vector<Math::cVector> m_localPositions;
+			std::vector<Math::cQuaternion> m_localOrientations;
+			// These are only used during an update
+			std::vector<Math::cMatrix_transformation> m_localTransforms;
+			std::vector<Math::cMatrix_transformation> m_worldTransforms;
+			// A node is dirty if its own local transform has changed since the last update
+			// (the dirty state of its descendants is determined during the update)
+			std::vector<uint8_t> m_isDirty;
+			// This is only used during an update
+			// to know whether a parent's world transform changed
+			std::vector<uint8_t> m_wasUpdated;
+		};
+	}
+}
+
+#endif	// EAE6320_GRAPHICS_CTRANSFORMHIERARCHY_H
@@ -119,7 +119,7 @@ namespace
 		const int formattingResult = vsnprintf( buffer, bufferSize, i_message, io_insertions );
 		if ( formattingResult >= 0 )
 		{
-			if ( formattingResult < bufferSize )
+			if ( static_cast<size_t>( formattingResult ) < bufferSize )
 			{
 				return s_logger.OutputMessage( buffer );
 			}
@@ -0,0 +1,506 @@
+// Header Files
+//=============
+
+#include "BoundingVolumes.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cfloat>
+#include "cMatrix_transformation.h"
+#include "cSimdVector.h"
+#include "../Asserts/Asserts.h"
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	// Returns the plane with its normal scaled to unit length
+	eae6320::Math::sPlane CreateNormalizedPlane( const float i_a, const float i_b, const float i_c, const float i_d );
+	// Returns true if the triangle's projection onto the axis doesn't overlap the box's projection
+	bool IsSeparatingAxis( const eae6320::Math::cVector& i_axis, const eae6320::Math::cVector& i_halfExtents,
+		const eae6320::Math::cVector& i_vertex0, const eae6320::Math::cVector& i_vertex1, const eae6320::Math::cVector& i_vertex2 );
+	// Loads four boxes as structure-of-arrays
+	// (with unaligned loads and a transpose, which is much cheaper than inserting each of the 24 floats on its own)
+	void LoadBoxes4( const eae6320::Math::sAABB* const i_boxes,
+		__m128& o_min_x, __m128& o_min_y, __m128& o_min_z, __m128& o_max_x, __m128& o_max_y, __m128& o_max_z );
+#if defined( __AVX__ )
+	// Loads eight boxes as structure-of-arrays (as two groups of four)
+	void LoadBoxes8( const eae6320::Math::sAABB* const i_boxes,
+		__m256& o_min_x, __m256& o_min_y, __m256& o_min_z, __m256& o_max_x, __m256& o_max_y, __m256& o_max_z );
+#endif
+}
+
+// Interface
+//==========
+
+// Box
+//----
+
+eae6320::Math::cVector eae6320::Math::sAABB::GetCenter() const
+{
+	return ( m_min + m_max ) * 0.5f;
+}
+
+eae6320::Math::cVector eae6320::Math::sAABB::GetHalfExtents() const
+{
+	return ( m_max - m_min ) * 0.5f;
+}
+
+bool eae6320::Math::sAABB::Contains( const cVector& i_point ) const
+{
+	return ( i_point.x >= m_min.x ) && ( i_point.x <= m_max.x )
+		&& ( i_point.y >= m_min.y ) && ( i_point.y <= m_max.y )
+		&& ( i_point.z >= m_min.z ) && ( i_point.z <= m_max.z );
+}
+
+void eae6320::Math::sAABB::Expand( const cVector& i_point )
+{
+	m_min = cVector( std::min( m_min.x, i_point.x ), std::min( m_min.y, i_point.y ), std::min( m_min.z, i_point.z ) );
+	m_max = cVector( std::max( m_max.x, i_point.x ), std::max( m_max.y, i_point.y ), std::max( m_max.z, i_point.z ) );
+}
+
+eae6320::Math::sAABB eae6320::Math::sAABB::CreateFromCenterAndHalfExtents( const cVector& i_center, const cVector& i_halfExtents )
+{
+	sAABB box;
+	box.m_min = i_center - i_halfExtents;
+	box.m_max = i_center + i_halfExtents;
+	return box;
+}
+
+eae6320::Math::sAABB eae6320::Math::sAABB::CreateFromPoints( const cVector* const i_points, const size_t i_pointCount )
+{
+	EAE6320_ASSERTF( i_pointCount > 0, "A box can't be created from zero points" );
+	sAABB box;
+	box.m_min = box.m_max = i_points[0];
+	for ( size_t i = 1; i < i_pointCount; ++i )
+	{
+		box.Expand( i_points[i] );
+	}
+	return box;
+}
+
+eae6320::Math::sAABB eae6320::Math::sAABB::CreateFromTransformedBox( const sAABB& i_box, const cMatrix_transformation& i_transform )
+{
+	// Each of the box's half extents is transformed into a (possibly rotated) vector,
+	// and the new half extents are the sums of their absolute values on each axis
+	const cVector halfExtents = i_box.GetHalfExtents();
+	const cVector axis_x = i_transform.TransformDirection( cVector( halfExtents.x, 0.0f, 0.0f ) );
+	const cVector axis_y = i_transform.TransformDirection( cVector( 0.0f, halfExtents.y, 0.0f ) );
+	const cVector axis_z = i_transform.TransformDirection( cVector( 0.0f, 0.0f, halfExtents.z ) );
+	const cVector halfExtents_transformed(
+		std::abs( axis_x.x ) + std::abs( axis_y.x ) + std::abs( axis_z.x ),
+		std::abs( axis_x.y ) + std::abs( axis_y.y ) + std::abs( axis_z.y ),
+		std::abs( axis_x.z ) + std::abs( axis_y.z ) + std::abs( axis_z.z ) );
+	return CreateFromCenterAndHalfExtents( i_transform.TransformPoint( i_box.GetCenter() ), halfExtents_transformed );
+}
+
+// Plane
+//------
+
+float eae6320::Math::sPlane::GetSignedDistance( const cVector& i_point ) const
+{
+	return Dot( m_normal, i_point ) + m_distance;
+}
+
+eae6320::Math::sPlane eae6320::Math::sPlane::CreateFromPointAndNormal( const cVector& i_point, const cVector& i_normal_normalized )
+{
+	sPlane plane;
+	plane.m_normal = i_normal_normalized;
+	plane.m_distance = -Dot( i_normal_normalized, i_point );
+	return plane;
+}
+
+// Frustum
+//--------
+
+eae6320::Math::sFrustum eae6320::Math::sFrustum::CreateFromTransform( const cMatrix_transformation& i_transform_worldToScreen )
+{
+	// A point is inside the view volume when each of its clip-space x, y, and z is between -w and w
+	// (or, for z in Direct3D, between 0 and w).
+	// Because the vectors are rows each clip-space component is the dot product of the point and one column,
+	// and so each plane is a sum or difference of two columns
+	// (this is the Gribb/Hartmann method)
+	const cMatrix_transformation& m = i_transform_worldToScreen;
+	sFrustum frustum;
+	frustum.m_planes[Left] = CreateNormalizedPlane( m.m_03 + m.m_00, m.m_13 + m.m_10, m.m_23 + m.m_20, m.m_33 + m.m_30 );
+	frustum.m_planes[Right] = CreateNormalizedPlane( m.m_03 - m.m_00, m.m_13 - m.m_10, m.m_23 - m.m_20, m.m_33 - m.m_30 );
+	frustum.m_planes[Bottom] = CreateNormalizedPlane( m.m_03 + m.m_01, m.m_13 + m.m_11, m.m_23 + m.m_21, m.m_33 + m.m_31 );
+	frustum.m_planes[Top] = CreateNormalizedPlane( m.m_03 - m.m_01, m.m_13 - m.m_11, m.m_23 - m.m_21, m.m_33 - m.m_31 );
+#if defined( EAE6320_PLATFORM_D3D )
+	frustum.m_planes[Near] = CreateNormalizedPlane( m.m_02, m.m_12, m.m_22, m.m_32 );
+#else
+	frustum.m_planes[Near] = CreateNormalizedPlane( m.m_03 + m.m_02, m.m_13 + m.m_12, m.m_23 + m.m_22, m.m_33 + m.m_32 );
+#endif
+	frustum.m_planes[Far] = CreateNormalizedPlane( m.m_03 - m.m_02, m.m_13 - m.m_12, m.m_23 - m.m_22, m.m_33 - m.m_32 );
+	return frustum;
+}
+
+// Overlap Tests
+//--------------
+
+bool eae6320::Math::Overlaps( const sAABB& i_lhs, const sAABB& i_rhs )
+{
+	return ( i_lhs.m_min.x <= i_rhs.m_max.x ) && ( i_lhs.m_max.x >= i_rhs.m_min.x )
+		&& ( i_lhs.m_min.y <= i_rhs.m_max.y ) && ( i_lhs.m_max.y >= i_rhs.m_min.y )
+		&& ( i_lhs.m_min.z <= i_rhs.m_max.z ) && ( i_lhs.m_max.z >= i_rhs.m_min.z );
+}
+
+bool eae6320::Math::Overlaps( const sAABB& i_box, const sSphere& i_sphere )
+{
+	// The closest point in the box to the sphere's center is found by clamping,
+	// and the sphere overlaps if that point is within the radius
+	const cSimdVector center( i_sphere.m_center );
+	const cSimdVector closestPoint = Min( Max( center, cSimdVector( i_box.m_min ) ), cSimdVector( i_box.m_max ) );
+	return ( closestPoint - center ).GetLengthSquared() <= ( i_sphere.m_radius * i_sphere.m_radius );
+}
+
+bool eae6320::Math::Overlaps( const sSphere& i_lhs, const sSphere& i_rhs )
+{
+	const float radii = i_lhs.m_radius + i_rhs.m_radius;
+	return ( cSimdVector( i_lhs.m_center ) - cSimdVector( i_rhs.m_center ) ).GetLengthSquared() <= ( radii * radii );
+}
+
+bool eae6320::Math::Overlaps( const sAABB& i_box, const cVector& i_vertex0, const cVector& i_vertex1, const cVector& i_vertex2 )
+{
+	// The triangle is moved so that the box is centered at the origin,
+	// and then 13 axes are tested; if the projections don't overlap on any one of them the shapes can't touch
+	const cVector center = i_box.GetCenter();
+	const cVector halfExtents = i_box.GetHalfExtents();
+	const cVector v0 = i_vertex0 - center;
+	const cVector v1 = i_vertex1 - center;
+	const cVector v2 = i_vertex2 - center;
+
+	// The box's face normals
+	// (this is the same as testing the triangle's bounding box against the box)
+	if ( ( std::max( std::max( v0.x, v1.x ), v2.x ) < -halfExtents.x ) || ( std::min( std::min( v0.x, v1.x ), v2.x ) > halfExtents.x )
+		|| ( std::max( std::max( v0.y, v1.y ), v2.y ) < -halfExtents.y ) || ( std::min( std::min( v0.y, v1.y ), v2.y ) > halfExtents.y )
+		|| ( std::max( std::max( v0.z, v1.z ), v2.z ) < -halfExtents.z ) || ( std::min( std::min( v0.z, v1.z ), v2.z ) > halfExtents.z ) )
+	{
+		return false;
+	}
+	// The cross products of each triangle edge with each box axis
+	const cVector edges[] = { v1 - v0, v2 - v1, v0 - v2 };
+	const cVector boxAxes[] = { cVector( 1.0f, 0.0f, 0.0f ), cVector( 0.0f, 1.0f, 0.0f ), cVector( 0.0f, 0.0f, 1.0f ) };
+	for ( unsigned int i = 0; i < 3; ++i )
+	{
+		for ( unsigned int j = 0; j < 3; ++j )
+		{
+			if ( IsSeparatingAxis( Cross( edges[i], boxAxes[j] ), halfExtents, v0, v1, v2 ) )
+			{
+				return false;
+			}
+		}
+	}
+	// The triangle's normal
+	return !IsSeparatingAxis( Cross( edges[0], edges[1] ), halfExtents, v0, v1, v2 );
+}
+
+bool eae6320::Math::Overlaps( const sFrustum& i_frustum, const sSphere& i_sphere )
+{
+	for ( unsigned int i = 0; i < sFrustum::PlaneCount; ++i )
+	{
+		if ( i_frustum.m_planes[i].GetSignedDistance( i_sphere.m_center ) < -i_sphere.m_radius )
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+eae6320::Math::eContainment eae6320::Math::Classify( const sFrustum& i_frustum, const sAABB& i_box )
+{
+	const cVector center = i_box.GetCenter();
+	const cVector halfExtents = i_box.GetHalfExtents();
+	eContainment result = Inside;
+	for ( unsigned int i = 0; i < sFrustum::PlaneCount; ++i )
+	{
+		const sPlane& plane = i_frustum.m_planes[i];
+		// The "radius" of the box is the distance from its center to the corner that is furthest along the plane's normal
+		const float distance = plane.GetSignedDistance( center );
+		const float radius = ( halfExtents.x * std::abs( plane.m_normal.x ) )
+			+ ( halfExtents.y * std::abs( plane.m_normal.y ) ) + ( halfExtents.z * std::abs( plane.m_normal.z ) );
+		if ( distance < -radius )
+		{
+			return Outside;
+		}
+		else if ( distance < radius )
+		{
+			result = Intersecting;
+		}
+	}
+	return result;
+}
+
+bool eae6320::Math::Intersects( const sRay& i_ray, const sAABB& i_box, float* const o_t )
+{
+	// The ray is clipped against each pair of parallel planes ("slabs"),
+	// and it hits the box if there is any part of it left
+	const float origin[] = { i_ray.m_origin.x, i_ray.m_origin.y, i_ray.m_origin.z };
+	const float direction[] = { i_ray.m_direction.x, i_ray.m_direction.y, i_ray.m_direction.z };
+	const float boxMin[] = { i_box.m_min.x, i_box.m_min.y, i_box.m_min.z };
+	const float boxMax[] = { i_box.m_max.x, i_box.m_max.y, i_box.m_max.z };
+	float t_min = 0.0f;
+	float t_max = FLT_MAX;
+	for ( unsigned int i = 0; i < 3; ++i )
+	{
+		if ( std::abs( direction[i] ) < 1.0e-9f )
+		{
+			// A ray parallel to the slab misses unless it starts inside of it
+			if ( ( origin[i] < boxMin[i] ) || ( origin[i] > boxMax[i] ) )
+			{
+				return false;
+			}
+		}
+		else
+		{
+			const float direction_reciprocal = 1.0f / direction[i];
+			float t_near = ( boxMin[i] - origin[i] ) * direction_reciprocal;
+			float t_far = ( boxMax[i] - origin[i] ) * direction_reciprocal;
+			if ( t_near > t_far )
+			{
+				std::swap( t_near, t_far );
+			}
+			t_min = std::max( t_min, t_near );
+			t_max = std::min( t_max, t_far );
+			if ( t_min > t_max )
+			{
+				return false;
+			}
+		}
+	}
+	if ( o_t )
+	{
+		*o_t = t_min;
+	}
+	return true;
+}
+
+bool eae6320::Math::Intersects( const sRay& i_ray, const sSphere& i_sphere, float* const o_t )
+{
+	// This solves |origin + t * direction - center|^2 = radius^2 for t
+	const cSimdVector direction( i_ray.m_direction );
+	const cSimdVector offset = cSimdVector( i_ray.m_origin ) - cSimdVector( i_sphere.m_center );
+	const float a = direction.GetLengthSquared();
+	EAE6320_ASSERTF( a > 1.0e-9f, "A ray must have a direction" );
+	const float b = Dot( offset, direction );
+	const float c = offset.GetLengthSquared() - ( i_sphere.m_radius * i_sphere.m_radius );
+	// The ray misses if it starts outside of the sphere and points away from it
+	if ( ( c > 0.0f ) && ( b > 0.0f ) )
+	{
+		return false;
+	}
+	const float discriminant = ( b * b ) - ( a * c );
+	if ( discriminant < 0.0f )
+	{
+		return false;
+	}
+	if ( o_t )
+	{
+		*o_t = std::max( ( -b - std::sqrt( discriminant ) ) / a, 0.0f );
+	}
+	return true;
+}
+
+// Batched Tests
+//--------------
+
+uint32_t eae6320::Math::Overlaps4( const sFrustum& i_frustum, const sAABB* const i_boxes, uint32_t* const o_insideMask )
+{
+	// The four boxes are stored as structure-of-arrays
+	// so that each plane is tested against all of them at once
+	const __m128 half = _mm_set1_ps( 0.5f );
+	__m128 min_x, min_y, min_z, max_x, max_y, max_z;
+	LoadBoxes4( i_boxes, min_x, min_y, min_z, max_x, max_y, max_z );
+	const __m128 center_x = _mm_mul_ps( _mm_add_ps( min_x, max_x ), half );
+	const __m128 center_y = _mm_mul_ps( _mm_add_ps( min_y, max_y ), half );
+	const __m128 center_z = _mm_mul_ps( _mm_add_ps( min_z, max_z ), half );
+	const __m128 extent_x = _mm_mul_ps( _mm_sub_ps( max_x, min_x ), half );
+	const __m128 extent_y = _mm_mul_ps( _mm_sub_ps( max_y, min_y ), half );
+	const __m128 extent_z = _mm_mul_ps( _mm_sub_ps( max_z, min_z ), half );
+
+	__m128 isOutside = _mm_setzero_ps();
+	__m128 isIntersecting = _mm_setzero_ps();
+	for ( unsigned int i = 0; i < sFrustum::PlaneCount; ++i )
+	{
+		const sPlane& plane = i_frustum.m_planes[i];
+		const __m128 distance = _mm_add_ps(
+			_mm_add_ps( _mm_mul_ps( center_x, _mm_set1_ps( plane.m_normal.x ) ), _mm_mul_ps( center_y, _mm_set1_ps( plane.m_normal.y ) ) ),
+			_mm_add_ps( _mm_mul_ps( center_z, _mm_set1_ps( plane.m_normal.z ) ), _mm_set1_ps( plane.m_distance ) ) );
+		const __m128 radius = _mm_add_ps(
+			_mm_add_ps( _mm_mul_ps( extent_x, _mm_set1_ps( std::abs( plane.m_normal.x ) ) ), _mm_mul_ps( extent_y, _mm_set1_ps( std::abs( plane.m_normal.y ) ) ) ),
+			_mm_mul_ps( extent_z, _mm_set1_ps( std::abs( plane.m_normal.z ) ) ) );
+		isOutside = _mm_or_ps( isOutside, _mm_cmplt_ps( _mm_add_ps( distance, radius ), _mm_setzero_ps() ) );
+		isIntersecting = _mm_or_ps( isIntersecting, _mm_cmplt_ps( _mm_sub_ps( distance, radius ), _mm_setzero_ps() ) );
+		// Most boxes are outside of the view,
+		// and once all four are outside of one plane the others don't need to be tested
+		// (an outside box is also intersecting, and so this doesn't change the inside mask)
+		if ( _mm_movemask_ps( isOutside ) == 0xf )
+		{
+			break;
+		}
+	}
+	if ( o_insideMask )
+	{
+		*o_insideMask = static_cast<uint32_t>( ~_mm_movemask_ps( isIntersecting ) ) & 0xf;
+	}
+	return static_cast<uint32_t>( ~_mm_movemask_ps( isOutside ) ) & 0xf;
+}
+
+uint32_t eae6320::Math::Overlaps8( const sFrustum& i_frustum, const sAABB* const i_boxes, uint32_t* const o_insideMask )
+{
+#if defined( __AVX__ )
+	const __m256 half = _mm256_set1_ps( 0.5f );
+	__m256 min_x, min_y, min_z, max_x, max_y, max_z;
+	LoadBoxes8( i_boxes, min_x, min_y, min_z, max_x, max_y, max_z );
+	const __m256 center_x = _mm256_mul_ps( _mm256_add_ps( min_x, max_x ), half );
+	const __m256 center_y = _mm256_mul_ps( _mm256_add_ps( min_y, max_y ), half );
+	const __m256 center_z = _mm256_mul_ps( _mm256_add_ps( min_z, max_z ), half );
+	const __m256 extent_x = _mm256_mul_ps( _mm256_sub_ps( max_x, min_x ), half );
+	const __m256 extent_y = _mm256_mul_ps( _mm256_sub_ps( max_y, min_y ), half );
+	const __m256 extent_z = _mm256_mul_ps( _mm256_sub_ps( max_z, min_z ), half );
+
+	const __m256 zero = _mm256_setzero_ps();
+	__m256 isOutside = zero;
+	__m256 isIntersecting = zero;
+	for ( unsigned int i = 0; i < sFrustum::PlaneCount; ++i )
+	{
+		const sPlane& plane = i_frustum.m_planes[i];
+		const __m256 distance = _mm256_add_ps(
+			_mm256_add_ps( _mm256_mul_ps( center_x, _mm256_set1_ps( plane.m_normal.x ) ), _mm256_mul_ps( center_y, _mm256_set1_ps( plane.m_normal.y ) ) ),
+			_mm256_add_ps( _mm256_mul_ps( center_z, _mm256_set1_ps( plane.m_normal.z ) ), _mm256_set1_ps( plane.m_distance ) ) );
+		const __m256 radius = _mm256_add_ps(
+			_mm256_add_ps( _mm256_mul_ps( extent_x, _mm256_set1_ps( std::abs( plane.m_normal.x ) ) ), _mm256_mul_ps( extent_y, _mm256_set1_ps( std::abs( plane.m_normal.y ) ) ) ),
+			_mm256_mul_ps( extent_z, _mm256_set1_ps( std::abs( plane.m_normal.z ) ) ) );
+		isOutside = _mm256_or_ps( isOutside, _mm256_cmp_ps( _mm256_add_ps( distance, radius ), zero, _CMP_LT_OQ ) );
+		isIntersecting = _mm256_or_ps( isIntersecting, _mm256_cmp_ps( _mm256_sub_ps( distance, radius ), zero, _CMP_LT_OQ ) );
+		if ( _mm256_movemask_ps( isOutside ) == 0xff )
+		{
+			break;
+		}
+	}
+	if ( o_insideMask )
+	{
+		*o_insideMask = static_cast<uint32_t>( ~_mm256_movemask_ps( isIntersecting ) ) & 0xff;
+	}
+	return static_cast<uint32_t>( ~_mm256_movemask_ps( isOutside ) ) & 0xff;
+#else
+	// Without AVX the boxes are tested as two groups of four
+	uint32_t insideMask_low, insideMask_high;
+	const uint32_t overlapMask = Overlaps4( i_frustum, i_boxes, &insideMask_low ) | ( Overlaps4( i_frustum, i_boxes + 4, &insideMask_high ) << 4 );
+	if ( o_insideMask )
+	{
+		*o_insideMask = insideMask_low | ( insideMask_high << 4 );
+	}
+	return overlapMask;
+#endif
+}
+
+uint32_t eae6320::Math::Overlaps4( const sSphere& i_sphere, const sAABB* const i_boxes )
+{
+	// For each box the closest point to the sphere's center is found by clamping,
+	// and the squared distances to those points are compared to the squared radius
+	__m128 min_x, min_y, min_z, max_x, max_y, max_z;
+	LoadBoxes4( i_boxes, min_x, min_y, min_z, max_x, max_y, max_z );
+	const __m128 center_x = _mm_set1_ps( i_sphere.m_center.x );
+	const __m128 center_y = _mm_set1_ps( i_sphere.m_center.y );
+	const __m128 center_z = _mm_set1_ps( i_sphere.m_center.z );
+	const __m128 closest_x = _mm_min_ps( _mm_max_ps( center_x, min_x ), max_x );
+	const __m128 closest_y = _mm_min_ps( _mm_max_ps( center_y, min_y ), max_y );
+	const __m128 closest_z = _mm_min_ps( _mm_max_ps( center_z, min_z ), max_z );
+	const __m128 offset_x = _mm_sub_ps( closest_x, center_x );
+	const __m128 offset_y = _mm_sub_ps( closest_y, center_y );
+	const __m128 offset_z = _mm_sub_ps( closest_z, center_z );
+	const __m128 distanceSquared = _mm_add_ps( _mm_add_ps( _mm_mul_ps( offset_x, offset_x ), _mm_mul_ps( offset_y, offset_y ) ),
+		_mm_mul_ps( offset_z, offset_z ) );
+	return static_cast<uint32_t>( _mm_movemask_ps(
+		_mm_cmple_ps( distanceSquared, _mm_set1_ps( i_sphere.m_radius * i_sphere.m_radius ) ) ) );
+}
+
+uint32_t eae6320::Math::Overlaps8( const sSphere& i_sphere, const sAABB* const i_boxes )
+{
+#if defined( __AVX__ )
+	__m256 min_x, min_y, min_z, max_x, max_y, max_z;
+	LoadBoxes8( i_boxes, min_x, min_y, min_z, max_x, max_y, max_z );
+	const __m256 center_x = _mm256_set1_ps( i_sphere.m_center.x );
+	const __m256 center_y = _mm256_set1_ps( i_sphere.m_center.y );
+	const __m256 center_z = _mm256_set1_ps( i_sphere.m_center.z );
+	const __m256 closest_x = _mm256_min_ps( _mm256_max_ps( center_x, min_x ), max_x );
+	const __m256 closest_y = _mm256_min_ps( _mm256_max_ps( center_y, min_y ), max_y );
+	const __m256 closest_z = _mm256_min_ps( _mm256_max_ps( center_z, min_z ), max_z );
+	const __m256 offset_x = _mm256_sub_ps( closest_x, center_x );
+	const __m256 offset_y = _mm256_sub_ps( closest_y, center_y );
+	const __m256 offset_z = _mm256_sub_ps( closest_z, center_z );
+	const __m256 distanceSquared = _mm256_add_ps( _mm256_add_ps( _mm256_mul_ps( offset_x, offset_x ), _mm256_mul_ps( offset_y, offset_y ) ),
+		_mm256_mul_ps( offset_z, offset_z ) );
+	return static_cast<uint32_t>( _mm256_movemask_ps(
+		_mm256_cmp_ps( distanceSquared, _mm256_set1_ps( i_sphere.m_radius * i_sphere.m_radius ), _CMP_LE_OQ ) ) );
+#else
+	return Overlaps4( i_sphere, i_boxes ) | ( Overlaps4( i_sphere, i_boxes + 4 ) << 4 );
+#endif
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	eae6320::Math::sPlane CreateNormalizedPlane( const float i_a, const float i_b, const float i_c, const float i_d )
+	{
+		const float length = std::sqrt( ( i_a * i_a ) + ( i_b * i_b ) + ( i_c * i_c ) );
+		EAE6320_ASSERTF( length > 1.0e-9f, "A plane's normal can't be zero" );
+		const float length_reciprocal = 1.0f / length;
+		eae6320::Math::sPlane plane;
+		plane.m_normal = eae6320::Math::cVector( i_a * length_reciprocal, i_b * length_reciprocal, i_c * length_reciprocal );
+		plane.m_distance = i_d * length_reciprocal;
+		return plane;
+	}
+
+	bool IsSeparatingAxis( const eae6320::Math::cVector& i_axis, const eae6320::Math::cVector& i_halfExtents,
+		const eae6320::Math::cVector& i_vertex0, const eae6320::Math::cVector& i_vertex1, const eae6320::Math::cVector& i_vertex2 )
+	{
+		const float p0 = Dot( i_axis, i_vertex0 );
+		const float p1 = Dot( i_axis, i_vertex1 );
+		const float p2 = Dot( i_axis, i_vertex2 );
+		const float radius = ( i_halfExtents.x * std::abs( i_axis.x ) )
+			+ ( i_halfExtents.y * std::abs( i_axis.y ) ) + ( i_halfExtents.z * std::abs( i_axis.z ) );
+		return ( std::max( std::max( p0, p1 ), p2 ) < -radius ) || ( std::min( std::min( p0, p1 ), p2 ) > radius );
+	}
+
+	void LoadBoxes4( const eae6320::Math::sAABB* const i_boxes,
+		__m128& o_min_x, __m128& o_min_y, __m128& o_min_z, __m128& o_max_x, __m128& o_max_y, __m128& o_max_z )
+	{
+		static_assert( sizeof( eae6320::Math::sAABB ) == ( sizeof( float ) * 6 ), "sAABB must be exactly 6 floats" );
+		const float* const floats = &i_boxes[0].m_min.x;
+		__m128 mins[4], maxs[4];
+		for ( unsigned int i = 0; i < 4; ++i )
+		{
+			// Each box's minimum is loaded with the first float of its maximum in the unused lane,
+			// and its maximum is loaded starting one float early (so that nothing past the last box is read)
+			// and then shifted down
+			const float* const box = floats + ( i * 6 );
+			mins[i] = _mm_loadu_ps( box );
+			const __m128 max = _mm_loadu_ps( box + 2 );
+			maxs[i] = _mm_shuffle_ps( max, max, _MM_SHUFFLE( 3, 3, 2, 1 ) );
+		}
+		_MM_TRANSPOSE4_PS( mins[0], mins[1], mins[2], mins[3] );
+		_MM_TRANSPOSE4_PS( maxs[0], maxs[1], maxs[2], maxs[3] );
+		o_min_x = mins[0]; o_min_y = mins[1]; o_min_z = mins[2];
+		o_max_x = maxs[0]; o_max_y = maxs[1]; o_max_z = maxs[2];
+	}
+
+#if defined( __AVX__ )
+	void LoadBoxes8( const eae6320::Math::sAABB* const i_boxes,
+		__m256& o_min_x, __m256& o_min_y, __m256& o_min_z, __m256& o_max_x, __m256& o_max_y, __m256& o_max_z )
+	{
+		__m128 low[6], high[6];
+		LoadBoxes4( i_boxes, low[0], low[1], low[2], low[3], low[4], low[5] );
+		LoadBoxes4( i_boxes + 4, high[0], high[1], high[2], high[3], high[4], high[5] );
+		__m256* const outputs[] = { &o_min_x, &o_min_y, &o_min_z, &o_max_x, &o_max_y, &o_max_z };
+		for ( unsigned int i = 0; i < 6; ++i )
+		{
+			*outputs[i] = _mm256_insertf128_ps( _mm256_castps128_ps256( low[i] ), high[i], 1 );
+		}
+	}
+#endif
+}
@@ -0,0 +1,146 @@
+/*
+	This file contains the simple shapes used to bound geometry
+	(boxes, spheres, planes, frustums, and rays)
+	and the tests between them
+
+	Physics, the octree, rendering, and the tools all share these
+	so that there is only one implementation of each test.
+	The batched functions test 4 (SSE) or 8 (AVX) boxes with a single call
+	and return a bit mask with one bit per box.
+*/
+
+#ifndef EAE6320_MATH_BOUNDINGVOLUMES_H
+#define EAE6320_MATH_BOUNDINGVOLUMES_H
+
+// Header Files
+//=============
+
+#include <cstddef>
+#include <cstdint>
+#include "cVector.h"
+
+// Forward Declarations
+//=====================
+
+namespace eae6320
+{
+	namespace Math
+	{
+		class cMatrix_transformation;
+	}
+}
+
+// Struct Declarations
+//====================
+
+namespace eae6320
+{
+	namespace Math
+	{
+		// An axis-aligned bounding box
+		struct sAABB
+		{
+			cVector m_min;
+			cVector m_max;
+
+			cVector GetCenter() const;
+			cVector GetHalfExtents() const;
+			bool Contains( const cVector& i_point ) const;
+			// Grows the box (if necessary) so that it contains the point
+			void Expand( const cVector& i_point );
+
+			static sAABB CreateFromCenterAndHalfExtents( const cVector& i_center, const cVector& i_halfExtents );
+			static sAABB CreateFromPoints( const cVector* const i_points, const size_t i_pointCount );
+			// Returns the smallest box that contains the transformed box
+			// (which is larger than the box itself whenever the transform has a rotation)
+			static sAABB CreateFromTransformedBox( const sAABB& i_box, const cMatrix_transformation& i_transform );
+		};
+
+		struct sSphere
+		{
+			cVector m_center;
+			float m_radius;
+		};
+
+		// A point p is on the plane when Dot( m_normal, p ) + m_distance == 0,
+		// and is in front of the plane (on the side the normal points to) when it is positive
+		struct sPlane
+		{
+			cVector m_normal;
+			float m_distance;
+
+			float GetSignedDistance( const cVector& i_point ) const;
+
+			static sPlane CreateFromPointAndNormal( const cVector& i_point, const cVector& i_normal_normalized );
+		};
+
+		// The planes' normals all point inwards,
+		// and so a point is inside the frustum when it is in front of every plane
+		struct sFrustum
+		{
+			enum ePlane
+			{
+				Left, Right, Bottom, Top, Near, Far,
+				PlaneCount
+			};
+			sPlane m_planes[PlaneCount];
+
+			// The transform is the product of the world-to-camera and camera-to-screen transforms
+			// (or just camera-to-screen to get a frustum in camera space)
+			static sFrustum CreateFromTransform( const cMatrix_transformation& i_transform_worldToScreen );
+		};
+
+		struct sRay
+		{
+			cVector m_origin;
+			cVector m_direction;	// This doesn't need to be normalized; distances are in multiples of its length
+		};
+
+		// The result of classifying a shape against a frustum
+		enum eContainment
+		{
+			Outside,
+			Intersecting,
+			Inside,
+		};
+	}
+}
+
+// Interface
+//==========
+
+namespace eae6320
+{
+	namespace Math
+	{
+		// Overlap Tests
+		//--------------
+
+		bool Overlaps( const sAABB& i_lhs, const sAABB& i_rhs );
+		bool Overlaps( const sAABB& i_box, const sSphere& i_sphere );
+		bool Overlaps( const sSphere& i_lhs, const sSphere& i_rhs );
+		// Uses the separating axis test for a triangle and a box
+		bool Overlaps( const sAABB& i_box, const cVector& i_vertex0, const cVector& i_vertex1, const cVector& i_vertex2 );
+		bool Overlaps( const sFrustum& i_frustum, const sSphere& i_sphere );
+		eContainment Classify( const sFrustum& i_frustum, const sAABB& i_box );
+
+		// The distance along the ray to the first intersection is returned in o_t
+		// (zero if the ray starts inside of the shape)
+		bool Intersects( const sRay& i_ray, const sAABB& i_box, float* const o_t = NULL );
+		bool Intersects( const sRay& i_ray, const sSphere& i_sphere, float* const o_t = NULL );
+
+		// Batched Tests
+		//--------------
+
+		// Bit i of the returned mask is set if i_boxes[i] overlaps the frustum.
+		// If o_insideMask is provided bit i of it is set if the box is entirely inside the frustum
+		// (in which case none of its children need to be tested).
+		uint32_t Overlaps4( const sFrustum& i_frustum, const sAABB* const i_boxes, uint32_t* const o_insideMask = NULL );
+		uint32_t Overlaps8( const sFrustum& i_frustum, const sAABB* const i_boxes, uint32_t* const o_insideMask = NULL );
+		// Bit i of the returned mask is set if i_boxes[i] overlaps the sphere
+		uint32_t Overlaps4( const sSphere& i_sphere, const sAABB* const i_boxes );
+		uint32_t Overlaps8( const sSphere& i_sphere, const sAABB* const i_boxes );
+	}
+}
+
+#endif	// EAE6320_MATH_BOUNDINGVOLUMES_H
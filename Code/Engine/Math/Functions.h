@@ -5,6 +5,30 @@
 #ifndef EAE6320_MATH_FUNCTIONS_H
 #define EAE6320_MATH_FUNCTIONS_H
 
+// Header Files
+//=============
+
+#include <cstddef>
+
+// Struct Declarations
+//====================
+
+namespace eae6320
+{
+	namespace Math
+	{
+		// The sine and cosine of each of ( tSegmentCount + 1 ) evenly-spaced angles
+		// from zero to a range (inclusive).
+		// Since it is a literal type a table can be created at compile time with CreateSinCosTable()
+		template<size_t tSegmentCount>
+			struct sSinCosTable
+		{
+			float sines[tSegmentCount + 1];
+			float cosines[tSegmentCount + 1];
+		};
+	}
+}
+
 namespace eae6320
 {
 	namespace Math
@@ -12,15 +36,25 @@ namespace eae6320
 		// Interface
 		//==========
 
-		extern const float Pi;
+		constexpr float Pi = 3.141592654f;
 
-		float ConvertDegreesToRadians( const float i_degrees );
-		float ConvertRadiansToDegrees(const float i_radians);
+		constexpr float ConvertDegreesToRadians( const float i_degrees );
+		constexpr float ConvertRadiansToDegrees( const float i_radians );
 		template<typename tUnsignedInteger>
 			tUnsignedInteger RoundUpToMultiple( const tUnsignedInteger i_value, const tUnsignedInteger i_multiple );
 		template<typename tUnsignedInteger>
 			tUnsignedInteger RoundUpToMultiple_powerOf2( const tUnsignedInteger i_value,
 				const tUnsignedInteger i_multipleWhichIsAPowerOf2 );
+
+		// Compile-Time Trigonometry
+		//--------------------------
+
+		// These are accurate to a float's precision but are much slower than std::sin() and std::cos(),
+		// and so they should only be used to initialize constants
+		constexpr float Sin_compileTime( const float i_angleInRadians );
+		constexpr float Cos_compileTime( const float i_angleInRadians );
+		template<size_t tSegmentCount>
+			constexpr sSinCosTable<tSegmentCount> CreateSinCosTable( const float i_rangeInRadians );
 	}
 }
 
@@ -6,11 +6,43 @@
 
 #include "Functions.h"
 
+#include <utility>
 #include "../Asserts/Asserts.h"
 
+// Helper Function Declarations
+//=============================
+
+namespace eae6320
+{
+	namespace Math
+	{
+		namespace FunctionsImplementation
+		{
+			// A constexpr function in C++11 can only have a single return statement,
+			// and so these are written recursively
+			constexpr double WrapAngle( const double i_angleInRadians );
+			constexpr double Sin( const double i_angleInRadians_wrapped );
+			constexpr double Cos( const double i_angleInRadians_wrapped );
+			constexpr double SumTaylorSeries( const double i_angleSquared, const double i_term, const double i_sum, const int i_power );
+			template<size_t tSegmentCount, size_t... tIndices>
+				constexpr sSinCosTable<tSegmentCount> CreateSinCosTable( const float i_rangeInRadians, std::index_sequence<tIndices...> );
+		}
+	}
+}
+
 // Implementation
 //===============
 
+constexpr float eae6320::Math::ConvertDegreesToRadians( const float i_degrees )
+{
+	return i_degrees * ( Pi / 180.0f );
+}
+
+constexpr float eae6320::Math::ConvertRadiansToDegrees( const float i_radians )
+{
+	return i_radians * ( 180.0f / Pi );
+}
+
 template<typename tUnsignedInteger>
 	tUnsignedInteger eae6320::Math::RoundUpToMultiple( const tUnsignedInteger i_value, const tUnsignedInteger i_multiple )
 {
@@ -42,4 +74,66 @@ template<typename tUnsignedInteger>
 	return returnValue;
 }
 
+// Compile-Time Trigonometry
+//--------------------------
+
+constexpr float eae6320::Math::Sin_compileTime( const float i_angleInRadians )
+{
+	return static_cast<float>( FunctionsImplementation::Sin( FunctionsImplementation::WrapAngle( i_angleInRadians ) ) );
+}
+
+constexpr float eae6320::Math::Cos_compileTime( const float i_angleInRadians )
+{
+	return static_cast<float>( FunctionsImplementation::Cos( FunctionsImplementation::WrapAngle( i_angleInRadians ) ) );
+}
+
+template<size_t tSegmentCount>
+	constexpr eae6320::Math::sSinCosTable<tSegmentCount> eae6320::Math::CreateSinCosTable( const float i_rangeInRadians )
+{
+	return FunctionsImplementation::CreateSinCosTable<tSegmentCount>( i_rangeInRadians, std::make_index_sequence<tSegmentCount + 1>() );
+}
+
+// Helper Function Definitions
+//============================
+
+constexpr double eae6320::Math::FunctionsImplementation::WrapAngle( const double i_angleInRadians )
+{
+	// The angle is moved into [-pi, pi] (by subtracting the nearest multiple of 2 pi)
+	// where only a few terms of the series are needed
+	return i_angleInRadians - ( 6.283185307179586 * static_cast<double>( static_cast<long long>(
+		( i_angleInRadians / 6.283185307179586 ) + ( ( i_angleInRadians >= 0.0 ) ? 0.5 : -0.5 ) ) ) );
+}
+
+constexpr double eae6320::Math::FunctionsImplementation::Sin( const double i_angleInRadians_wrapped )
+{
+	return SumTaylorSeries( i_angleInRadians_wrapped * i_angleInRadians_wrapped, i_angleInRadians_wrapped, i_angleInRadians_wrapped, 1 );
+}
+
+constexpr double eae6320::Math::FunctionsImplementation::Cos( const double i_angleInRadians_wrapped )
+{
+	return SumTaylorSeries( i_angleInRadians_wrapped * i_angleInRadians_wrapped, 1.0, 1.0, 0 );
+}
+
+constexpr double eae6320::Math::FunctionsImplementation::SumTaylorSeries( const double i_angleSquared,
+	const double i_term, const double i_sum, const int i_power )
+{
+	// Each term of the sine (odd powers) or cosine (even powers) series is calculated from the previous one:
+	//	term(n + 2) = -term(n) * x^2 / ( (n + 1) * (n + 2) )
+	// After x^25 the terms are too small to change a double when |x| <= pi
+	return ( i_power >= 25 ) ? i_sum :
+		SumTaylorSeries( i_angleSquared,
+			-i_term * i_angleSquared / static_cast<double>( ( i_power + 1 ) * ( i_power + 2 ) ),
+			i_sum - ( i_term * i_angleSquared / static_cast<double>( ( i_power + 1 ) * ( i_power + 2 ) ) ),
+			i_power + 2 );
+}
+
+template<size_t tSegmentCount, size_t... tIndices>
+	constexpr eae6320::Math::sSinCosTable<tSegmentCount> eae6320::Math::FunctionsImplementation::CreateSinCosTable(
+		const float i_rangeInRadians, std::index_sequence<tIndices...> )
+{
+	return sSinCosTable<tSegmentCount>{
+		{ Sin_compileTime( i_rangeInRadians * static_cast<float>( tIndices ) / static_cast<float>( tSegmentCount ) )... },
+		{ Cos_compileTime( i_rangeInRadians * static_cast<float>( tIndices ) / static_cast<float>( tSegmentCount ) )... } };
+}
+
 #endif	// EAE6320_MATH_FUNCTIONS_INL
\ No newline at end of file
@@ -0,0 +1,318 @@
+// Header Files
+//=============
+
+#include "Quantization.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include "BoundingVolumes.h"
+#include "cQuaternion.h"
+#include "cVector.h"
+#include "../Asserts/Asserts.h"
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	// Maps [-1, 1] to [0, maxValue] (and back), rounding to the nearest value
+	uint32_t EncodeSignedFraction( const float i_value, const uint32_t i_maxValue );
+	float DecodeSignedFraction( const uint32_t i_encodedValue, const uint32_t i_maxValue );
+
+	// Projects a unit vector onto the octahedron |x| + |y| + |z| = 1
+	// and unfolds the bottom half over the top, giving x and y in [-1, 1]
+	void ProjectOntoOctahedron( const eae6320::Math::cVector& i_vector_normalized, float& o_x, float& o_y );
+	eae6320::Math::cVector UnprojectFromOctahedron( const float i_x, const float i_y );
+	// Rounding x and y separately isn't always closest once they are unprojected
+	// (near the corners of the folded bottom half it is almost a degree off with 8 bits each),
+	// and so this chooses whichever of the four surrounding values decodes closest to the vector
+	void EncodeOctahedron( const eae6320::Math::cVector& i_vector_normalized, const uint32_t i_maxValue, uint32_t& o_x, uint32_t& o_y );
+}
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+	// The three smallest components of a normalized quaternion
+	// can never be larger than this
+	const float s_smallestThreeRange = 0.707106781f;
+	const uint32_t s_smallestThreeBitCount = 10;
+	const uint32_t s_smallestThreeMaxValue = ( 1u << s_smallestThreeBitCount ) - 1;
+}
+
+// Interface
+//==========
+
+// Positions
+//----------
+
+eae6320::Math::sQuantizedPosition eae6320::Math::QuantizePosition( const cVector& i_position, const sAABB& i_bounds )
+{
+	const float position[] = { i_position.x, i_position.y, i_position.z };
+	const float boundsMin[] = { i_bounds.m_min.x, i_bounds.m_min.y, i_bounds.m_min.z };
+	const float boundsMax[] = { i_bounds.m_max.x, i_bounds.m_max.y, i_bounds.m_max.z };
+	uint16_t quantized[3];
+	for ( unsigned int i = 0; i < 3; ++i )
+	{
+		// This is calculated with doubles so that it rounds to the nearest step
+		// (a float fraction times 65535 can be off by a hundredth of a step)
+		const double extent = static_cast<double>( boundsMax[i] ) - boundsMin[i];
+		EAE6320_ASSERTF( extent > 0.0, "The bounds must have a positive size on every axis" );
+		const double fraction = std::min( std::max( ( static_cast<double>( position[i] ) - boundsMin[i] ) / extent, 0.0 ), 1.0 );
+		quantized[i] = static_cast<uint16_t>( ( fraction * 65535.0 ) + 0.5 );
+	}
+	const sQuantizedPosition result = { quantized[0], quantized[1], quantized[2] };
+	return result;
+}
+
+eae6320::Math::cVector eae6320::Math::DequantizePosition( const sQuantizedPosition& i_position, const sAABB& i_bounds )
+{
+	const cVector extent = i_bounds.m_max - i_bounds.m_min;
+	return cVector(
+		i_bounds.m_min.x + ( extent.x * ( static_cast<float>( i_position.x ) / 65535.0f ) ),
+		i_bounds.m_min.y + ( extent.y * ( static_cast<float>( i_position.y ) / 65535.0f ) ),
+		i_bounds.m_min.z + ( extent.z * ( static_cast<float>( i_position.z ) / 65535.0f ) ) );
+}
+
+// Unit Vectors
+//-------------
+
+uint32_t eae6320::Math::EncodeUnitVector_32( const cVector& i_vector_normalized )
+{
+	uint32_t x, y;
+	EncodeOctahedron( i_vector_normalized, 0xffff, x, y );
+	return ( x << 16 ) | y;
+}
+
+eae6320::Math::cVector eae6320::Math::DecodeUnitVector_32( const uint32_t i_encodedVector )
+{
+	return UnprojectFromOctahedron(
+		DecodeSignedFraction( i_encodedVector >> 16, 0xffff ), DecodeSignedFraction( i_encodedVector & 0xffff, 0xffff ) );
+}
+
+uint16_t eae6320::Math::EncodeUnitVector_16( const cVector& i_vector_normalized )
+{
+	uint32_t x, y;
+	EncodeOctahedron( i_vector_normalized, 0xff, x, y );
+	return static_cast<uint16_t>( ( x << 8 ) | y );
+}
+
+eae6320::Math::cVector eae6320::Math::DecodeUnitVector_16( const uint16_t i_encodedVector )
+{
+	return UnprojectFromOctahedron(
+		DecodeSignedFraction( i_encodedVector >> 8, 0xff ), DecodeSignedFraction( i_encodedVector & 0xff, 0xff ) );
+}
+
+// Rotations
+//----------
+
+uint32_t eae6320::Math::EncodeRotation( const cQuaternion& i_rotation_normalized )
+{
+	const float components[] = { i_rotation_normalized.m_w, i_rotation_normalized.m_x, i_rotation_normalized.m_y, i_rotation_normalized.m_z };
+	uint32_t largestIndex = 0;
+	for ( uint32_t i = 1; i < 4; ++i )
+	{
+		if ( std::abs( components[i] ) > std::abs( components[largestIndex] ) )
+		{
+			largestIndex = i;
+		}
+	}
+	// q and -q are the same rotation,
+	// and so the quaternion is negated if necessary to make the missing component positive
+	const float sign = ( components[largestIndex] < 0.0f ) ? -1.0f : 1.0f;
+	uint32_t result = largestIndex << ( 3 * s_smallestThreeBitCount );
+	uint32_t shift = 2 * s_smallestThreeBitCount;
+	for ( uint32_t i = 0; i < 4; ++i )
+	{
+		if ( i != largestIndex )
+		{
+			result |= EncodeSignedFraction( ( components[i] * sign ) / s_smallestThreeRange, s_smallestThreeMaxValue ) << shift;
+			shift -= s_smallestThreeBitCount;
+		}
+	}
+	return result;
+}
+
+eae6320::Math::cQuaternion eae6320::Math::DecodeRotation( const uint32_t i_encodedRotation )
+{
+	const uint32_t largestIndex = i_encodedRotation >> ( 3 * s_smallestThreeBitCount );
+	float components[4];
+	float sumOfSquares = 0.0f;
+	uint32_t shift = 2 * s_smallestThreeBitCount;
+	for ( uint32_t i = 0; i < 4; ++i )
+	{
+		if ( i != largestIndex )
+		{
+			components[i] = DecodeSignedFraction( ( i_encodedRotation >> shift ) & s_smallestThreeMaxValue, s_smallestThreeMaxValue )
+				* s_smallestThreeRange;
+			sumOfSquares += components[i] * components[i];
+			shift -= s_smallestThreeBitCount;
+		}
+	}
+	components[largestIndex] = std::sqrt( std::max( 1.0f - sumOfSquares, 0.0f ) );
+	cQuaternion result;
+	result.m_w = components[0];
+	result.m_x = components[1];
+	result.m_y = components[2];
+	result.m_z = components[3];
+	// Rounding means that the decoded components don't quite have a length of one
+	result.Normalize();
+	return result;
+}
+
+// Half Floats
+//------------
+
+uint16_t eae6320::Math::EncodeHalfFloat( const float i_value )
+{
+	uint32_t bits;
+	memcpy( &bits, &i_value, sizeof( bits ) );
+	const uint16_t sign = static_cast<uint16_t>( ( bits >> 16 ) & 0x8000 );
+	const uint32_t absoluteBits = bits & 0x7fffffff;
+	// NaN stays NaN
+	if ( absoluteBits > 0x7f800000 )
+	{
+		return sign | 0x7e00;
+	}
+	const int exponent = static_cast<int>( absoluteBits >> 23 ) - 127 + 15;
+	uint32_t mantissa = absoluteBits & 0x7fffff;
+	if ( exponent >= 31 )
+	{
+		// Too large (or already infinite)
+		return sign | 0x7c00;
+	}
+	else if ( exponent <= 0 )
+	{
+		// Too small to be normalized
+		if ( exponent < -10 )
+		{
+			return sign;
+		}
+		mantissa |= 0x800000;
+		const uint32_t shift = static_cast<uint32_t>( 14 - exponent );
+		uint32_t result = mantissa >> shift;
+		// Round to nearest
+		if ( ( mantissa >> ( shift - 1 ) ) & 1 )
+		{
+			++result;
+		}
+		return sign | static_cast<uint16_t>( result );
+	}
+	else
+	{
+		uint32_t result = ( static_cast<uint32_t>( exponent ) << 10 ) | ( mantissa >> 13 );
+		// Round to nearest
+		// (if the mantissa overflows it carries into the exponent, which is still correct)
+		if ( mantissa & 0x1000 )
+		{
+			++result;
+		}
+		return sign | static_cast<uint16_t>( result );
+	}
+}
+
+float eae6320::Math::DecodeHalfFloat( const uint16_t i_encodedValue )
+{
+	const uint32_t sign = static_cast<uint32_t>( i_encodedValue & 0x8000 ) << 16;
+	const uint32_t exponent = ( i_encodedValue >> 10 ) & 0x1f;
+	const uint32_t mantissa = i_encodedValue & 0x3ff;
+	float result;
+	if ( exponent == 0 )
+	{
+		// Zero or a denormalized number
+		result = std::ldexp( static_cast<float>( mantissa ), -24 );
+		return sign ? -result : result;
+	}
+	uint32_t bits;
+	if ( exponent == 31 )
+	{
+		// Infinity or NaN
+		bits = sign | 0x7f800000 | ( mantissa << 13 );
+	}
+	else
+	{
+		bits = sign | ( ( exponent - 15 + 127 ) << 23 ) | ( mantissa << 13 );
+	}
+	memcpy( &result, &bits, sizeof( result ) );
+	return result;
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	uint32_t EncodeSignedFraction( const float i_value, const uint32_t i_maxValue )
+	{
+		const float value_clamped = std::min( std::max( i_value, -1.0f ), 1.0f );
+		return static_cast<uint32_t>( ( ( ( value_clamped * 0.5f ) + 0.5f ) * static_cast<float>( i_maxValue ) ) + 0.5f );
+	}
+
+	float DecodeSignedFraction( const uint32_t i_encodedValue, const uint32_t i_maxValue )
+	{
+		return ( ( static_cast<float>( i_encodedValue ) / static_cast<float>( i_maxValue ) ) * 2.0f ) - 1.0f;
+	}
+
+	void ProjectOntoOctahedron( const eae6320::Math::cVector& i_vector_normalized, float& o_x, float& o_y )
+	{
+		const float l1Norm = std::abs( i_vector_normalized.x ) + std::abs( i_vector_normalized.y ) + std::abs( i_vector_normalized.z );
+		EAE6320_ASSERTF( l1Norm > 1.0e-9f, "A zero vector has no direction" );
+		const float x = i_vector_normalized.x / l1Norm;
+		const float y = i_vector_normalized.y / l1Norm;
+		if ( i_vector_normalized.z >= 0.0f )
+		{
+			o_x = x;
+			o_y = y;
+		}
+		else
+		{
+			// The bottom half is folded out over the diagonals
+			o_x = ( 1.0f - std::abs( y ) ) * ( ( x >= 0.0f ) ? 1.0f : -1.0f );
+			o_y = ( 1.0f - std::abs( x ) ) * ( ( y >= 0.0f ) ? 1.0f : -1.0f );
+		}
+	}
+
+	eae6320::Math::cVector UnprojectFromOctahedron( const float i_x, const float i_y )
+	{
+		eae6320::Math::cVector result( i_x, i_y, 1.0f - std::abs( i_x ) - std::abs( i_y ) );
+		if ( result.z < 0.0f )
+		{
+			// Undo the fold
+			const float fold = -result.z;
+			result.x += ( result.x >= 0.0f ) ? -fold : fold;
+			result.y += ( result.y >= 0.0f ) ? -fold : fold;
+		}
+		result.Normalize();
+		return result;
+	}
+
+	void EncodeOctahedron( const eae6320::Math::cVector& i_vector_normalized, const uint32_t i_maxValue, uint32_t& o_x, uint32_t& o_y )
+	{
+		float x, y;
+		ProjectOntoOctahedron( i_vector_normalized, x, y );
+		// The value below each coordinate (which the value above it is one more than)
+		const float maxValue = static_cast<float>( i_maxValue );
+		const uint32_t x_below = std::min( static_cast<uint32_t>( ( ( std::min( std::max( x, -1.0f ), 1.0f ) * 0.5f ) + 0.5f ) * maxValue ), i_maxValue - 1 );
+		const uint32_t y_below = std::min( static_cast<uint32_t>( ( ( std::min( std::max( y, -1.0f ), 1.0f ) * 0.5f ) + 0.5f ) * maxValue ), i_maxValue - 1 );
+		// The distance is compared rather than the dot product
+		// because a float dot product can't tell apart directions this close together
+		float closestDistanceSquared = std::numeric_limits<float>::max();
+		for ( uint32_t i = 0; i < 4; ++i )
+		{
+			const uint32_t x_candidate = x_below + ( i & 1 );
+			const uint32_t y_candidate = y_below + ( i >> 1 );
+			const eae6320::Math::cVector difference = UnprojectFromOctahedron(
+				DecodeSignedFraction( x_candidate, i_maxValue ), DecodeSignedFraction( y_candidate, i_maxValue ) ) - i_vector_normalized;
+			const float distanceSquared = Dot( difference, difference );
+			if ( distanceSquared < closestDistanceSquared )
+			{
+				closestDistanceSquared = distanceSquared;
+				o_x = x_candidate;
+				o_y = y_candidate;
+			}
+		}
+	}
+}
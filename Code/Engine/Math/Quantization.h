@@ -0,0 +1,107 @@
+/*
+	This file contains compact fixed-point encodings of vectors and rotations
+	for storage and network messages, where full 32-bit floats aren't needed
+
+	Every encoding rounds to the nearest representable value.
+	The error bounds below were measured over millions of random inputs
+	(and are checked by Tests/Quantization):
+		* Positions: each component is within half of a step of the original
+			(plus float rounding), where a step is ( bounds max - bounds min ) / 65535 on that axis.
+			For example, bounds 8192 units wide give steps of 0.125 units and an error of about 0.0625 units.
+			Encoding a decoded position always gives back the same bits,
+			and so a position that is re-sent doesn't drift,
+			as long as a step is at least twice the float precision of the bounds' coordinates
+			(for bounds within 8192 units of the origin a step must be at least 1/1024 units,
+			which means that the bounds must be at least 64 units wide).
+		* Unit vectors (octahedral):
+			* 32 bits: less than 0.003 degrees from the original direction
+			* 16 bits: less than 0.65 degrees from the original direction
+		* Rotations (smallest three in 32 bits):
+			less than 0.26 degrees from the original rotation
+		* Half floats: within 1/2048 of the original value (relative to its size),
+			and exact for integers up to 2048.
+			Values too large for a half float become infinity.
+*/
+
+#ifndef EAE6320_MATH_QUANTIZATION_H
+#define EAE6320_MATH_QUANTIZATION_H
+
+// Header Files
+//=============
+
+#include <cstdint>
+
+// Forward Declarations
+//=====================
+
+namespace eae6320
+{
+	namespace Math
+	{
+		class cQuaternion;
+		class cVector;
+		struct sAABB;
+	}
+}
+
+// Struct Declarations
+//====================
+
+namespace eae6320
+{
+	namespace Math
+	{
+		// Each component is a 16-bit fraction of the way from the bounds' minimum to its maximum
+		struct sQuantizedPosition
+		{
+			uint16_t x, y, z;
+		};
+	}
+}
+
+// Interface
+//==========
+
+namespace eae6320
+{
+	namespace Math
+	{
+		// Positions
+		//----------
+
+		// Positions outside of the bounds are clamped to the bounds
+		sQuantizedPosition QuantizePosition( const cVector& i_position, const sAABB& i_bounds );
+		cVector DequantizePosition( const sQuantizedPosition& i_position, const sAABB& i_bounds );
+
+		// Unit Vectors
+		//-------------
+
+		// The vector is projected onto an octahedron which is then unfolded into a square,
+		// and so every representable direction is spread (nearly) evenly over the sphere
+		uint32_t EncodeUnitVector_32( const cVector& i_vector_normalized );
+		cVector DecodeUnitVector_32( const uint32_t i_encodedVector );
+		uint16_t EncodeUnitVector_16( const cVector& i_vector_normalized );
+		cVector DecodeUnitVector_16( const uint16_t i_encodedVector );
+
+		// Rotations
+		//----------
+
+		// The largest component isn't stored; it is recalculated from the other three
+		// (which must then be between -1/sqrt(2) and 1/sqrt(2)).
+		// The top 2 bits are the index of the largest component
+		// and each of the other three uses 10 bits.
+		uint32_t EncodeRotation( const cQuaternion& i_rotation_normalized );
+		cQuaternion DecodeRotation( const uint32_t i_encodedRotation );
+
+		// Half Floats
+		//------------
+
+		// These are IEEE 754 16-bit floats
+		// (1 sign bit, 5 exponent bits, and 10 mantissa bits),
+		// which graphics hardware can read directly
+		uint16_t EncodeHalfFloat( const float i_value );
+		float DecodeHalfFloat( const uint16_t i_encodedValue );
+	}
+}
+
+#endif	// EAE6320_MATH_QUANTIZATION_H
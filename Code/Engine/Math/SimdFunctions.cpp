@@ -0,0 +1,129 @@
+// Header Files
+//=============
+
+#include "SimdFunctions.h"
+
+#include <cstring>
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+#if defined( __AVX__ )
+	typedef eae6320::Math::SimdInternal::sLanes8 tLanes;
+#else
+	typedef eae6320::Math::SimdInternal::sLanes4 tLanes;
+#endif
+	typedef tLanes::tVector tVector;
+	const size_t s_laneCount = sizeof( tVector ) / sizeof( float );
+}
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	void Normalize( tVector& io_x, tVector& io_y, tVector& io_z, const eae6320::Math::eAccuracy i_accuracy );
+}
+
+// Interface
+//==========
+
+// Arrays
+//-------
+
+void eae6320::Math::SinCos( const float* const i_anglesInRadians, float* const o_sines, float* const o_cosines, const size_t i_count,
+	const eAccuracy i_accuracy )
+{
+	size_t i = 0;
+	for ( ; ( i + s_laneCount ) <= i_count; i += s_laneCount )
+	{
+		tVector sines, cosines;
+		SimdInternal::SinCos<tLanes>( tLanes::Load( i_anglesInRadians + i ), sines, cosines, i_accuracy );
+		tLanes::Store( o_sines + i, sines );
+		tLanes::Store( o_cosines + i, cosines );
+	}
+	if ( i < i_count )
+	{
+		// The remaining values are copied into a full register's worth
+		const size_t remainingCount = i_count - i;
+		float angles[s_laneCount] = {}, sines[s_laneCount], cosines[s_laneCount];
+		std::memcpy( angles, i_anglesInRadians + i, remainingCount * sizeof( float ) );
+		tVector sines_lanes, cosines_lanes;
+		SimdInternal::SinCos<tLanes>( tLanes::Load( angles ), sines_lanes, cosines_lanes, i_accuracy );
+		tLanes::Store( sines, sines_lanes );
+		tLanes::Store( cosines, cosines_lanes );
+		std::memcpy( o_sines + i, sines, remainingCount * sizeof( float ) );
+		std::memcpy( o_cosines + i, cosines, remainingCount * sizeof( float ) );
+	}
+}
+
+void eae6320::Math::Acos( const float* const i_values, float* const o_angles, const size_t i_count, const eAccuracy i_accuracy )
+{
+	size_t i = 0;
+	for ( ; ( i + s_laneCount ) <= i_count; i += s_laneCount )
+	{
+		tLanes::Store( o_angles + i, SimdInternal::Acos<tLanes>( tLanes::Load( i_values + i ), i_accuracy ) );
+	}
+	if ( i < i_count )
+	{
+		const size_t remainingCount = i_count - i;
+		float values[s_laneCount] = {}, angles[s_laneCount];
+		std::memcpy( values, i_values + i, remainingCount * sizeof( float ) );
+		tLanes::Store( angles, SimdInternal::Acos<tLanes>( tLanes::Load( values ), i_accuracy ) );
+		std::memcpy( o_angles + i, angles, remainingCount * sizeof( float ) );
+	}
+}
+
+void eae6320::Math::NormalizeVectors( float* const io_vectors, const size_t i_count, const eAccuracy i_accuracy )
+{
+	float* const x = io_vectors;
+	float* const y = io_vectors + i_count;
+	float* const z = io_vectors + ( 2 * i_count );
+	size_t i = 0;
+	for ( ; ( i + s_laneCount ) <= i_count; i += s_laneCount )
+	{
+		tVector vector_x = tLanes::Load( x + i ), vector_y = tLanes::Load( y + i ), vector_z = tLanes::Load( z + i );
+		Normalize( vector_x, vector_y, vector_z, i_accuracy );
+		tLanes::Store( x + i, vector_x );
+		tLanes::Store( y + i, vector_y );
+		tLanes::Store( z + i, vector_z );
+	}
+	if ( i < i_count )
+	{
+		// The remaining vectors are padded with zero vectors
+		const size_t remainingCount = i_count - i;
+		float components[3][s_laneCount] = {};
+		std::memcpy( components[0], x + i, remainingCount * sizeof( float ) );
+		std::memcpy( components[1], y + i, remainingCount * sizeof( float ) );
+		std::memcpy( components[2], z + i, remainingCount * sizeof( float ) );
+		tVector vector_x = tLanes::Load( components[0] ), vector_y = tLanes::Load( components[1] ), vector_z = tLanes::Load( components[2] );
+		Normalize( vector_x, vector_y, vector_z, i_accuracy );
+		tLanes::Store( components[0], vector_x );
+		tLanes::Store( components[1], vector_y );
+		tLanes::Store( components[2], vector_z );
+		std::memcpy( x + i, components[0], remainingCount * sizeof( float ) );
+		std::memcpy( y + i, components[1], remainingCount * sizeof( float ) );
+		std::memcpy( z + i, components[2], remainingCount * sizeof( float ) );
+	}
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	void Normalize( tVector& io_x, tVector& io_y, tVector& io_z, const eae6320::Math::eAccuracy i_accuracy )
+	{
+		const tVector lengthSquared = tLanes::Add( tLanes::Add( tLanes::Mul( io_x, io_x ), tLanes::Mul( io_y, io_y ) ),
+			tLanes::Mul( io_z, io_z ) );
+		// The reciprocal square root of zero is infinite,
+		// and so it is replaced with zero to keep zero vectors zero
+		const tVector length_reciprocal = tLanes::Select( tLanes::CmpGt( lengthSquared, tLanes::Set1( 1.0e-18f ) ),
+			eae6320::Math::SimdInternal::Rsqrt<tLanes>( lengthSquared, i_accuracy ), tLanes::Set1( 0.0f ) );
+		io_x = tLanes::Mul( io_x, length_reciprocal );
+		io_y = tLanes::Mul( io_y, length_reciprocal );
+		io_z = tLanes::Mul( io_z, length_reciprocal );
+	}
+}
@@ -0,0 +1,328 @@
+#ifndef EAE6320_MATH_SIMDFUNCTIONS_INL
+#define EAE6320_MATH_SIMDFUNCTIONS_INL
+
+// Header Files
+//=============
+
+#include "SimdFunctions.h"
+
+// Helper Function Definitions
+//============================
+
+namespace eae6320
+{
+	namespace Math
+	{
+		namespace SimdInternal
+		{
+			// Lane Types
+			//-----------
+
+			// Each kernel below is written once in terms of these operations
+			// and is then instantiated for both 4 and 8 lanes
+
+			struct sLanes4
+			{
+				typedef __m128 tVector;
+
+				static tVector Set1( const float i_value ) { return _mm_set1_ps( i_value ); }
+				// The pointers don't need to be aligned
+				static tVector Load( const float* const i_values ) { return _mm_loadu_ps( i_values ); }
+				static void Store( float* const o_values, const tVector i_value ) { _mm_storeu_ps( o_values, i_value ); }
+				static tVector Add( const tVector i_lhs, const tVector i_rhs ) { return _mm_add_ps( i_lhs, i_rhs ); }
+				static tVector Sub( const tVector i_lhs, const tVector i_rhs ) { return _mm_sub_ps( i_lhs, i_rhs ); }
+				static tVector Mul( const tVector i_lhs, const tVector i_rhs ) { return _mm_mul_ps( i_lhs, i_rhs ); }
+				static tVector Div( const tVector i_lhs, const tVector i_rhs ) { return _mm_div_ps( i_lhs, i_rhs ); }
+				static tVector Min( const tVector i_lhs, const tVector i_rhs ) { return _mm_min_ps( i_lhs, i_rhs ); }
+				static tVector Max( const tVector i_lhs, const tVector i_rhs ) { return _mm_max_ps( i_lhs, i_rhs ); }
+				static tVector And( const tVector i_lhs, const tVector i_rhs ) { return _mm_and_ps( i_lhs, i_rhs ); }
+				static tVector Or( const tVector i_lhs, const tVector i_rhs ) { return _mm_or_ps( i_lhs, i_rhs ); }
+				static tVector Xor( const tVector i_lhs, const tVector i_rhs ) { return _mm_xor_ps( i_lhs, i_rhs ); }
+				static tVector Sqrt( const tVector i_value ) { return _mm_sqrt_ps( i_value ); }
+				static tVector Rsqrt( const tVector i_value ) { return _mm_rsqrt_ps( i_value ); }
+				// SSE2 has no rounding instruction,
+				// but the conversion to integers uses the default rounding mode (to nearest)
+				static tVector Round( const tVector i_value ) { return _mm_cvtepi32_ps( _mm_cvtps_epi32( i_value ) ); }
+				static tVector CmpEq( const tVector i_lhs, const tVector i_rhs ) { return _mm_cmpeq_ps( i_lhs, i_rhs ); }
+				static tVector CmpGt( const tVector i_lhs, const tVector i_rhs ) { return _mm_cmpgt_ps( i_lhs, i_rhs ); }
+				static tVector CmpGe( const tVector i_lhs, const tVector i_rhs ) { return _mm_cmpge_ps( i_lhs, i_rhs ); }
+				// Returns i_ifTrue in the lanes where i_mask is set and i_ifFalse in the others
+				static tVector Select( const tVector i_mask, const tVector i_ifTrue, const tVector i_ifFalse )
+				{
+					return _mm_or_ps( _mm_and_ps( i_mask, i_ifTrue ), _mm_andnot_ps( i_mask, i_ifFalse ) );
+				}
+			};
+
+#if defined( __AVX__ )
+			struct sLanes8
+			{
+				typedef __m256 tVector;
+
+				static tVector Set1( const float i_value ) { return _mm256_set1_ps( i_value ); }
+				static tVector Load( const float* const i_values ) { return _mm256_loadu_ps( i_values ); }
+				static void Store( float* const o_values, const tVector i_value ) { _mm256_storeu_ps( o_values, i_value ); }
+				static tVector Add( const tVector i_lhs, const tVector i_rhs ) { return _mm256_add_ps( i_lhs, i_rhs ); }
+				static tVector Sub( const tVector i_lhs, const tVector i_rhs ) { return _mm256_sub_ps( i_lhs, i_rhs ); }
+				static tVector Mul( const tVector i_lhs, const tVector i_rhs ) { return _mm256_mul_ps( i_lhs, i_rhs ); }
+				static tVector Div( const tVector i_lhs, const tVector i_rhs ) { return _mm256_div_ps( i_lhs, i_rhs ); }
+				static tVector Min( const tVector i_lhs, const tVector i_rhs ) { return _mm256_min_ps( i_lhs, i_rhs ); }
+				static tVector Max( const tVector i_lhs, const tVector i_rhs ) { return _mm256_max_ps( i_lhs, i_rhs ); }
+				static tVector And( const tVector i_lhs, const tVector i_rhs ) { return _mm256_and_ps( i_lhs, i_rhs ); }
+				static tVector Or( const tVector i_lhs, const tVector i_rhs ) { return _mm256_or_ps( i_lhs, i_rhs ); }
+				static tVector Xor( const tVector i_lhs, const tVector i_rhs ) { return _mm256_xor_ps( i_lhs, i_rhs ); }
+				static tVector Sqrt( const tVector i_value ) { return _mm256_sqrt_ps( i_value ); }
+				static tVector Rsqrt( const tVector i_value ) { return _mm256_rsqrt_ps( i_value ); }
+				static tVector Round( const tVector i_value ) { return _mm256_round_ps( i_value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC ); }
+				static tVector CmpEq( const tVector i_lhs, const tVector i_rhs ) { return _mm256_cmp_ps( i_lhs, i_rhs, _CMP_EQ_OQ ); }
+				static tVector CmpGt( const tVector i_lhs, const tVector i_rhs ) { return _mm256_cmp_ps( i_lhs, i_rhs, _CMP_GT_OQ ); }
+				static tVector CmpGe( const tVector i_lhs, const tVector i_rhs ) { return _mm256_cmp_ps( i_lhs, i_rhs, _CMP_GE_OQ ); }
+				// This is the same as sLanes4 instead of _mm256_blendv_ps()
+				// because GCC turns a blend whose mask is a comparison into a branch for each lane
+				static tVector Select( const tVector i_mask, const tVector i_ifTrue, const tVector i_ifFalse )
+				{
+					return _mm256_or_ps( _mm256_and_ps( i_mask, i_ifTrue ), _mm256_andnot_ps( i_mask, i_ifFalse ) );
+				}
+			};
+#endif
+
+			// Kernels
+			//--------
+
+			template<class tLanes>
+				inline void SinCos( const typename tLanes::tVector i_anglesInRadians,
+					typename tLanes::tVector& o_sines, typename tLanes::tVector& o_cosines, const eAccuracy i_accuracy )
+			{
+				typedef typename tLanes::tVector tVector;
+				// The angle is reduced to r in [-pi/4, pi/4] by subtracting the nearest multiple (k) of pi/2.
+				// pi/2 is split into three parts so that the first products are exact (Cody-Waite reduction);
+				// this is what limits the accurate range to |x| <= 8192
+				const tVector k = tLanes::Round( tLanes::Mul( i_anglesInRadians, tLanes::Set1( 0.636619772f ) ) );
+				tVector r = tLanes::Sub( i_anglesInRadians, tLanes::Mul( k, tLanes::Set1( 1.5703125f ) ) );
+				r = tLanes::Sub( r, tLanes::Mul( k, tLanes::Set1( 4.837512969970703125e-4f ) ) );
+				r = tLanes::Sub( r, tLanes::Mul( k, tLanes::Set1( 7.54978995489188216e-8f ) ) );
+				const tVector r2 = tLanes::Mul( r, r );
+				// The polynomials for [-pi/4, pi/4]
+				tVector sin_r, cos_r;
+				if ( i_accuracy == HighAccuracy )
+				{
+					// Minimax coefficients (from Cephes)
+					sin_r = tLanes::Add( tLanes::Set1( 8.3321608736e-3f ), tLanes::Mul( r2, tLanes::Set1( -1.9515295891e-4f ) ) );
+					sin_r = tLanes::Add( tLanes::Set1( -1.6666654611e-1f ), tLanes::Mul( r2, sin_r ) );
+					sin_r = tLanes::Add( r, tLanes::Mul( tLanes::Mul( r, r2 ), sin_r ) );
+					cos_r = tLanes::Add( tLanes::Set1( -1.388731625493765e-3f ), tLanes::Mul( r2, tLanes::Set1( 2.443315711809948e-5f ) ) );
+					cos_r = tLanes::Add( tLanes::Set1( 4.166664568298827e-2f ), tLanes::Mul( r2, cos_r ) );
+					cos_r = tLanes::Add( tLanes::Sub( tLanes::Set1( 1.0f ), tLanes::Mul( r2, tLanes::Set1( 0.5f ) ) ),
+						tLanes::Mul( tLanes::Mul( r2, r2 ), cos_r ) );
+				}
+				else
+				{
+					// Truncated Taylor series
+					sin_r = tLanes::Add( tLanes::Set1( -1.0f / 6.0f ), tLanes::Mul( r2, tLanes::Set1( 1.0f / 120.0f ) ) );
+					sin_r = tLanes::Add( r, tLanes::Mul( tLanes::Mul( r, r2 ), sin_r ) );
+					cos_r = tLanes::Add( tLanes::Set1( 1.0f / 24.0f ), tLanes::Mul( r2, tLanes::Set1( -1.0f / 720.0f ) ) );
+					cos_r = tLanes::Add( tLanes::Set1( -0.5f ), tLanes::Mul( r2, cos_r ) );
+					cos_r = tLanes::Add( tLanes::Set1( 1.0f ), tLanes::Mul( r2, cos_r ) );
+				}
+				// The quadrant (k mod 4, which is always in [0, 3])
+				// determines which polynomial is used for each result and whether it is negated
+				const tVector quadrant = tLanes::Sub( k, tLanes::Mul( tLanes::Set1( 4.0f ),
+					tLanes::Round( tLanes::Sub( tLanes::Mul( k, tLanes::Set1( 0.25f ) ), tLanes::Set1( 0.375f ) ) ) ) );
+				const tVector isQuadrant1 = tLanes::CmpEq( quadrant, tLanes::Set1( 1.0f ) );
+				const tVector isQuadrant2 = tLanes::CmpEq( quadrant, tLanes::Set1( 2.0f ) );
+				const tVector isQuadrant3 = tLanes::CmpEq( quadrant, tLanes::Set1( 3.0f ) );
+				const tVector shouldSwap = tLanes::Or( isQuadrant1, isQuadrant3 );
+				const tVector signBit = tLanes::Set1( -0.0f );
+				o_sines = tLanes::Xor( tLanes::Select( shouldSwap, cos_r, sin_r ),
+					tLanes::And( tLanes::Or( isQuadrant2, isQuadrant3 ), signBit ) );
+				o_cosines = tLanes::Xor( tLanes::Select( shouldSwap, sin_r, cos_r ),
+					tLanes::And( tLanes::Or( isQuadrant1, isQuadrant2 ), signBit ) );
+			}
+
+			template<class tLanes>
+				inline typename tLanes::tVector Acos( const typename tLanes::tVector i_values, const eAccuracy i_accuracy )
+			{
+				typedef typename tLanes::tVector tVector;
+				const tVector signBit = tLanes::Set1( -0.0f );
+				const tVector one = tLanes::Set1( 1.0f );
+				const tVector pi = tLanes::Set1( 3.14159265358979f );
+				const tVector sign = tLanes::And( i_values, signBit );
+				const tVector a = tLanes::Min( tLanes::Xor( i_values, sign ), one );
+				const tVector isNegative = tLanes::CmpGt( tLanes::Set1( 0.0f ), i_values );
+				if ( i_accuracy == HighAccuracy )
+				{
+					// asin() is calculated with a polynomial (from Cephes) that is accurate for [0, 0.5],
+					// and larger values use the identity acos(a) = 2 * asin( sqrt( (1 - a) / 2 ) )
+					const tVector isLarge = tLanes::CmpGt( a, tLanes::Set1( 0.5f ) );
+					const tVector z = tLanes::Select( isLarge, tLanes::Mul( tLanes::Sub( one, a ), tLanes::Set1( 0.5f ) ), tLanes::Mul( a, a ) );
+					const tVector s = tLanes::Select( isLarge, tLanes::Sqrt( z ), a );
+					tVector p = tLanes::Add( tLanes::Set1( 2.4181311049e-2f ), tLanes::Mul( z, tLanes::Set1( 4.2163199048e-2f ) ) );
+					p = tLanes::Add( tLanes::Set1( 4.5470025998e-2f ), tLanes::Mul( z, p ) );
+					p = tLanes::Add( tLanes::Set1( 7.4953002686e-2f ), tLanes::Mul( z, p ) );
+					p = tLanes::Add( tLanes::Set1( 1.6666752422e-1f ), tLanes::Mul( z, p ) );
+					const tVector asin_s = tLanes::Add( s, tLanes::Mul( tLanes::Mul( z, s ), p ) );
+					// Small values: acos(x) = pi/2 - asin(x)
+					const tVector result_small = tLanes::Sub( tLanes::Set1( 1.57079632679490f ), tLanes::Xor( asin_s, sign ) );
+					// Large values: acos(x) = 2 * asin(s), or pi - that if x is negative
+					const tVector acos_large = tLanes::Add( asin_s, asin_s );
+					const tVector result_large = tLanes::Select( isNegative, tLanes::Sub( pi, acos_large ), acos_large );
+					return tLanes::Select( isLarge, result_large, result_small );
+				}
+				else
+				{
+					// Abramowitz and Stegun 4.4.45
+					tVector p = tLanes::Add( tLanes::Set1( 0.0742610f ), tLanes::Mul( a, tLanes::Set1( -0.0187293f ) ) );
+					p = tLanes::Add( tLanes::Set1( -0.2121144f ), tLanes::Mul( a, p ) );
+					p = tLanes::Add( tLanes::Set1( 1.5707288f ), tLanes::Mul( a, p ) );
+					const tVector acos_a = tLanes::Mul( tLanes::Sqrt( tLanes::Sub( one, a ) ), p );
+					return tLanes::Select( isNegative, tLanes::Sub( pi, acos_a ), acos_a );
+				}
+			}
+
+			template<class tLanes>
+				inline typename tLanes::tVector Atan2( const typename tLanes::tVector i_y, const typename tLanes::tVector i_x,
+					const eAccuracy i_accuracy )
+			{
+				typedef typename tLanes::tVector tVector;
+				const tVector signBit = tLanes::Set1( -0.0f );
+				const tVector zero = tLanes::Set1( 0.0f );
+				const tVector sign_x = tLanes::And( i_x, signBit );
+				const tVector sign_y = tLanes::And( i_y, signBit );
+				const tVector x_abs = tLanes::Xor( i_x, sign_x );
+				const tVector y_abs = tLanes::Xor( i_y, sign_y );
+				// The calculation is done in the first octant (where the ratio is in [0, 1])
+				// and then reflected to the correct one
+				const tVector largest = tLanes::Max( x_abs, y_abs );
+				const tVector ratio = tLanes::Select( tLanes::CmpGt( largest, zero ),
+					tLanes::Div( tLanes::Min( x_abs, y_abs ), largest ), zero );
+				tVector result;
+				if ( i_accuracy == HighAccuracy )
+				{
+					// Ratios above tan(pi/8) are reduced using atan(a) = pi/4 + atan( (a - 1) / (a + 1) )
+					// so that the polynomial (from Cephes) is only needed for [-tan(pi/8), tan(pi/8)]
+					const tVector one = tLanes::Set1( 1.0f );
+					const tVector isLarge = tLanes::CmpGt( ratio, tLanes::Set1( 0.414213562f ) );
+					const tVector t = tLanes::Select( isLarge, tLanes::Div( tLanes::Sub( ratio, one ), tLanes::Add( ratio, one ) ), ratio );
+					const tVector z = tLanes::Mul( t, t );
+					tVector p = tLanes::Add( tLanes::Set1( -1.38776856032e-1f ), tLanes::Mul( z, tLanes::Set1( 8.05374449538e-2f ) ) );
+					p = tLanes::Add( tLanes::Set1( 1.99777106478e-1f ), tLanes::Mul( z, p ) );
+					p = tLanes::Add( tLanes::Set1( -3.33329491539e-1f ), tLanes::Mul( z, p ) );
+					result = tLanes::Add( tLanes::Add( t, tLanes::Mul( tLanes::Mul( z, t ), p ) ),
+						tLanes::And( isLarge, tLanes::Set1( 0.785398163397448f ) ) );
+				}
+				else
+				{
+					// Abramowitz and Stegun 4.4.49
+					const tVector z = tLanes::Mul( ratio, ratio );
+					tVector p = tLanes::Add( tLanes::Set1( -0.0851330f ), tLanes::Mul( z, tLanes::Set1( 0.0208351f ) ) );
+					p = tLanes::Add( tLanes::Set1( 0.1801410f ), tLanes::Mul( z, p ) );
+					p = tLanes::Add( tLanes::Set1( -0.3302995f ), tLanes::Mul( z, p ) );
+					p = tLanes::Add( tLanes::Set1( 0.9998660f ), tLanes::Mul( z, p ) );
+					result = tLanes::Mul( ratio, p );
+				}
+				result = tLanes::Select( tLanes::CmpGt( y_abs, x_abs ), tLanes::Sub( tLanes::Set1( 1.57079632679490f ), result ), result );
+				result = tLanes::Select( tLanes::CmpGt( zero, i_x ), tLanes::Sub( tLanes::Set1( 3.14159265358979f ), result ), result );
+				return tLanes::Xor( result, sign_y );
+			}
+
+			template<class tLanes>
+				inline typename tLanes::tVector Rsqrt( const typename tLanes::tVector i_values, const eAccuracy i_accuracy )
+			{
+				typedef typename tLanes::tVector tVector;
+				const tVector estimate = tLanes::Rsqrt( i_values );
+				if ( i_accuracy == HighAccuracy )
+				{
+					// One Newton-Raphson step: y' = y * ( 1.5 - 0.5 * x * y^2 )
+					const tVector halfX_y2 = tLanes::Mul( tLanes::Mul( tLanes::Set1( 0.5f ), i_values ), tLanes::Mul( estimate, estimate ) );
+					return tLanes::Mul( estimate, tLanes::Sub( tLanes::Set1( 1.5f ), halfX_y2 ) );
+				}
+				else
+				{
+					return estimate;
+				}
+			}
+		}
+	}
+}
+
+// Interface
+//==========
+
+// 4 Lanes
+//--------
+
+inline __m128 eae6320::Math::Sin4( const __m128 i_anglesInRadians, const eAccuracy i_accuracy )
+{
+	__m128 sines, cosines;
+	SimdInternal::SinCos<SimdInternal::sLanes4>( i_anglesInRadians, sines, cosines, i_accuracy );
+	return sines;
+}
+
+inline __m128 eae6320::Math::Cos4( const __m128 i_anglesInRadians, const eAccuracy i_accuracy )
+{
+	__m128 sines, cosines;
+	SimdInternal::SinCos<SimdInternal::sLanes4>( i_anglesInRadians, sines, cosines, i_accuracy );
+	return cosines;
+}
+
+inline void eae6320::Math::SinCos4( const __m128 i_anglesInRadians, __m128& o_sines, __m128& o_cosines, const eAccuracy i_accuracy )
+{
+	SimdInternal::SinCos<SimdInternal::sLanes4>( i_anglesInRadians, o_sines, o_cosines, i_accuracy );
+}
+
+inline __m128 eae6320::Math::Acos4( const __m128 i_values, const eAccuracy i_accuracy )
+{
+	return SimdInternal::Acos<SimdInternal::sLanes4>( i_values, i_accuracy );
+}
+
+inline __m128 eae6320::Math::Atan2_4( const __m128 i_y, const __m128 i_x, const eAccuracy i_accuracy )
+{
+	return SimdInternal::Atan2<SimdInternal::sLanes4>( i_y, i_x, i_accuracy );
+}
+
+inline __m128 eae6320::Math::Rsqrt4( const __m128 i_values, const eAccuracy i_accuracy )
+{
+	return SimdInternal::Rsqrt<SimdInternal::sLanes4>( i_values, i_accuracy );
+}
+
+// 8 Lanes
+//--------
+
+#if defined( __AVX__ )
+
+inline __m256 eae6320::Math::Sin8( const __m256 i_anglesInRadians, const eAccuracy i_accuracy )
+{
+	__m256 sines, cosines;
+	SimdInternal::SinCos<SimdInternal::sLanes8>( i_anglesInRadians, sines, cosines, i_accuracy );
+	return sines;
+}
+
+inline __m256 eae6320::Math::Cos8( const __m256 i_anglesInRadians, const eAccuracy i_accuracy )
+{
+	__m256 sines, cosines;
+	SimdInternal::SinCos<SimdInternal::sLanes8>( i_anglesInRadians, sines, cosines, i_accuracy );
+	return cosines;
+}
+
+inline void eae6320::Math::SinCos8( const __m256 i_anglesInRadians, __m256& o_sines, __m256& o_cosines, const eAccuracy i_accuracy )
+{
+	SimdInternal::SinCos<SimdInternal::sLanes8>( i_anglesInRadians, o_sines, o_cosines, i_accuracy );
+}
+
+inline __m256 eae6320::Math::Acos8( const __m256 i_values, const eAccuracy i_accuracy )
+{
+	return SimdInternal::Acos<SimdInternal::sLanes8>( i_values, i_accuracy );
+}
+
+inline __m256 eae6320::Math::Atan2_8( const __m256 i_y, const __m256 i_x, const eAccuracy i_accuracy )
+{
+	return SimdInternal::Atan2<SimdInternal::sLanes8>( i_y, i_x, i_accuracy );
+}
+
+inline __m256 eae6320::Math::Rsqrt8( const __m256 i_values, const eAccuracy i_accuracy )
+{
+	return SimdInternal::Rsqrt<SimdInternal::sLanes8>( i_values, i_accuracy );
+}
+
+#endif
+
+#endif	// EAE6320_MATH_SIMDFUNCTIONS_INL
@@ -4,8 +4,11 @@
 #include "cMatrix_transformation.h"
 
 #include <cmath>
+#include <cstring>
 #include "cQuaternion.h"
+#include "cSimdMatrix.h"
 #include "cVector.h"
+#include "../Asserts/Asserts.h"
 
 // Interface
 //==========
@@ -39,7 +42,9 @@ eae6320::Math::cMatrix_transformation eae6320::Math::cMatrix_transformation::Cre
 		0.0f, yScale, 0.0f, 0.0f,
 		0.0f, 0.0f, zDistanceScale, i_z_nearPlane * zDistanceScale,
 		0.0f, 0.0f, -1.0f, 0.0f );
-#elif defined( EAE6320_PLATFORM_GL )
+#elif defined( EAE6320_PLATFORM_GL ) || defined( EAE6320_PLATFORM_NULL )
+	// The null platform doesn't rasterize anything,
+	// and so it uses OpenGL's convention for the recorded matrices
 	const float zDistanceScale = 1.0f / ( i_z_nearPlane - i_z_farPlane );
 	return cMatrix_transformation(
 		xScale, 0.0f, 0.0f, 0.0f,
@@ -49,19 +54,269 @@ eae6320::Math::cMatrix_transformation eae6320::Math::cMatrix_transformation::Cre
 #endif
 }
 
-// Initialization / Shut Down
-//---------------------------
+eae6320::Math::cMatrix_transformation eae6320::Math::cMatrix_transformation::CreateScaleAndTranslationTransform(
+	const cVector& i_scale, const cVector& i_translation )
+{
+	return cMatrix_transformation(
+		i_scale.x, 0.0f, 0.0f, i_translation.x,
+		0.0f, i_scale.y, 0.0f, i_translation.y,
+		0.0f, 0.0f, i_scale.z, i_translation.z,
+		0.0f, 0.0f, 0.0f, 1.0f );
+}
 
-eae6320::Math::cMatrix_transformation::cMatrix_transformation()
-	:
-	m_00( 1.0f ), m_10( 0.0f ), m_20( 0.0f ), m_30( 0.0f ),
-	m_01( 0.0f ), m_11( 1.0f ), m_21( 0.0f ), m_31( 0.0f ),
-	m_02( 0.0f ), m_12( 0.0f ), m_22( 1.0f ), m_32( 0.0f ),
-	m_03( 0.0f ), m_13( 0.0f ), m_23( 0.0f ), m_33( 1.0f )
+// Concatenation
+eae6320::Math::cMatrix_transformation eae6320::Math::cMatrix_transformation::operator *( const cMatrix_transformation& i_rhs ) const
+{
+	// Both matrices are stored as columns,
+	// and each column of the result is a sum of this matrix's columns
+	// weighted by the elements of the corresponding column of the right-hand side
+	const __m128 lhs_column0 = _mm_loadu_ps( &m_00 );
+	const __m128 lhs_column1 = _mm_loadu_ps( &m_01 );
+	const __m128 lhs_column2 = _mm_loadu_ps( &m_02 );
+	const __m128 lhs_column3 = _mm_loadu_ps( &m_03 );
+	const float* const rhs_columns[] = { &i_rhs.m_00, &i_rhs.m_01, &i_rhs.m_02, &i_rhs.m_03 };
+	cMatrix_transformation result;
+	float* const result_columns[] = { &result.m_00, &result.m_01, &result.m_02, &result.m_03 };
+	for ( unsigned int j = 0; j < 4; ++j )
+	{
+		const __m128 rhs_column = _mm_loadu_ps( rhs_columns[j] );
+		const __m128 column = _mm_add_ps(
+			_mm_add_ps(
+				_mm_mul_ps( lhs_column0, _mm_shuffle_ps( rhs_column, rhs_column, _MM_SHUFFLE( 0, 0, 0, 0 ) ) ),
+				_mm_mul_ps( lhs_column1, _mm_shuffle_ps( rhs_column, rhs_column, _MM_SHUFFLE( 1, 1, 1, 1 ) ) ) ),
+			_mm_add_ps(
+				_mm_mul_ps( lhs_column2, _mm_shuffle_ps( rhs_column, rhs_column, _MM_SHUFFLE( 2, 2, 2, 2 ) ) ),
+				_mm_mul_ps( lhs_column3, _mm_shuffle_ps( rhs_column, rhs_column, _MM_SHUFFLE( 3, 3, 3, 3 ) ) ) ) );
+		_mm_storeu_ps( result_columns[j], column );
+	}
+	return result;
+}
+
+// Transformation
+eae6320::Math::cVector eae6320::Math::cMatrix_transformation::TransformPoint( const cVector& i_point ) const
 {
+	const float x = ( i_point.x * m_00 ) + ( i_point.y * m_10 ) + ( i_point.z * m_20 ) + m_30;
+	const float y = ( i_point.x * m_01 ) + ( i_point.y * m_11 ) + ( i_point.z * m_21 ) + m_31;
+	const float z = ( i_point.x * m_02 ) + ( i_point.y * m_12 ) + ( i_point.z * m_22 ) + m_32;
+	const float w = ( i_point.x * m_03 ) + ( i_point.y * m_13 ) + ( i_point.z * m_23 ) + m_33;
+	if ( w == 1.0f )
+	{
+		return cVector( x, y, z );
+	}
+	else
+	{
+		EAE6320_ASSERTF( std::abs( w ) > 1.0e-9f, "The point was transformed to infinity" );
+		const float w_reciprocal = 1.0f / w;
+		return cVector( x * w_reciprocal, y * w_reciprocal, z * w_reciprocal );
+	}
+}
+eae6320::Math::cVector eae6320::Math::cMatrix_transformation::TransformDirection( const cVector& i_direction ) const
+{
+	return cVector(
+		( i_direction.x * m_00 ) + ( i_direction.y * m_10 ) + ( i_direction.z * m_20 ),
+		( i_direction.x * m_01 ) + ( i_direction.y * m_11 ) + ( i_direction.z * m_21 ),
+		( i_direction.x * m_02 ) + ( i_direction.y * m_12 ) + ( i_direction.z * m_22 ) );
+}
+
+// Inversion
+eae6320::Math::cMatrix_transformation eae6320::Math::cMatrix_transformation::CreateInverse() const
+{
+	// This uses the adjugate (the transposed matrix of cofactors) divided by the determinant.
+	// The inverse of a transpose is the transpose of the inverse,
+	// and so the same code works whether the 16 floats are thought of as rows or as columns.
+	static_assert( sizeof( cMatrix_transformation ) == ( sizeof( float ) * 16 ), "cMatrix_transformation must be exactly 16 floats" );
+	float m[16];
+	std::memcpy( m, &m_00, sizeof( m ) );
+	float inverse[16];
+
+	inverse[0] = m[5] * m[10] * m[15] - m[5] * m[11] * m[14] - m[9] * m[6] * m[15]
+		+ m[9] * m[7] * m[14] + m[13] * m[6] * m[11] - m[13] * m[7] * m[10];
+	inverse[4] = -m[4] * m[10] * m[15] + m[4] * m[11] * m[14] + m[8] * m[6] * m[15]
+		- m[8] * m[7] * m[14] - m[12] * m[6] * m[11] + m[12] * m[7] * m[10];
+	inverse[8] = m[4] * m[9] * m[15] - m[4] * m[11] * m[13] - m[8] * m[5] * m[15]
+		+ m[8] * m[7] * m[13] + m[12] * m[5] * m[11] - m[12] * m[7] * m[9];
+	inverse[12] = -m[4] * m[9] * m[14] + m[4] * m[10] * m[13] + m[8] * m[5] * m[14]
+		- m[8] * m[6] * m[13] - m[12] * m[5] * m[10] + m[12] * m[6] * m[9];
+	inverse[1] = -m[1] * m[10] * m[15] + m[1] * m[11] * m[14] + m[9] * m[2] * m[15]
+		- m[9] * m[3] * m[14] - m[13] * m[2] * m[11] + m[13] * m[3] * m[10];
+	inverse[5] = m[0] * m[10] * m[15] - m[0] * m[11] * m[14] - m[8] * m[2] * m[15]
+		+ m[8] * m[3] * m[14] + m[12] * m[2] * m[11] - m[12] * m[3] * m[10];
+	inverse[9] = -m[0] * m[9] * m[15] + m[0] * m[11] * m[13] + m[8] * m[1] * m[15]
+		- m[8] * m[3] * m[13] - m[12] * m[1] * m[11] + m[12] * m[3] * m[9];
+	inverse[13] = m[0] * m[9] * m[14] - m[0] * m[10] * m[13] - m[8] * m[1] * m[14]
+		+ m[8] * m[2] * m[13] + m[12] * m[1] * m[10] - m[12] * m[2] * m[9];
+	inverse[2] = m[1] * m[6] * m[15] - m[1] * m[7] * m[14] - m[5] * m[2] * m[15]
+		+ m[5] * m[3] * m[14] + m[13] * m[2] * m[7] - m[13] * m[3] * m[6];
+	inverse[6] = -m[0] * m[6] * m[15] + m[0] * m[7] * m[14] + m[4] * m[2] * m[15]
+		- m[4] * m[3] * m[14] - m[12] * m[2] * m[7] + m[12] * m[3] * m[6];
+	inverse[10] = m[0] * m[5] * m[15] - m[0] * m[7] * m[13] - m[4] * m[1] * m[15]
+		+ m[4] * m[3] * m[13] + m[12] * m[1] * m[7] - m[12] * m[3] * m[5];
+	inverse[14] = -m[0] * m[5] * m[14] + m[0] * m[6] * m[13] + m[4] * m[1] * m[14]
+		- m[4] * m[2] * m[13] - m[12] * m[1] * m[6] + m[12] * m[2] * m[5];
+	inverse[3] = -m[1] * m[6] * m[11] + m[1] * m[7] * m[10] + m[5] * m[2] * m[11]
+		- m[5] * m[3] * m[10] - m[9] * m[2] * m[7] + m[9] * m[3] * m[6];
+	inverse[7] = m[0] * m[6] * m[11] - m[0] * m[7] * m[10] - m[4] * m[2] * m[11]
+		+ m[4] * m[3] * m[10] + m[8] * m[2] * m[7] - m[8] * m[3] * m[6];
+	inverse[11] = -m[0] * m[5] * m[11] + m[0] * m[7] * m[9] + m[4] * m[1] * m[11]
+		- m[4] * m[3] * m[9] - m[8] * m[1] * m[7] + m[8] * m[3] * m[5];
+	inverse[15] = m[0] * m[5] * m[10] - m[0] * m[6] * m[9] - m[4] * m[1] * m[10]
+		+ m[4] * m[2] * m[9] + m[8] * m[1] * m[6] - m[8] * m[2] * m[5];
 
+	const float determinant = ( m[0] * inverse[0] ) + ( m[1] * inverse[4] ) + ( m[2] * inverse[8] ) + ( m[3] * inverse[12] );
+	EAE6320_ASSERTF( std::abs( determinant ) > 1.0e-9f, "A singular matrix can't be inverted" );
+	const float determinant_reciprocal = 1.0f / determinant;
+	cMatrix_transformation result;
+	float* const o_elements = &result.m_00;
+	for ( unsigned int i = 0; i < 16; ++i )
+	{
+		o_elements[i] = inverse[i] * determinant_reciprocal;
+	}
+	return result;
+}
+eae6320::Math::cMatrix_transformation eae6320::Math::cMatrix_transformation::CreateInverseAffine() const
+{
+	return cSimdMatrix( *this ).CreateInverseAffine().ToMatrix();
 }
 
+void eae6320::Math::TransformPoints( const cMatrix_transformation& i_matrix, const float* const i_points, float* const o_points, const size_t i_count )
+{
+	const float* const i_xs = i_points;
+	const float* const i_ys = i_points + i_count;
+	const float* const i_zs = i_points + ( 2 * i_count );
+	float* const o_xs = o_points;
+	float* const o_ys = o_points + i_count;
+	float* const o_zs = o_points + ( 2 * i_count );
+
+	// Every point in a register is transformed by the same matrix,
+	// and so each element of the matrix is broadcast to every lane
+	// and several points are transformed at once with no shuffling at all
+	size_t i = 0;
+#if defined( __AVX__ )
+	{
+		const __m256 m_00 = _mm256_set1_ps( i_matrix.m_00 ), m_10 = _mm256_set1_ps( i_matrix.m_10 ),
+			m_20 = _mm256_set1_ps( i_matrix.m_20 ), m_30 = _mm256_set1_ps( i_matrix.m_30 );
+		const __m256 m_01 = _mm256_set1_ps( i_matrix.m_01 ), m_11 = _mm256_set1_ps( i_matrix.m_11 ),
+			m_21 = _mm256_set1_ps( i_matrix.m_21 ), m_31 = _mm256_set1_ps( i_matrix.m_31 );
+		const __m256 m_02 = _mm256_set1_ps( i_matrix.m_02 ), m_12 = _mm256_set1_ps( i_matrix.m_12 ),
+			m_22 = _mm256_set1_ps( i_matrix.m_22 ), m_32 = _mm256_set1_ps( i_matrix.m_32 );
+		for ( ; ( i + 8 ) <= i_count; i += 8 )
+		{
+			const __m256 x = _mm256_loadu_ps( i_xs + i );
+			const __m256 y = _mm256_loadu_ps( i_ys + i );
+			const __m256 z = _mm256_loadu_ps( i_zs + i );
+			_mm256_storeu_ps( o_xs + i, _mm256_add_ps( _mm256_add_ps( _mm256_mul_ps( x, m_00 ), _mm256_mul_ps( y, m_10 ) ),
+				_mm256_add_ps( _mm256_mul_ps( z, m_20 ), m_30 ) ) );
+			_mm256_storeu_ps( o_ys + i, _mm256_add_ps( _mm256_add_ps( _mm256_mul_ps( x, m_01 ), _mm256_mul_ps( y, m_11 ) ),
+				_mm256_add_ps( _mm256_mul_ps( z, m_21 ), m_31 ) ) );
+			_mm256_storeu_ps( o_zs + i, _mm256_add_ps( _mm256_add_ps( _mm256_mul_ps( x, m_02 ), _mm256_mul_ps( y, m_12 ) ),
+				_mm256_add_ps( _mm256_mul_ps( z, m_22 ), m_32 ) ) );
+		}
+	}
+#endif
+	{
+		const __m128 m_00 = _mm_set1_ps( i_matrix.m_00 ), m_10 = _mm_set1_ps( i_matrix.m_10 ),
+			m_20 = _mm_set1_ps( i_matrix.m_20 ), m_30 = _mm_set1_ps( i_matrix.m_30 );
+		const __m128 m_01 = _mm_set1_ps( i_matrix.m_01 ), m_11 = _mm_set1_ps( i_matrix.m_11 ),
+			m_21 = _mm_set1_ps( i_matrix.m_21 ), m_31 = _mm_set1_ps( i_matrix.m_31 );
+		const __m128 m_02 = _mm_set1_ps( i_matrix.m_02 ), m_12 = _mm_set1_ps( i_matrix.m_12 ),
+			m_22 = _mm_set1_ps( i_matrix.m_22 ), m_32 = _mm_set1_ps( i_matrix.m_32 );
+		for ( ; ( i + 4 ) <= i_count; i += 4 )
+		{
+			const __m128 x = _mm_loadu_ps( i_xs + i );
+			const __m128 y = _mm_loadu_ps( i_ys + i );
+			const __m128 z = _mm_loadu_ps( i_zs + i );
+			_mm_storeu_ps( o_xs + i, _mm_add_ps( _mm_add_ps( _mm_mul_ps( x, m_00 ), _mm_mul_ps( y, m_10 ) ),
+				_mm_add_ps( _mm_mul_ps( z, m_20 ), m_30 ) ) );
+			_mm_storeu_ps( o_ys + i, _mm_add_ps( _mm_add_ps( _mm_mul_ps( x, m_01 ), _mm_mul_ps( y, m_11 ) ),
+				_mm_add_ps( _mm_mul_ps( z, m_21 ), m_31 ) ) );
+			_mm_storeu_ps( o_zs + i, _mm_add_ps( _mm_add_ps( _mm_mul_ps( x, m_02 ), _mm_mul_ps( y, m_12 ) ),
+				_mm_add_ps( _mm_mul_ps( z, m_22 ), m_32 ) ) );
+		}
+	}
+	// Any remaining points are transformed one at a time
+	for ( ; i < i_count; ++i )
+	{
+		const float x = i_xs[i], y = i_ys[i], z = i_zs[i];
+		o_xs[i] = ( x * i_matrix.m_00 ) + ( y * i_matrix.m_10 ) + ( z * i_matrix.m_20 ) + i_matrix.m_30;
+		o_ys[i] = ( x * i_matrix.m_01 ) + ( y * i_matrix.m_11 ) + ( z * i_matrix.m_21 ) + i_matrix.m_31;
+		o_zs[i] = ( x * i_matrix.m_02 ) + ( y * i_matrix.m_12 ) + ( z * i_matrix.m_22 ) + i_matrix.m_32;
+	}
+}
+
+void eae6320::Math::CreateTransforms( const cQuaternion* const i_rotations, const cVector* const i_translations,
+	cMatrix_transformation* const o_transforms, const size_t i_count )
+{
+	static_assert( sizeof( cQuaternion ) == ( sizeof( float ) * 4 ), "cQuaternion must be exactly 4 floats" );
+
+	// Four quaternions are transposed so that each register holds one component of all four,
+	// and then every matrix element is calculated for all four at once using the same math as the constructor.
+	// Transposing the results back gives each matrix's columns directly.
+	size_t i = 0;
+	for ( ; ( i + 4 ) <= i_count; i += 4 )
+	{
+		__m128 w = _mm_loadu_ps( &i_rotations[i].m_w );
+		__m128 x = _mm_loadu_ps( &i_rotations[i + 1].m_w );
+		__m128 y = _mm_loadu_ps( &i_rotations[i + 2].m_w );
+		__m128 z = _mm_loadu_ps( &i_rotations[i + 3].m_w );
+		_MM_TRANSPOSE4_PS( w, x, y, z );
+
+		const __m128 one = _mm_set1_ps( 1.0f );
+		const __m128 _2x = _mm_add_ps( x, x );
+		const __m128 _2y = _mm_add_ps( y, y );
+		const __m128 _2z = _mm_add_ps( z, z );
+		const __m128 _2xx = _mm_mul_ps( x, _2x );
+		const __m128 _2xy = _mm_mul_ps( _2x, y );
+		const __m128 _2xz = _mm_mul_ps( _2x, z );
+		const __m128 _2xw = _mm_mul_ps( _2x, w );
+		const __m128 _2yy = _mm_mul_ps( _2y, y );
+		const __m128 _2yz = _mm_mul_ps( _2y, z );
+		const __m128 _2yw = _mm_mul_ps( _2y, w );
+		const __m128 _2zz = _mm_mul_ps( _2z, z );
+		const __m128 _2zw = _mm_mul_ps( _2z, w );
+
+		__m128 column0_0 = _mm_sub_ps( _mm_sub_ps( one, _2yy ), _2zz );
+		__m128 column0_1 = _mm_add_ps( _2xy, _2zw );
+		__m128 column0_2 = _mm_sub_ps( _2xz, _2yw );
+		__m128 column0_3 = _mm_set_ps( i_translations[i + 3].x, i_translations[i + 2].x, i_translations[i + 1].x, i_translations[i].x );
+		__m128 column1_0 = _mm_sub_ps( _2xy, _2zw );
+		__m128 column1_1 = _mm_sub_ps( _mm_sub_ps( one, _2xx ), _2zz );
+		__m128 column1_2 = _mm_add_ps( _2yz, _2xw );
+		__m128 column1_3 = _mm_set_ps( i_translations[i + 3].y, i_translations[i + 2].y, i_translations[i + 1].y, i_translations[i].y );
+		__m128 column2_0 = _mm_add_ps( _2xz, _2yw );
+		__m128 column2_1 = _mm_sub_ps( _2yz, _2xw );
+		__m128 column2_2 = _mm_sub_ps( _mm_sub_ps( one, _2xx ), _2yy );
+		__m128 column2_3 = _mm_set_ps( i_translations[i + 3].z, i_translations[i + 2].z, i_translations[i + 1].z, i_translations[i].z );
+		_MM_TRANSPOSE4_PS( column0_0, column0_1, column0_2, column0_3 );
+		_MM_TRANSPOSE4_PS( column1_0, column1_1, column1_2, column1_3 );
+		_MM_TRANSPOSE4_PS( column2_0, column2_1, column2_2, column2_3 );
+
+		const __m128 column3 = _mm_set_ps( 1.0f, 0.0f, 0.0f, 0.0f );
+		const __m128 columns[4][4] =
+		{
+			{ column0_0, column1_0, column2_0, column3 },
+			{ column0_1, column1_1, column2_1, column3 },
+			{ column0_2, column1_2, column2_2, column3 },
+			{ column0_3, column1_3, column2_3, column3 },
+		};
+		for ( unsigned int j = 0; j < 4; ++j )
+		{
+			cMatrix_transformation& o_transform = o_transforms[i + j];
+			_mm_storeu_ps( &o_transform.m_00, columns[j][0] );
+			_mm_storeu_ps( &o_transform.m_01, columns[j][1] );
+			_mm_storeu_ps( &o_transform.m_02, columns[j][2] );
+			_mm_storeu_ps( &o_transform.m_03, columns[j][3] );
+		}
+	}
+	// Any remaining transforms are created one at a time
+	for ( ; i < i_count; ++i )
+	{
+		o_transforms[i] = cMatrix_transformation( i_rotations[i], i_translations[i] );
+	}
+}
+
+// Initialization / Shut Down
+//---------------------------
+
 eae6320::Math::cMatrix_transformation::cMatrix_transformation( const cQuaternion& i_rotation, const cVector& i_translation )
 	:
 	m_30( i_translation.x ), m_31( i_translation.y ), m_32( i_translation.z ),
@@ -92,23 +347,3 @@ eae6320::Math::cMatrix_transformation::cMatrix_transformation( const cQuaternion
 	m_12 = _2yz - _2xw;
 	m_22 = 1.0f - _2xx - _2yy;
 }
-
-// Implementation
-//===============
-
-// Initialization / Shut Down
-//---------------------------
-
-eae6320::Math::cMatrix_transformation::cMatrix_transformation(
-	const float i_00, const float i_10, const float i_20, const float i_30,
-	const float i_01, const float i_11, const float i_21, const float i_31,
-	const float i_02, const float i_12, const float i_22, const float i_32,
-	const float i_03, const float i_13, const float i_23, const float i_33 )
-	:
-	m_00( i_00 ), m_10( i_10 ), m_20( i_20 ), m_30( i_30 ),
-	m_01( i_01 ), m_11( i_11 ), m_21( i_21 ), m_31( i_31 ),
-	m_02( i_02 ), m_12( i_12 ), m_22( i_22 ), m_32( i_32 ),
-	m_03( i_03 ), m_13( i_13 ), m_23( i_23 ), m_33( i_33 )
-{
-
-}
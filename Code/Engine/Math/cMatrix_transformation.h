@@ -20,6 +20,11 @@
 #ifndef EAE6320_MATH_CMATRIX_TRANSFORMATION_H
 #define EAE6320_MATH_CMATRIX_TRANSFORMATION_H
 
+// Header Files
+//=============
+
+#include <cstddef>
+
 // Forward Declarations
 //=====================
 
@@ -29,6 +34,7 @@ namespace eae6320
 	{
 		class cVector;
 		class cQuaternion;
+		struct sFrustum;
 	}
 }
 
@@ -51,11 +57,28 @@ namespace eae6320
 			static cMatrix_transformation CreateCameraToScreenTransform_perspectiveProjection(
 				const float i_fieldOfView_y, const float i_aspectRatio,
 				const float i_z_nearPlane, const float i_z_farPlane );
+			// Scales each axis and then translates
+			static cMatrix_transformation CreateScaleAndTranslationTransform( const cVector& i_scale, const cVector& i_translation );
+
+			// Concatenation
+			// (because the vectors are rows "A * B" means "apply A and then B")
+			cMatrix_transformation operator *( const cMatrix_transformation& i_rhs ) const;
+
+			// Transformation
+			// (points are divided by the resulting w, so this also works for projections)
+			cVector TransformPoint( const cVector& i_point ) const;
+			cVector TransformDirection( const cVector& i_direction ) const;
+
+			// Inversion
+			cMatrix_transformation CreateInverse() const;
+			// This is faster but only valid when the last column is [0, 0, 0, 1]
+			// (i.e. any combination of rotation, scale, and translation)
+			cMatrix_transformation CreateInverseAffine() const;
 
 			// Initialization / Shut Down
 			//---------------------------
 
-			cMatrix_transformation();	// Identity
+			constexpr cMatrix_transformation();	// Identity
 			cMatrix_transformation( const cQuaternion& i_rotation, const cVector& i_translation );
 
 			// Data
@@ -77,13 +100,37 @@ namespace eae6320
 			// Initialization / Shut Down
 			//---------------------------
 
-			cMatrix_transformation(
+			constexpr cMatrix_transformation(
 				const float i_00, const float i_10, const float i_20, const float i_30,
 				const float i_01, const float i_11, const float i_21, const float i_31,
 				const float i_02, const float i_12, const float i_22, const float i_32,
 				const float i_03, const float i_13, const float i_23, const float i_33 );
+
+			// Friend Classes
+			//===============
+
+			friend class cSimdMatrix;
+			friend struct sFrustum;
+			friend void TransformPoints( const cMatrix_transformation& i_matrix, const float* const i_points, float* const o_points, const size_t i_count );
+			friend void CreateTransforms( const cQuaternion* const i_rotations, const cVector* const i_translations,
+				cMatrix_transformation* const o_transforms, const size_t i_count );
 		};
+
+		// Friend Function Declarations
+		//=============================
+
+		// Transforms i_count points stored as structure-of-arrays:
+		// all of the x values, then all of the y values, then all of the z values.
+		// Only the affine part of the matrix is used (there is no divide by w).
+		// The input and output may be the same array.
+		void TransformPoints( const cMatrix_transformation& i_matrix, const float* const i_points, float* const o_points, const size_t i_count );
+		// Creates i_count transforms from matching rotations and translations
+		// (the result is the same as calling the constructor for each pair, but several are converted at once)
+		void CreateTransforms( const cQuaternion* const i_rotations, const cVector* const i_translations,
+			cMatrix_transformation* const o_transforms, const size_t i_count );
 	}
 }
 
+#include "cMatrix_transformation.inl"
+
 #endif	// EAE6320_MATH_CMATRIX_TRANSFORMATION_H
@@ -0,0 +1,45 @@
+#ifndef EAE6320_MATH_CMATRIX_TRANSFORMATION_INL
+#define EAE6320_MATH_CMATRIX_TRANSFORMATION_INL
+
+// Header Files
+//=============
+
+#include "cMatrix_transformation.h"
+
+// Interface
+//==========
+
+// Initialization / Shut Down
+//---------------------------
+
+constexpr eae6320::Math::cMatrix_transformation::cMatrix_transformation()
+	:
+	m_00( 1.0f ), m_10( 0.0f ), m_20( 0.0f ), m_30( 0.0f ),
+	m_01( 0.0f ), m_11( 1.0f ), m_21( 0.0f ), m_31( 0.0f ),
+	m_02( 0.0f ), m_12( 0.0f ), m_22( 1.0f ), m_32( 0.0f ),
+	m_03( 0.0f ), m_13( 0.0f ), m_23( 0.0f ), m_33( 1.0f )
+{
+
+}
+
+// Implementation
+//===============
+
+// Initialization / Shut Down
+//---------------------------
+
+constexpr eae6320::Math::cMatrix_transformation::cMatrix_transformation(
+	const float i_00, const float i_10, const float i_20, const float i_30,
+	const float i_01, const float i_11, const float i_21, const float i_31,
+	const float i_02, const float i_12, const float i_22, const float i_32,
+	const float i_03, const float i_13, const float i_23, const float i_33 )
+	:
+	m_00( i_00 ), m_10( i_10 ), m_20( i_20 ), m_30( i_30 ),
+	m_01( i_01 ), m_11( i_11 ), m_21( i_21 ), m_31( i_31 ),
+	m_02( i_02 ), m_12( i_12 ), m_22( i_22 ), m_32( i_32 ),
+	m_03( i_03 ), m_13( i_13 ), m_23( i_23 ), m_33( i_33 )
+{
+
+}
+
+#endif	// EAE6320_MATH_CMATRIX_TRANSFORMATION_INL
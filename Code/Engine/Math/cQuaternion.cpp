@@ -3,8 +3,10 @@
 
 #include "cQuaternion.h"
 
+#include <algorithm>
 #include <cmath>
 #include "cVector.h"
+#include "SimdFunctions.h"
 #include "../Asserts/Asserts.h"
 
 // Static Data Initialization
@@ -13,21 +15,15 @@
 namespace
 {
 	const float s_epsilon = 1.0e-9f;
+	// Above this cosine the angle between two quaternions is small enough to interpolate linearly
+	const float s_slerpThreshold = 0.9995f;
+	// Above this sine of the y angle (about 89.9 degrees) x and z are treated as being about the same axis
+	const float s_gimbalLockThreshold = 0.999999f;
 }
 
 // Interface
 //==========
 
-// Concatenation
-eae6320::Math::cQuaternion eae6320::Math::cQuaternion::operator *( const cQuaternion& i_rhs ) const
-{
-	return cQuaternion(
-		( m_w * i_rhs.m_w ) - ( ( m_x * i_rhs.m_x ) + ( m_y * i_rhs.m_y ) + ( m_z * i_rhs.m_z ) ),
-		( m_w * i_rhs.m_x ) + ( m_x * i_rhs.m_w ) + ( ( m_y * i_rhs.m_z ) - ( m_z * i_rhs.m_y ) ),
-		( m_w * i_rhs.m_y ) + ( m_y * i_rhs.m_w ) + ( ( m_z * i_rhs.m_x ) - ( m_x * i_rhs.m_z ) ),
-		( m_w * i_rhs.m_z ) + ( m_z * i_rhs.m_w ) + ( ( m_x * i_rhs.m_y ) - ( m_y * i_rhs.m_x ) ) );
-}
-
 // Inversion
 void eae6320::Math::cQuaternion::Invert()
 {
@@ -35,10 +31,6 @@ void eae6320::Math::cQuaternion::Invert()
 	m_y = -m_y;
 	m_z = -m_z;
 }
-eae6320::Math::cQuaternion eae6320::Math::cQuaternion::CreateInverse() const
-{
-	return cQuaternion( m_w, -m_x, -m_y, -m_z );
-}
 
 // Normalization
 void eae6320::Math::cQuaternion::Normalize()
@@ -59,22 +51,116 @@ eae6320::Math::cQuaternion eae6320::Math::cQuaternion::CreateNormalized() const
 	return cQuaternion( m_w * length_reciprocal, m_x * length_reciprocal, m_y * length_reciprocal, m_z * length_reciprocal );
 }
 
-// Products
-float eae6320::Math::Dot( const cQuaternion& i_lhs, const cQuaternion& i_rhs )
+// Interpolation
+eae6320::Math::cQuaternion eae6320::Math::Nlerp( const cQuaternion& i_from, const cQuaternion& i_to, const float i_t )
 {
-	return ( i_lhs.m_w * i_rhs.m_w ) + ( i_lhs.m_x * i_rhs.m_x ) + ( i_lhs.m_y * i_rhs.m_y ) + ( i_lhs.m_z * i_rhs.m_z );
+	// q and -q are the same rotation,
+	// and so if the quaternions are more than 90 degrees apart in 4D
+	// one is negated so that the interpolation goes the short way around
+	const float t_to = ( Dot( i_from, i_to ) >= 0.0f ) ? i_t : -i_t;
+	const float t_from = 1.0f - i_t;
+	return cQuaternion(
+		( i_from.m_w * t_from ) + ( i_to.m_w * t_to ),
+		( i_from.m_x * t_from ) + ( i_to.m_x * t_to ),
+		( i_from.m_y * t_from ) + ( i_to.m_y * t_to ),
+		( i_from.m_z * t_from ) + ( i_to.m_z * t_to ) ).CreateNormalized();
 }
-
-// Initialization / Shut Down
-//---------------------------
-
-eae6320::Math::cQuaternion::cQuaternion()
-	:
-	m_w( 1.0f ), m_x( 0.0f ), m_y( 0.0f ), m_z( 0.0f )
+eae6320::Math::cQuaternion eae6320::Math::Slerp( const cQuaternion& i_from, const cQuaternion& i_to, const float i_t )
 {
+	float cosTheta = Dot( i_from, i_to );
+	float sign_to = 1.0f;
+	if ( cosTheta < 0.0f )
+	{
+		cosTheta = -cosTheta;
+		sign_to = -1.0f;
+	}
+	// When the rotations are almost identical sin(theta) approaches zero,
+	// but the arc is then so short that a straight line is indistinguishable from it
+	if ( cosTheta > s_slerpThreshold )
+	{
+		return Nlerp( i_from, i_to, i_t );
+	}
+	const float theta = std::acos( cosTheta );
+	const float sinTheta_reciprocal = 1.0f / std::sin( theta );
+	const float t_from = std::sin( ( 1.0f - i_t ) * theta ) * sinTheta_reciprocal;
+	const float t_to = std::sin( i_t * theta ) * sinTheta_reciprocal * sign_to;
+	return cQuaternion(
+		( i_from.m_w * t_from ) + ( i_to.m_w * t_to ),
+		( i_from.m_x * t_from ) + ( i_to.m_x * t_to ),
+		( i_from.m_y * t_from ) + ( i_to.m_y * t_to ),
+		( i_from.m_z * t_from ) + ( i_to.m_z * t_to ) );
+}
 
+// Euler Angles
+eae6320::Math::cQuaternion eae6320::Math::cQuaternion::CreateFromEulerAngles( const cVector& i_eulerAnglesInRadians )
+{
+	// This is Qx * Qy * Qz multiplied out
+	const float cx = std::cos( i_eulerAnglesInRadians.x * 0.5f ), sx = std::sin( i_eulerAnglesInRadians.x * 0.5f );
+	const float cy = std::cos( i_eulerAnglesInRadians.y * 0.5f ), sy = std::sin( i_eulerAnglesInRadians.y * 0.5f );
+	const float cz = std::cos( i_eulerAnglesInRadians.z * 0.5f ), sz = std::sin( i_eulerAnglesInRadians.z * 0.5f );
+	return cQuaternion(
+		( cx * cy * cz ) - ( sx * sy * sz ),
+		( sx * cy * cz ) + ( cx * sy * sz ),
+		( cx * sy * cz ) - ( sx * cy * sz ),
+		( cx * cy * sz ) + ( sx * sy * cz ) );
+}
+void eae6320::Math::CreateOrientations( const cVector* const i_eulerAnglesInRadians, cQuaternion* const o_orientations, const size_t i_count )
+{
+	// The half angles are gathered into blocks of structure-of-arrays
+	// (all of the x values, then all of the y values, then all of the z values)
+	// so that every sine and cosine in a block is calculated with a single call
+	const size_t blockSize = 64;
+	float halfAngles[3 * blockSize], sines[3 * blockSize], cosines[3 * blockSize];
+	for ( size_t blockStart = 0; blockStart < i_count; blockStart += blockSize )
+	{
+		const size_t count = std::min( blockSize, i_count - blockStart );
+		for ( size_t i = 0; i < count; ++i )
+		{
+			const cVector& eulerAngles = i_eulerAnglesInRadians[blockStart + i];
+			halfAngles[i] = eulerAngles.x * 0.5f;
+			halfAngles[count + i] = eulerAngles.y * 0.5f;
+			halfAngles[( 2 * count ) + i] = eulerAngles.z * 0.5f;
+		}
+		SinCos( halfAngles, sines, cosines, 3 * count );
+		for ( size_t i = 0; i < count; ++i )
+		{
+			// This is the same as CreateFromEulerAngles()
+			const float cx = cosines[i], sx = sines[i];
+			const float cy = cosines[count + i], sy = sines[count + i];
+			const float cz = cosines[( 2 * count ) + i], sz = sines[( 2 * count ) + i];
+			o_orientations[blockStart + i] = cQuaternion(
+				( cx * cy * cz ) - ( sx * sy * sz ),
+				( sx * cy * cz ) + ( cx * sy * sz ),
+				( cx * sy * cz ) - ( sx * cy * sz ),
+				( cx * cy * sz ) + ( sx * sy * cz ) );
+		}
+	}
+}
+eae6320::Math::cVector eae6320::Math::cQuaternion::GetEulerAngles() const
+{
+	// These are the elements of the equivalent rotation matrix that are needed to recover the angles
+	const float sinY = 2.0f * ( ( m_x * m_z ) + ( m_w * m_y ) );
+	if ( std::abs( sinY ) < s_gimbalLockThreshold )
+	{
+		const float r_12 = 2.0f * ( ( m_y * m_z ) - ( m_w * m_x ) );
+		const float r_22 = 1.0f - ( 2.0f * ( ( m_x * m_x ) + ( m_y * m_y ) ) );
+		const float r_01 = 2.0f * ( ( m_x * m_y ) - ( m_w * m_z ) );
+		const float r_00 = 1.0f - ( 2.0f * ( ( m_y * m_y ) + ( m_z * m_z ) ) );
+		return cVector( std::atan2( -r_12, r_22 ), std::asin( sinY ), std::atan2( -r_01, r_00 ) );
+	}
+	else
+	{
+		// Gimbal lock: only the sum (or difference) of x and z can be recovered
+		const float r_21 = 2.0f * ( ( m_y * m_z ) + ( m_w * m_x ) );
+		const float r_11 = 1.0f - ( 2.0f * ( ( m_x * m_x ) + ( m_z * m_z ) ) );
+		const float halfPi = 1.570796327f;
+		return cVector( std::atan2( r_21, r_11 ), ( sinY > 0.0f ) ? halfPi : -halfPi, 0.0f );
+	}
 }
 
+// Initialization / Shut Down
+//---------------------------
+
 eae6320::Math::cQuaternion::cQuaternion( const float i_angleInRadians, const cVector& i_axisOfRotation_normalized )
 {
 	const float theta_half = i_angleInRadians * 0.5f;
@@ -84,16 +170,3 @@ eae6320::Math::cQuaternion::cQuaternion( const float i_angleInRadians, const cVe
 	m_y = i_axisOfRotation_normalized.y * sin_theta_half;
 	m_z = i_axisOfRotation_normalized.z * sin_theta_half;
 }
-
-// Implementation
-//===============
-
-// Initialization / Shut Down
-//---------------------------
-
-eae6320::Math::cQuaternion::cQuaternion( const float i_w, const float i_x, const float i_y, const float i_z )
-	:
-	m_w( i_w ), m_x( i_x ), m_y( i_y ), m_z( i_z )
-{
-
-}
@@ -5,6 +5,11 @@
 #ifndef EAE6320_MATH_CQUATERNION_H
 #define EAE6320_MATH_CQUATERNION_H
 
+// Header Files
+//=============
+
+#include <cstddef>
+
 // Forward Declarations
 //=====================
 
@@ -30,23 +35,41 @@ namespace eae6320
 		public:
 
 			// Concatenation
-			cQuaternion operator *( const cQuaternion& i_rhs ) const;
+			constexpr cQuaternion operator *( const cQuaternion& i_rhs ) const;
 
 			// Inversion
 			void Invert();
-			cQuaternion CreateInverse() const;
+			constexpr cQuaternion CreateInverse() const;
 
 			// Normalization
 			void Normalize();
 			cQuaternion CreateNormalized() const;
 
 			// Products
-			friend float Dot( const cQuaternion& i_lhs, const cQuaternion& i_rhs );
+			friend constexpr float Dot( const cQuaternion& i_lhs, const cQuaternion& i_rhs );
+
+			// Interpolation
+			// (both of these take the shortest path,
+			// and so the result may be the negative of a quaternion that represents the same rotation)
+			// Nlerp is cheaper but doesn't have a constant angular velocity;
+			// it is a good choice when the two rotations are close (e.g. when smoothing network updates)
+			friend cQuaternion Nlerp( const cQuaternion& i_from, const cQuaternion& i_to, const float i_t );
+			friend cQuaternion Slerp( const cQuaternion& i_from, const cQuaternion& i_to, const float i_t );
+
+			// Euler Angles
+			// (the angles are in radians,
+			// and the rotation is the same as rotating around x, then y, then z
+			// with each concatenated on the right, i.e. Qx * Qy * Qz)
+			static cQuaternion CreateFromEulerAngles( const cVector& i_eulerAnglesInRadians );
+			// The y angle is in the range [-pi/2, pi/2];
+			// when it is at either limit the x and z rotations are about the same axis
+			// and so all of the rotation is returned in x
+			cVector GetEulerAngles() const;
 
 			// Initialization / Shut Down
 			//---------------------------
 
-			cQuaternion();	// Identity
+			constexpr cQuaternion();	// Identity
 			cQuaternion( const float i_angleInRadians, const cVector& i_axisOfRotation_normalized );
 
 			// Data
@@ -63,14 +86,28 @@ namespace eae6320
 			// Initialization / Shut Down
 			//---------------------------
 
-			cQuaternion( const float i_w, const float i_x, const float i_y, const float i_z );
+			constexpr cQuaternion( const float i_w, const float i_x, const float i_y, const float i_z );
 
 			// Friend Classes
 			//===============
 
 			friend class cMatrix_transformation;
+			friend void CreateOrientations( const cVector* const i_eulerAnglesInRadians, cQuaternion* const o_orientations, const size_t i_count );
 		};
+
+		// Friend Function Declarations
+		//=============================
+
+		constexpr float Dot( const cQuaternion& i_lhs, const cQuaternion& i_rhs );
+		cQuaternion Nlerp( const cQuaternion& i_from, const cQuaternion& i_to, const float i_t );
+		cQuaternion Slerp( const cQuaternion& i_from, const cQuaternion& i_to, const float i_t );
+		// Creates i_count quaternions from matching Euler angles
+		// (the same rotations as CreateFromEulerAngles(), but the sines and cosines are calculated with the SIMD functions,
+		// which are within a few ULPs of the standard library and several times faster when there are many to convert)
+		void CreateOrientations( const cVector* const i_eulerAnglesInRadians, cQuaternion* const o_orientations, const size_t i_count );
 	}
 }
 
+#include "cQuaternion.inl"
+
 #endif	// EAE6320_MATH_CQUATERNION_H
@@ -0,0 +1,57 @@
+#ifndef EAE6320_MATH_CQUATERNION_INL
+#define EAE6320_MATH_CQUATERNION_INL
+
+// Header Files
+//=============
+
+#include "cQuaternion.h"
+
+// Interface
+//==========
+
+// Concatenation
+constexpr eae6320::Math::cQuaternion eae6320::Math::cQuaternion::operator *( const cQuaternion& i_rhs ) const
+{
+	return cQuaternion(
+		( m_w * i_rhs.m_w ) - ( ( m_x * i_rhs.m_x ) + ( m_y * i_rhs.m_y ) + ( m_z * i_rhs.m_z ) ),
+		( m_w * i_rhs.m_x ) + ( m_x * i_rhs.m_w ) + ( ( m_y * i_rhs.m_z ) - ( m_z * i_rhs.m_y ) ),
+		( m_w * i_rhs.m_y ) + ( m_y * i_rhs.m_w ) + ( ( m_z * i_rhs.m_x ) - ( m_x * i_rhs.m_z ) ),
+		( m_w * i_rhs.m_z ) + ( m_z * i_rhs.m_w ) + ( ( m_x * i_rhs.m_y ) - ( m_y * i_rhs.m_x ) ) );
+}
+
+// Inversion
+constexpr eae6320::Math::cQuaternion eae6320::Math::cQuaternion::CreateInverse() const
+{
+	return cQuaternion( m_w, -m_x, -m_y, -m_z );
+}
+
+// Products
+constexpr float eae6320::Math::Dot( const cQuaternion& i_lhs, const cQuaternion& i_rhs )
+{
+	return ( i_lhs.m_w * i_rhs.m_w ) + ( i_lhs.m_x * i_rhs.m_x ) + ( i_lhs.m_y * i_rhs.m_y ) + ( i_lhs.m_z * i_rhs.m_z );
+}
+
+// Initialization / Shut Down
+//---------------------------
+
+constexpr eae6320::Math::cQuaternion::cQuaternion()
+	:
+	m_w( 1.0f ), m_x( 0.0f ), m_y( 0.0f ), m_z( 0.0f )
+{
+
+}
+
+// Implementation
+//===============
+
+// Initialization / Shut Down
+//---------------------------
+
+constexpr eae6320::Math::cQuaternion::cQuaternion( const float i_w, const float i_x, const float i_y, const float i_z )
+	:
+	m_w( i_w ), m_x( i_x ), m_y( i_y ), m_z( i_z )
+{
+
+}
+
+#endif	// EAE6320_MATH_CQUATERNION_INL
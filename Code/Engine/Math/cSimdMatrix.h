@@ -0,0 +1,76 @@
+/*
+	This class represents a 4x4 transformation stored as four SIMD rows
+
+	It follows the same conventions as cMatrix_transformation
+	(row vectors, with the translation in the last row),
+	but stores the rows rather than the columns
+	so that transforming a vector is four multiply-adds with no horizontal operations.
+
+	Converting to and from cMatrix_transformation is a single 4x4 transpose.
+*/
+
+#ifndef EAE6320_MATH_CSIMDMATRIX_H
+#define EAE6320_MATH_CSIMDMATRIX_H
+
+// Header Files
+//=============
+
+#include "cSimdVector.h"
+#include "cMatrix_transformation.h"
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+	namespace Math
+	{
+		class alignas( 16 ) cSimdMatrix
+		{
+			// Interface
+			//==========
+
+		public:
+
+			// Concatenation
+			// (with row vectors "A * B" means "apply A and then B")
+			cSimdMatrix operator *( const cSimdMatrix& i_rhs ) const;
+			cSimdMatrix& operator *=( const cSimdMatrix& i_rhs );
+
+			// Transformation
+			cSimdVector TransformPoint( const cSimdVector i_point ) const;	// Includes the translation
+			cSimdVector TransformDirection( const cSimdVector i_direction ) const;	// Ignores the translation
+
+			// Inversion
+			// (this is only valid for affine matrices, i.e. when the last column is [0, 0, 0, 1],
+			// which is true of every transform made from a rotation, scale, and translation)
+			cSimdMatrix CreateInverseAffine() const;
+			cSimdMatrix CreateTranspose() const;
+
+			// Access
+			cSimdVector GetRow( const unsigned int i_index ) const;
+			cSimdVector GetTranslation() const;
+
+			// Conversion
+			cMatrix_transformation ToMatrix() const;
+
+			// Initialization / Shut Down
+			//---------------------------
+
+			cSimdMatrix();	// Identity
+			cSimdMatrix( const cMatrix_transformation& i_matrix );
+			cSimdMatrix( const cSimdVector i_row0, const cSimdVector i_row1, const cSimdVector i_row2, const cSimdVector i_row3 );
+
+			// Data
+			//=====
+
+		public:
+
+			__m128 m_rows[4];
+		};
+	}
+}
+
+#include "cSimdMatrix.inl"
+
+#endif	// EAE6320_MATH_CSIMDMATRIX_H
@@ -0,0 +1,177 @@
+#ifndef EAE6320_MATH_CSIMDMATRIX_INL
+#define EAE6320_MATH_CSIMDMATRIX_INL
+
+// Header Files
+//=============
+
+#include "cSimdMatrix.h"
+
+#include "../Asserts/Asserts.h"
+
+// Helper Function Definitions
+//============================
+
+namespace eae6320
+{
+	namespace Math
+	{
+		namespace SimdInternal
+		{
+			// Returns i_vector * i_rows for a row vector stored in a register
+			inline __m128 TransformRow( const __m128 i_vector, const __m128* const i_rows )
+			{
+				const __m128 x = _mm_shuffle_ps( i_vector, i_vector, _MM_SHUFFLE( 0, 0, 0, 0 ) );
+				const __m128 y = _mm_shuffle_ps( i_vector, i_vector, _MM_SHUFFLE( 1, 1, 1, 1 ) );
+				const __m128 z = _mm_shuffle_ps( i_vector, i_vector, _MM_SHUFFLE( 2, 2, 2, 2 ) );
+				const __m128 w = _mm_shuffle_ps( i_vector, i_vector, _MM_SHUFFLE( 3, 3, 3, 3 ) );
+				return _mm_add_ps(
+					_mm_add_ps( _mm_mul_ps( x, i_rows[0] ), _mm_mul_ps( y, i_rows[1] ) ),
+					_mm_add_ps( _mm_mul_ps( z, i_rows[2] ), _mm_mul_ps( w, i_rows[3] ) ) );
+			}
+		}
+	}
+}
+
+// Interface
+//==========
+
+// Concatenation
+inline eae6320::Math::cSimdMatrix eae6320::Math::cSimdMatrix::operator *( const cSimdMatrix& i_rhs ) const
+{
+	cSimdMatrix result;
+#if defined( __AVX__ )
+	// Two rows of the left-hand side are processed at once,
+	// with each row of the right-hand side broadcast into both halves of a 256 bit register
+	const __m256 rhs_0 = _mm256_broadcast_ps( &i_rhs.m_rows[0] );
+	const __m256 rhs_1 = _mm256_broadcast_ps( &i_rhs.m_rows[1] );
+	const __m256 rhs_2 = _mm256_broadcast_ps( &i_rhs.m_rows[2] );
+	const __m256 rhs_3 = _mm256_broadcast_ps( &i_rhs.m_rows[3] );
+	for ( unsigned int i = 0; i < 4; i += 2 )
+	{
+		const __m256 lhs = _mm256_insertf128_ps( _mm256_castps128_ps256( m_rows[i] ), m_rows[i + 1], 1 );
+		const __m256 product = _mm256_add_ps(
+			_mm256_add_ps( _mm256_mul_ps( _mm256_permute_ps( lhs, 0x00 ), rhs_0 ), _mm256_mul_ps( _mm256_permute_ps( lhs, 0x55 ), rhs_1 ) ),
+			_mm256_add_ps( _mm256_mul_ps( _mm256_permute_ps( lhs, 0xaa ), rhs_2 ), _mm256_mul_ps( _mm256_permute_ps( lhs, 0xff ), rhs_3 ) ) );
+		result.m_rows[i] = _mm256_castps256_ps128( product );
+		result.m_rows[i + 1] = _mm256_extractf128_ps( product, 1 );
+	}
+#else
+	for ( unsigned int i = 0; i < 4; ++i )
+	{
+		result.m_rows[i] = SimdInternal::TransformRow( m_rows[i], i_rhs.m_rows );
+	}
+#endif
+	return result;
+}
+inline eae6320::Math::cSimdMatrix& eae6320::Math::cSimdMatrix::operator *=( const cSimdMatrix& i_rhs )
+{
+	*this = *this * i_rhs;
+	return *this;
+}
+
+// Transformation
+inline eae6320::Math::cSimdVector eae6320::Math::cSimdMatrix::TransformPoint( const cSimdVector i_point ) const
+{
+	const __m128 x = _mm_shuffle_ps( i_point.m_value, i_point.m_value, _MM_SHUFFLE( 0, 0, 0, 0 ) );
+	const __m128 y = _mm_shuffle_ps( i_point.m_value, i_point.m_value, _MM_SHUFFLE( 1, 1, 1, 1 ) );
+	const __m128 z = _mm_shuffle_ps( i_point.m_value, i_point.m_value, _MM_SHUFFLE( 2, 2, 2, 2 ) );
+	return cSimdVector( _mm_add_ps(
+		_mm_add_ps( _mm_mul_ps( x, m_rows[0] ), _mm_mul_ps( y, m_rows[1] ) ),
+		_mm_add_ps( _mm_mul_ps( z, m_rows[2] ), m_rows[3] ) ) );
+}
+inline eae6320::Math::cSimdVector eae6320::Math::cSimdMatrix::TransformDirection( const cSimdVector i_direction ) const
+{
+	const __m128 x = _mm_shuffle_ps( i_direction.m_value, i_direction.m_value, _MM_SHUFFLE( 0, 0, 0, 0 ) );
+	const __m128 y = _mm_shuffle_ps( i_direction.m_value, i_direction.m_value, _MM_SHUFFLE( 1, 1, 1, 1 ) );
+	const __m128 z = _mm_shuffle_ps( i_direction.m_value, i_direction.m_value, _MM_SHUFFLE( 2, 2, 2, 2 ) );
+	return cSimdVector( _mm_add_ps(
+		_mm_add_ps( _mm_mul_ps( x, m_rows[0] ), _mm_mul_ps( y, m_rows[1] ) ),
+		_mm_mul_ps( z, m_rows[2] ) ) );
+}
+
+// Inversion
+inline eae6320::Math::cSimdMatrix eae6320::Math::cSimdMatrix::CreateInverseAffine() const
+{
+	// The upper 3x3 is inverted using the cross products of its rows
+	// (the adjugate's columns), and then the translation is transformed by that inverse and negated
+	const cSimdVector row0( m_rows[0] ), row1( m_rows[1] ), row2( m_rows[2] );
+	__m128 column0 = Cross( row1, row2 ).m_value;
+	__m128 column1 = Cross( row2, row0 ).m_value;
+	__m128 column2 = Cross( row0, row1 ).m_value;
+	const __m128 determinant = SimdInternal::Dot3_splat( row0.m_value, column0 );
+	EAE6320_ASSERTF( std::abs( _mm_cvtss_f32( determinant ) ) > 1.0e-9f, "A singular matrix can't be inverted" );
+	const __m128 determinant_reciprocal = _mm_div_ps( _mm_set1_ps( 1.0f ), determinant );
+	column0 = _mm_mul_ps( column0, determinant_reciprocal );
+	column1 = _mm_mul_ps( column1, determinant_reciprocal );
+	column2 = _mm_mul_ps( column2, determinant_reciprocal );
+	__m128 column3 = _mm_setzero_ps();
+	_MM_TRANSPOSE4_PS( column0, column1, column2, column3 );
+
+	cSimdMatrix result( cSimdVector( column0 ), cSimdVector( column1 ), cSimdVector( column2 ), cSimdVector( 0.0f, 0.0f, 0.0f, 1.0f ) );
+	const __m128 translation = result.TransformDirection( cSimdVector( m_rows[3] ) ).m_value;
+	// The w of the transformed translation is zero, and so this negates x, y, z and keeps the 1 in w
+	result.m_rows[3] = _mm_sub_ps( result.m_rows[3], translation );
+	return result;
+}
+inline eae6320::Math::cSimdMatrix eae6320::Math::cSimdMatrix::CreateTranspose() const
+{
+	cSimdMatrix result( *this );
+	_MM_TRANSPOSE4_PS( result.m_rows[0], result.m_rows[1], result.m_rows[2], result.m_rows[3] );
+	return result;
+}
+
+// Access
+inline eae6320::Math::cSimdVector eae6320::Math::cSimdMatrix::GetRow( const unsigned int i_index ) const
+{
+	EAE6320_ASSERT( i_index < 4 );
+	return cSimdVector( m_rows[i_index] );
+}
+inline eae6320::Math::cSimdVector eae6320::Math::cSimdMatrix::GetTranslation() const
+{
+	return cSimdVector( m_rows[3] );
+}
+
+// Conversion
+inline eae6320::Math::cMatrix_transformation eae6320::Math::cSimdMatrix::ToMatrix() const
+{
+	// cMatrix_transformation stores columns, and so transposing the rows gives its exact memory layout
+	cMatrix_transformation result;
+	__m128 column0 = m_rows[0], column1 = m_rows[1], column2 = m_rows[2], column3 = m_rows[3];
+	_MM_TRANSPOSE4_PS( column0, column1, column2, column3 );
+	_mm_storeu_ps( &result.m_00, column0 );
+	_mm_storeu_ps( &result.m_01, column1 );
+	_mm_storeu_ps( &result.m_02, column2 );
+	_mm_storeu_ps( &result.m_03, column3 );
+	return result;
+}
+
+// Initialization / Shut Down
+//---------------------------
+
+inline eae6320::Math::cSimdMatrix::cSimdMatrix()
+{
+	m_rows[0] = _mm_set_ps( 0.0f, 0.0f, 0.0f, 1.0f );
+	m_rows[1] = _mm_set_ps( 0.0f, 0.0f, 1.0f, 0.0f );
+	m_rows[2] = _mm_set_ps( 0.0f, 1.0f, 0.0f, 0.0f );
+	m_rows[3] = _mm_set_ps( 1.0f, 0.0f, 0.0f, 0.0f );
+}
+
+inline eae6320::Math::cSimdMatrix::cSimdMatrix( const cMatrix_transformation& i_matrix )
+{
+	static_assert( sizeof( cMatrix_transformation ) == ( sizeof( float ) * 16 ), "cMatrix_transformation must be exactly 16 floats" );
+	m_rows[0] = _mm_loadu_ps( &i_matrix.m_00 );
+	m_rows[1] = _mm_loadu_ps( &i_matrix.m_01 );
+	m_rows[2] = _mm_loadu_ps( &i_matrix.m_02 );
+	m_rows[3] = _mm_loadu_ps( &i_matrix.m_03 );
+	_MM_TRANSPOSE4_PS( m_rows[0], m_rows[1], m_rows[2], m_rows[3] );
+}
+
+inline eae6320::Math::cSimdMatrix::cSimdMatrix( const cSimdVector i_row0, const cSimdVector i_row1, const cSimdVector i_row2, const cSimdVector i_row3 )
+{
+	m_rows[0] = i_row0.m_value;
+	m_rows[1] = i_row1.m_value;
+	m_rows[2] = i_row2.m_value;
+	m_rows[3] = i_row3.m_value;
+}
+
+#endif	// EAE6320_MATH_CSIMDMATRIX_INL
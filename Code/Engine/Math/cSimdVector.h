@@ -0,0 +1,115 @@
+/*
+	This class represents a position or direction stored in a single SIMD register
+
+	It is meant for the hot paths (physics, transforms, culling)
+	where the overhead of the scalar cVector operators adds up;
+	the functions are all inline so that they can be inlined across translation units.
+
+	SSE2 is the baseline (every x64 CPU has it);
+	if the project is compiled with /arch:AVX (which defines __AVX__)
+	the SSE4.1 dot product instruction is used as well.
+*/
+
+#ifndef EAE6320_MATH_CSIMDVECTOR_H
+#define EAE6320_MATH_CSIMDVECTOR_H
+
+// Header Files
+//=============
+
+#include <emmintrin.h>
+#if defined( __AVX__ )
+	#include <immintrin.h>
+#endif
+
+#include "cVector.h"
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+	namespace Math
+	{
+		class alignas( 16 ) cSimdVector
+		{
+			// Interface
+			//==========
+
+		public:
+
+			// Addition
+			cSimdVector operator +( const cSimdVector i_rhs ) const;
+			cSimdVector& operator +=( const cSimdVector i_rhs );
+
+			// Subtraction / Negation
+			cSimdVector operator -( const cSimdVector i_rhs ) const;
+			cSimdVector& operator -=( const cSimdVector i_rhs );
+			cSimdVector operator -() const;
+
+			// Multiplication
+			cSimdVector operator *( const float i_rhs ) const;
+			cSimdVector operator *( const cSimdVector i_rhs ) const;	// Component-wise
+			cSimdVector& operator *=( const float i_rhs );
+			friend cSimdVector operator *( const float i_lhs, const cSimdVector i_rhs );
+
+			// Division
+			cSimdVector operator /( const float i_rhs ) const;
+			cSimdVector& operator /=( const float i_rhs );
+
+			// Length / Normalization
+			float GetLength() const;
+			float GetLengthSquared() const;
+			float Normalize();
+			cSimdVector CreateNormalized() const;
+
+			// Products
+			friend float Dot( const cSimdVector i_lhs, const cSimdVector i_rhs );
+			friend cSimdVector Cross( const cSimdVector i_lhs, const cSimdVector i_rhs );
+
+			// Component-wise
+			friend cSimdVector Min( const cSimdVector i_lhs, const cSimdVector i_rhs );
+			friend cSimdVector Max( const cSimdVector i_lhs, const cSimdVector i_rhs );
+			cSimdVector GetAbsolute() const;
+
+			// Access
+			float GetX() const;
+			float GetY() const;
+			float GetZ() const;
+			float GetW() const;
+
+			// Conversion
+			// (cVector converts implicitly to a cSimdVector;
+			// going the other way must be explicit so that mixed expressions aren't ambiguous)
+			cVector ToVector() const;
+
+			// Initialization / Shut Down
+			//---------------------------
+
+			cSimdVector();	// Zero
+			cSimdVector( const float i_x, const float i_y, const float i_z, const float i_w = 0.0f );
+			cSimdVector( const cVector& i_vector );
+			explicit cSimdVector( const __m128 i_value );
+
+			// Data
+			//=====
+
+		// As with cVector, the data is public so that other SIMD code can work with the register directly
+		public:
+
+			__m128 m_value;
+		};
+
+		// Friend Function Declarations
+		//=============================
+
+		cSimdVector operator *( const float i_lhs, const cSimdVector i_rhs );
+		float Dot( const cSimdVector i_lhs, const cSimdVector i_rhs );
+		cSimdVector Cross( const cSimdVector i_lhs, const cSimdVector i_rhs );
+		cSimdVector Min( const cSimdVector i_lhs, const cSimdVector i_rhs );
+		cSimdVector Max( const cSimdVector i_lhs, const cSimdVector i_rhs );
+	}
+}
+
+#include "cSimdVector.inl"
+
+#endif	// EAE6320_MATH_CSIMDVECTOR_H
@@ -0,0 +1,209 @@
+#ifndef EAE6320_MATH_CSIMDVECTOR_INL
+#define EAE6320_MATH_CSIMDVECTOR_INL
+
+// Header Files
+//=============
+
+#include "cSimdVector.h"
+
+#include <cmath>
+#include "../Asserts/Asserts.h"
+
+// Helper Function Definitions
+//============================
+
+namespace eae6320
+{
+	namespace Math
+	{
+		namespace SimdInternal
+		{
+			// Returns the 3 element dot product (the w lanes are ignored) in every lane
+			inline __m128 Dot3_splat( const __m128 i_lhs, const __m128 i_rhs )
+			{
+#if defined( __AVX__ )
+				return _mm_dp_ps( i_lhs, i_rhs, 0x7f );
+#else
+				const __m128 product = _mm_mul_ps( i_lhs, i_rhs );
+				const __m128 x = _mm_shuffle_ps( product, product, _MM_SHUFFLE( 0, 0, 0, 0 ) );
+				const __m128 y = _mm_shuffle_ps( product, product, _MM_SHUFFLE( 1, 1, 1, 1 ) );
+				const __m128 z = _mm_shuffle_ps( product, product, _MM_SHUFFLE( 2, 2, 2, 2 ) );
+				return _mm_add_ps( _mm_add_ps( x, y ), z );
+#endif
+			}
+		}
+	}
+}
+
+// Interface
+//==========
+
+// Addition
+inline eae6320::Math::cSimdVector eae6320::Math::cSimdVector::operator +( const cSimdVector i_rhs ) const
+{
+	return cSimdVector( _mm_add_ps( m_value, i_rhs.m_value ) );
+}
+inline eae6320::Math::cSimdVector& eae6320::Math::cSimdVector::operator +=( const cSimdVector i_rhs )
+{
+	m_value = _mm_add_ps( m_value, i_rhs.m_value );
+	return *this;
+}
+
+// Subtraction / Negation
+inline eae6320::Math::cSimdVector eae6320::Math::cSimdVector::operator -( const cSimdVector i_rhs ) const
+{
+	return cSimdVector( _mm_sub_ps( m_value, i_rhs.m_value ) );
+}
+inline eae6320::Math::cSimdVector& eae6320::Math::cSimdVector::operator -=( const cSimdVector i_rhs )
+{
+	m_value = _mm_sub_ps( m_value, i_rhs.m_value );
+	return *this;
+}
+inline eae6320::Math::cSimdVector eae6320::Math::cSimdVector::operator -() const
+{
+	// Flipping the sign bit is cheaper than subtracting from zero
+	return cSimdVector( _mm_xor_ps( m_value, _mm_set1_ps( -0.0f ) ) );
+}
+
+// Multiplication
+inline eae6320::Math::cSimdVector eae6320::Math::cSimdVector::operator *( const float i_rhs ) const
+{
+	return cSimdVector( _mm_mul_ps( m_value, _mm_set1_ps( i_rhs ) ) );
+}
+inline eae6320::Math::cSimdVector eae6320::Math::cSimdVector::operator *( const cSimdVector i_rhs ) const
+{
+	return cSimdVector( _mm_mul_ps( m_value, i_rhs.m_value ) );
+}
+inline eae6320::Math::cSimdVector& eae6320::Math::cSimdVector::operator *=( const float i_rhs )
+{
+	m_value = _mm_mul_ps( m_value, _mm_set1_ps( i_rhs ) );
+	return *this;
+}
+inline eae6320::Math::cSimdVector eae6320::Math::operator *( const float i_lhs, const cSimdVector i_rhs )
+{
+	return i_rhs * i_lhs;
+}
+
+// Division
+inline eae6320::Math::cSimdVector eae6320::Math::cSimdVector::operator /( const float i_rhs ) const
+{
+	EAE6320_ASSERTF( std::abs( i_rhs ) > 1.0e-9f, "Can't divide by zero" );
+	return cSimdVector( _mm_div_ps( m_value, _mm_set1_ps( i_rhs ) ) );
+}
+inline eae6320::Math::cSimdVector& eae6320::Math::cSimdVector::operator /=( const float i_rhs )
+{
+	EAE6320_ASSERTF( std::abs( i_rhs ) > 1.0e-9f, "Can't divide by zero" );
+	m_value = _mm_div_ps( m_value, _mm_set1_ps( i_rhs ) );
+	return *this;
+}
+
+// Length / Normalization
+inline float eae6320::Math::cSimdVector::GetLength() const
+{
+	return _mm_cvtss_f32( _mm_sqrt_ss( SimdInternal::Dot3_splat( m_value, m_value ) ) );
+}
+inline float eae6320::Math::cSimdVector::GetLengthSquared() const
+{
+	return _mm_cvtss_f32( SimdInternal::Dot3_splat( m_value, m_value ) );
+}
+inline float eae6320::Math::cSimdVector::Normalize()
+{
+	const __m128 length = _mm_sqrt_ps( SimdInternal::Dot3_splat( m_value, m_value ) );
+	EAE6320_ASSERTF( _mm_cvtss_f32( length ) > 1.0e-9f, "Can't divide by zero" );
+	m_value = _mm_div_ps( m_value, length );
+	return _mm_cvtss_f32( length );
+}
+inline eae6320::Math::cSimdVector eae6320::Math::cSimdVector::CreateNormalized() const
+{
+	const __m128 length = _mm_sqrt_ps( SimdInternal::Dot3_splat( m_value, m_value ) );
+	EAE6320_ASSERTF( _mm_cvtss_f32( length ) > 1.0e-9f, "Can't divide by zero" );
+	return cSimdVector( _mm_div_ps( m_value, length ) );
+}
+
+// Products
+inline float eae6320::Math::Dot( const cSimdVector i_lhs, const cSimdVector i_rhs )
+{
+	return _mm_cvtss_f32( SimdInternal::Dot3_splat( i_lhs.m_value, i_rhs.m_value ) );
+}
+inline eae6320::Math::cSimdVector eae6320::Math::Cross( const cSimdVector i_lhs, const cSimdVector i_rhs )
+{
+	// (l.y * r.z - l.z * r.y, l.z * r.x - l.x * r.z, l.x * r.y - l.y * r.x),
+	// which can be computed with one fewer shuffle by crossing in the yzx order and shuffling the result back
+	const __m128 lhs_yzx = _mm_shuffle_ps( i_lhs.m_value, i_lhs.m_value, _MM_SHUFFLE( 3, 0, 2, 1 ) );
+	const __m128 rhs_yzx = _mm_shuffle_ps( i_rhs.m_value, i_rhs.m_value, _MM_SHUFFLE( 3, 0, 2, 1 ) );
+	const __m128 result_zxy = _mm_sub_ps( _mm_mul_ps( i_lhs.m_value, rhs_yzx ), _mm_mul_ps( lhs_yzx, i_rhs.m_value ) );
+	return cSimdVector( _mm_shuffle_ps( result_zxy, result_zxy, _MM_SHUFFLE( 3, 0, 2, 1 ) ) );
+}
+
+// Component-wise
+inline eae6320::Math::cSimdVector eae6320::Math::Min( const cSimdVector i_lhs, const cSimdVector i_rhs )
+{
+	return cSimdVector( _mm_min_ps( i_lhs.m_value, i_rhs.m_value ) );
+}
+inline eae6320::Math::cSimdVector eae6320::Math::Max( const cSimdVector i_lhs, const cSimdVector i_rhs )
+{
+	return cSimdVector( _mm_max_ps( i_lhs.m_value, i_rhs.m_value ) );
+}
+inline eae6320::Math::cSimdVector eae6320::Math::cSimdVector::GetAbsolute() const
+{
+	return cSimdVector( _mm_andnot_ps( _mm_set1_ps( -0.0f ), m_value ) );
+}
+
+// Access
+inline float eae6320::Math::cSimdVector::GetX() const
+{
+	return _mm_cvtss_f32( m_value );
+}
+inline float eae6320::Math::cSimdVector::GetY() const
+{
+	return _mm_cvtss_f32( _mm_shuffle_ps( m_value, m_value, _MM_SHUFFLE( 1, 1, 1, 1 ) ) );
+}
+inline float eae6320::Math::cSimdVector::GetZ() const
+{
+	return _mm_cvtss_f32( _mm_shuffle_ps( m_value, m_value, _MM_SHUFFLE( 2, 2, 2, 2 ) ) );
+}
+inline float eae6320::Math::cSimdVector::GetW() const
+{
+	return _mm_cvtss_f32( _mm_shuffle_ps( m_value, m_value, _MM_SHUFFLE( 3, 3, 3, 3 ) ) );
+}
+
+// Conversion
+inline eae6320::Math::cVector eae6320::Math::cSimdVector::ToVector() const
+{
+	alignas( 16 ) float components[4];
+	_mm_store_ps( components, m_value );
+	return cVector( components[0], components[1], components[2] );
+}
+
+// Initialization / Shut Down
+//---------------------------
+
+inline eae6320::Math::cSimdVector::cSimdVector()
+	:
+	m_value( _mm_setzero_ps() )
+{
+
+}
+
+inline eae6320::Math::cSimdVector::cSimdVector( const float i_x, const float i_y, const float i_z, const float i_w )
+	:
+	m_value( _mm_set_ps( i_w, i_z, i_y, i_x ) )
+{
+
+}
+
+inline eae6320::Math::cSimdVector::cSimdVector( const cVector& i_vector )
+	:
+	m_value( _mm_set_ps( 0.0f, i_vector.z, i_vector.y, i_vector.x ) )
+{
+
+}
+
+inline eae6320::Math::cSimdVector::cSimdVector( const __m128 i_value )
+	:
+	m_value( i_value )
+{
+
+}
+
+#endif	// EAE6320_MATH_CSIMDVECTOR_INL
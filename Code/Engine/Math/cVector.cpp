@@ -18,10 +18,6 @@ namespace
 //==========
 
 // Addition
-eae6320::Math::cVector eae6320::Math::cVector::operator +( const cVector& i_rhs ) const
-{
-	return cVector( x + i_rhs.x, y + i_rhs.y, z + i_rhs.z );
-}
 eae6320::Math::cVector& eae6320::Math::cVector::operator +=( const cVector& i_rhs )
 {
 	x += i_rhs.x;
@@ -31,10 +27,6 @@ eae6320::Math::cVector& eae6320::Math::cVector::operator +=( const cVector& i_rh
 }
 
 // Subtraction / Negation
-eae6320::Math::cVector eae6320::Math::cVector::operator -( const cVector& i_rhs ) const
-{
-	return cVector( x - i_rhs.x, y - i_rhs.y, z - i_rhs.z );
-}
 eae6320::Math::cVector& eae6320::Math::cVector::operator -=( const cVector& i_rhs )
 {
 	x -= i_rhs.x;
@@ -42,16 +34,8 @@ eae6320::Math::cVector& eae6320::Math::cVector::operator -=( const cVector& i_rh
 	z -= i_rhs.z;
 	return *this;
 }
-eae6320::Math::cVector eae6320::Math::cVector::operator -() const
-{
-	return cVector( -x, -y, -z );
-}
 
 // Multiplication
-eae6320::Math::cVector eae6320::Math::cVector::operator *( const float i_rhs ) const
-{
-	return cVector( x * i_rhs, y * i_rhs, z * i_rhs );
-}
 eae6320::Math::cVector& eae6320::Math::cVector::operator *=( const float i_rhs )
 {
 	x *= i_rhs;
@@ -59,10 +43,6 @@ eae6320::Math::cVector& eae6320::Math::cVector::operator *=( const float i_rhs )
 	z *= i_rhs;
 	return *this;
 }
-eae6320::Math::cVector operator *( const float i_lhs, const eae6320::Math::cVector& i_rhs )
-{
-	return i_rhs * i_lhs;
-}
 
 // Division
 eae6320::Math::cVector eae6320::Math::cVector::operator /( const float i_rhs ) const
@@ -101,41 +81,7 @@ eae6320::Math::cVector eae6320::Math::cVector::CreateNormalized() const
 	return cVector( x * length_reciprocal, y * length_reciprocal, z * length_reciprocal );
 }
 
-// Products
-float eae6320::Math::Dot( const cVector& i_lhs, const cVector& i_rhs )
-{
-	return ( i_lhs.x * i_rhs.x ) + ( i_lhs.y * i_rhs.y ) + ( i_lhs.z * i_rhs.z );
-}
-eae6320::Math::cVector eae6320::Math::Cross( const cVector& i_lhs, const cVector& i_rhs )
-{
-	return cVector(
-		( i_lhs.y * i_rhs.z ) - ( i_lhs.z * i_rhs.y ),
-		( i_lhs.z * i_rhs.x ) - ( i_lhs.x * i_rhs.z ),
-		( i_lhs.x * i_rhs.y ) - ( i_lhs.y * i_rhs.x ) );
-}
-
-// Comparison
-bool eae6320::Math::cVector::operator ==( const cVector& i_rhs ) const
-{
-	// Use & rather than && to prevent branches (all three comparisons will be evaluated)
-	return ( x == i_rhs.x ) & ( y == i_rhs.y ) & ( z == i_rhs.z );
-}
-bool eae6320::Math::cVector::operator !=( const cVector& i_rhs ) const
-{
-	// Use | rather than || to prevent branches (all three comparisons will be evaluated)
-	return ( x != i_rhs.x ) | ( y != i_rhs.y ) | ( z != i_rhs.z );
-}
-
-// Initialization / Shut Down
-//---------------------------
-
-eae6320::Math::cVector::cVector( const float i_x, const float i_y, const float i_z )
-	:
-	x( i_x ), y( i_y ), z( i_z )
-{
-
-}
-
+// Rotation
 eae6320::Math::cVector eae6320::Math::QuatVector(const cQuaternion& quat, const cVector& vec)
 {
 	float num = quat.m_x * 2.0f;
@@ -157,9 +103,3 @@ eae6320::Math::cVector eae6320::Math::QuatVector(const cQuaternion& quat, const
 	return result;
 }
 
-float eae6320::Math::DistanceSq(const cVector& i_lhs, const cVector& i_rhs) {
-	const float x = i_lhs.x - i_rhs.x;
-	const float y = i_lhs.y - i_rhs.y;
-	const float z = i_lhs.z - i_rhs.z;
-	return x*x + y*y + z*z;
-}
\ No newline at end of file
@@ -1,5 +1,9 @@
 /*
 	This class represents a position or direction
+
+	It is a literal type, and so vectors made from constants
+	(and the results of the constexpr operators on them)
+	are calculated at compile time rather than during static initialization
 */
 
 #ifndef EAE6320_MATH_CVECTOR_H
@@ -20,18 +24,18 @@ namespace eae6320
 		public:
 
 			// Addition
-			cVector operator +( const cVector& i_rhs ) const;
+			constexpr cVector operator +( const cVector& i_rhs ) const;
 			cVector& operator +=( const cVector& i_rhs );
 
 			// Subtraction / Negation
-			cVector operator -( const cVector& i_rhs ) const;
+			constexpr cVector operator -( const cVector& i_rhs ) const;
 			cVector& operator -=( const cVector& i_rhs );
-			cVector operator -() const;
+			constexpr cVector operator -() const;
 
 			// Multiplication
-			cVector operator *( const float i_rhs ) const;
+			constexpr cVector operator *( const float i_rhs ) const;
 			cVector& operator *=( const float i_rhs );
-			friend cVector operator *( const float i_lhs, const cVector& i_rhs );
+			friend constexpr cVector operator *( const float i_lhs, const cVector& i_rhs );
 
 			// Division
 			cVector operator /( const float i_rhs ) const;
@@ -43,17 +47,17 @@ namespace eae6320
 			cVector CreateNormalized() const;
 
 			// Products
-			friend float Dot( const cVector& i_lhs, const cVector& i_rhs );
-			friend cVector Cross( const cVector& i_lhs, const cVector& i_rhs );
+			friend constexpr float Dot( const cVector& i_lhs, const cVector& i_rhs );
+			friend constexpr cVector Cross( const cVector& i_lhs, const cVector& i_rhs );
 			cVector QuatVector(const cQuaternion& i_lhs, const cVector& i_rhs);
 			// Comparison
-			bool operator ==( const cVector& i_rhs ) const;
-			bool operator !=( const cVector& i_rhs ) const;
+			constexpr bool operator ==( const cVector& i_rhs ) const;
+			constexpr bool operator !=( const cVector& i_rhs ) const;
 
 			// Initialization / Shut Down
 			//---------------------------
 
-			cVector( const float i_x = 0.0f, const float i_y = 0.0f, const float i_z = 0.0f );
+			constexpr cVector( const float i_x = 0.0f, const float i_y = 0.0f, const float i_z = 0.0f );
 
 			// Data
 			//=====
@@ -74,11 +78,13 @@ namespace eae6320
 		//=============================
 
 		cVector QuatVector(const cQuaternion& i_lhs, const cVector& i_rhs);
-		cVector operator *( const float i_lhs, const cVector& i_rhs );
-		float Dot( const cVector& i_lhs, const cVector& i_rhs );
-		cVector Cross( const cVector& i_lhs, const cVector& i_rhs );
-		float DistanceSq(const cVector& i_lhs, const cVector& i_rhs);
+		constexpr cVector operator *( const float i_lhs, const cVector& i_rhs );
+		constexpr float Dot( const cVector& i_lhs, const cVector& i_rhs );
+		constexpr cVector Cross( const cVector& i_lhs, const cVector& i_rhs );
+		constexpr float DistanceSq( const cVector& i_lhs, const cVector& i_rhs );
 	}
 }
 
+#include "cVector.inl"
+
 #endif	// EAE6320_MATH_CVECTOR_H
@@ -0,0 +1,77 @@
+#ifndef EAE6320_MATH_CVECTOR_INL
+#define EAE6320_MATH_CVECTOR_INL
+
+// Header Files
+//=============
+
+#include "cVector.h"
+
+// Interface
+//==========
+
+// Addition
+constexpr eae6320::Math::cVector eae6320::Math::cVector::operator +( const cVector& i_rhs ) const
+{
+	return cVector( x + i_rhs.x, y + i_rhs.y, z + i_rhs.z );
+}
+
+// Subtraction / Negation
+constexpr eae6320::Math::cVector eae6320::Math::cVector::operator -( const cVector& i_rhs ) const
+{
+	return cVector( x - i_rhs.x, y - i_rhs.y, z - i_rhs.z );
+}
+constexpr eae6320::Math::cVector eae6320::Math::cVector::operator -() const
+{
+	return cVector( -x, -y, -z );
+}
+
+// Multiplication
+constexpr eae6320::Math::cVector eae6320::Math::cVector::operator *( const float i_rhs ) const
+{
+	return cVector( x * i_rhs, y * i_rhs, z * i_rhs );
+}
+constexpr eae6320::Math::cVector eae6320::Math::operator *( const float i_lhs, const cVector& i_rhs )
+{
+	return i_rhs * i_lhs;
+}
+
+// Products
+constexpr float eae6320::Math::Dot( const cVector& i_lhs, const cVector& i_rhs )
+{
+	return ( i_lhs.x * i_rhs.x ) + ( i_lhs.y * i_rhs.y ) + ( i_lhs.z * i_rhs.z );
+}
+constexpr eae6320::Math::cVector eae6320::Math::Cross( const cVector& i_lhs, const cVector& i_rhs )
+{
+	return cVector(
+		( i_lhs.y * i_rhs.z ) - ( i_lhs.z * i_rhs.y ),
+		( i_lhs.z * i_rhs.x ) - ( i_lhs.x * i_rhs.z ),
+		( i_lhs.x * i_rhs.y ) - ( i_lhs.y * i_rhs.x ) );
+}
+constexpr float eae6320::Math::DistanceSq( const cVector& i_lhs, const cVector& i_rhs )
+{
+	return Dot( i_lhs - i_rhs, i_lhs - i_rhs );
+}
+
+// Comparison
+constexpr bool eae6320::Math::cVector::operator ==( const cVector& i_rhs ) const
+{
+	// Use & rather than && to prevent branches (all three comparisons will be evaluated)
+	return ( x == i_rhs.x ) & ( y == i_rhs.y ) & ( z == i_rhs.z );
+}
+constexpr bool eae6320::Math::cVector::operator !=( const cVector& i_rhs ) const
+{
+	// Use | rather than || to prevent branches (all three comparisons will be evaluated)
+	return ( x != i_rhs.x ) | ( y != i_rhs.y ) | ( z != i_rhs.z );
+}
+
+// Initialization / Shut Down
+//---------------------------
+
+constexpr eae6320::Math::cVector::cVector( const float i_x, const float i_y, const float i_z )
+	:
+	x( i_x ), y( i_y ), z( i_z )
+{
+
+}
+
+#endif	// EAE6320_MATH_CVECTOR_INL
@@ -1,4 +1,8 @@
 #include "Networking.h"
+#include "../Math/BoundingVolumes.h"
+#include "../Math/cQuaternion.h"
+#include "../Math/Functions.h"
+#include "../Math/Quantization.h"
 #include "../../External/RakNet/Source/WindowsIncludes.h"
 #include "../../External/RakNet/Source/RakPeerInterface.h"
 #include "../../External/RakNet/Source/MessageIdentifiers.h"
@@ -27,9 +31,17 @@ namespace {
 	eae6320::Networking::sPlayerData* s_main_player;
 	std::function<void(eae6320::Networking::sPlayerData*)> s_remote_player_callback;
 
+	// Positions are sent as 16-bit fractions of these bounds,
+	// which gives steps of 0.125 units (far smaller than anything a player could notice)
+	constexpr eae6320::Math::sAABB s_playerPositionBounds = {
+		eae6320::Math::cVector(-4096.0f, -4096.0f, -4096.0f), eae6320::Math::cVector(4096.0f, 4096.0f, 4096.0f) };
+
 	bool LoadMeshScript(const char* i_path, eae6320::Networking::eSession* o_session);
 	bool LoadTableValues(lua_State& io_luaState, eae6320::Networking::eSession* o_session);
-
+	// The player data is quantized when it is sent
+	// (19 bytes instead of the 36 bytes of sPlayerData)
+	void WritePlayerData(const eae6320::Networking::sPlayerData& i_playerData, RakNet::BitStream& io_bitStream);
+	void ReadPlayerData(RakNet::BitStream& io_bitStream, eae6320::Networking::sPlayerData& o_playerData);
 }
 bool eae6320::Networking::Initialize()
 {
@@ -70,11 +82,7 @@ void eae6320::Networking::Update()
 	{
 		RakNet::BitStream bsOut;
 		bsOut.Write(static_cast<RakNet::MessageID>(ID_GAME_MESSAGE_1));
-		{
-			const char* data = reinterpret_cast<char*>(s_main_player);
-			const unsigned int size = sizeof(eae6320::Networking::sPlayerData);
-			bsOut.Write(data, size);
-		}
+		WritePlayerData(*s_main_player, bsOut);
 		s_peer->Send(&bsOut, HIGH_PRIORITY, RELIABLE_ORDERED, 0, s_peer->GetMyGUID(), true);
 	}
 
@@ -103,11 +111,9 @@ void eae6320::Networking::Update()
 		case ID_GAME_MESSAGE_1:
 		{
 			sPlayerData playerData;
-			unsigned int noOfBytes = sizeof(sPlayerData);
-			char* output = reinterpret_cast<char*>(&playerData);
 			RakNet::BitStream bsIn(packet->data, packet->length, false);
 			bsIn.IgnoreBytes(sizeof(RakNet::MessageID));
-			bsIn.Read(output, noOfBytes);
+			ReadPlayerData(bsIn, playerData);
 			s_remote_player_callback(&playerData);
 		}
 		break;
@@ -218,4 +224,42 @@ namespace {
 		}
 		return !wereThereErrors;
 	}
+
+	void WritePlayerData(const eae6320::Networking::sPlayerData& i_playerData, RakNet::BitStream& io_bitStream)
+	{
+		const eae6320::Math::sQuantizedPosition position = eae6320::Math::QuantizePosition(i_playerData.m_position, s_playerPositionBounds);
+		io_bitStream.Write(position.x);
+		io_bitStream.Write(position.y);
+		io_bitStream.Write(position.z);
+		// The rotation is stored as Euler angles in degrees
+		const eae6320::Math::cVector rotation_radians(eae6320::Math::ConvertDegreesToRadians(i_playerData.m_rotation.x),
+			eae6320::Math::ConvertDegreesToRadians(i_playerData.m_rotation.y), eae6320::Math::ConvertDegreesToRadians(i_playerData.m_rotation.z));
+		io_bitStream.Write(eae6320::Math::EncodeRotation(eae6320::Math::cQuaternion::CreateFromEulerAngles(rotation_radians)));
+		io_bitStream.Write(static_cast<uint8_t>(i_playerData.m_hasFalg ? 1 : 0));
+		io_bitStream.Write(static_cast<int32_t>(i_playerData.m_score));
+		io_bitStream.Write(i_playerData.m_speed);
+	}
+
+	void ReadPlayerData(RakNet::BitStream& io_bitStream, eae6320::Networking::sPlayerData& o_playerData)
+	{
+		eae6320::Math::sQuantizedPosition position;
+		io_bitStream.Read(position.x);
+		io_bitStream.Read(position.y);
+		io_bitStream.Read(position.z);
+		o_playerData.m_position = eae6320::Math::DequantizePosition(position, s_playerPositionBounds);
+		uint32_t rotation;
+		io_bitStream.Read(rotation);
+		// The decoded angles may be different from the ones that were sent,
+		// but they represent the same orientation
+		const eae6320::Math::cVector rotation_radians = eae6320::Math::DecodeRotation(rotation).GetEulerAngles();
+		o_playerData.m_rotation = eae6320::Math::cVector(eae6320::Math::ConvertRadiansToDegrees(rotation_radians.x),
+			eae6320::Math::ConvertRadiansToDegrees(rotation_radians.y), eae6320::Math::ConvertRadiansToDegrees(rotation_radians.z));
+		uint8_t hasFlag;
+		io_bitStream.Read(hasFlag);
+		o_playerData.m_hasFalg = (hasFlag != 0);
+		int32_t score;
+		io_bitStream.Read(score);
+		o_playerData.m_score = score;
+		io_bitStream.Read(o_playerData.m_speed);
+	}
 }
\ No newline at end of file
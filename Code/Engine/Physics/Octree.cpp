@@ -1,4 +1,5 @@
 #include "Octree.h"
+#include <map>
 #include <vector>
 #include <math.h>
 #include "../Platform/Platform.h"
@@ -8,6 +9,10 @@ namespace {
 	uint16_t s_noOfNodes = 0;
 	std::vector<eae6320::Physics::Octree::NodeData> s_nodeData;
 	eae6320::Graphics::DebugObject debugBox[585];
+	// Every node at the same depth is the same size and color,
+	// and so each depth only needs a single box mesh
+	// (which lets every box at that depth be drawn with a single instanced draw call)
+	std::map<uint8_t, eae6320::Graphics::Mesh*> s_boxMeshes;
 }
 
 bool eae6320::Physics::Octree::Initialise()
@@ -89,7 +94,13 @@ void eae6320::Physics::Octree::Compute()
 			g = 255;
 			b = 0;
 		}
-		debugBox[i].drawBoxDebugObject(material, center, Math::cVector(), temp.m_cube.m_width, temp.m_cube.m_width, temp.m_cube.m_width, r, g, b, 1);
+		Graphics::Mesh*& boxMesh = s_boxMeshes[temp.m_depth];
+		if (!boxMesh)
+		{
+			boxMesh = new Graphics::Mesh();
+			boxMesh->DrawCube(temp.m_cube.m_width, temp.m_cube.m_width, temp.m_cube.m_width, r, g, b, 1);
+		}
+		debugBox[i].drawSharedDebugObject(material, boxMesh, center, Math::cVector());
 		i++;
 	}
 }
@@ -97,30 +108,29 @@ void eae6320::Physics::Octree::Compute()
 void eae6320::Physics::Octree::displayOctree()
 {
 	for (int i = 0; i < 585; i++) {
-		Graphics::SetMesh(debugBox[i].meshObject);
+		Graphics::SetMesh(debugBox[i].GetMeshObject());
 	}
 }
 
 eae6320::Physics::Octree::NodeData eae6320::Physics::Octree::GetNodeFromPoint(const eae6320::Math::cVector& i_point) {
 	const uint8_t MAX_DEPTH = 3;
-	for (auto node : s_nodeData) {
-		if (node.m_depth = MAX_DEPTH && node.m_no_tris>0) {
-			const float half_width = node.m_cube.m_width / 2.0f;
-			const float px = i_point.x;
-			const float py = i_point.y;
-			const float pz = i_point.z;
-			const eae6320::Math::cVector center(node.m_cube.m_center.x[0], node.m_cube.m_center.x[1], node.m_cube.m_center.x[2]);
-			const float dist_x = fabs(px - center.x);
-			const float dist_y = fabs(py - center.y);
-			const float dist_z = fabs(pz - center.z);
-
-			if (dist_x <= half_width || dist_y <= half_width || dist_z <= half_width)
+	for (const auto& node : s_nodeData) {
+		if (node.m_depth == MAX_DEPTH && node.m_no_tris>0) {
+			if (node.m_cube.GetBounds().Contains(i_point))
 				return node;
 		}
 
 	}
 	return s_nodeData[0];
 }
+
+eae6320::Math::sAABB eae6320::Physics::Octree::NodeData::CubeData::GetBounds() const
+{
+	const float half_width = m_width / 2.0f;
+	return Math::sAABB::CreateFromCenterAndHalfExtents(Math::cVector(m_center.x[0], m_center.x[1], m_center.x[2]),
+		Math::cVector(half_width, half_width, half_width));
+}
+
 void eae6320::Physics::Octree::CleanUp()
 {
 	for (auto temp : s_nodeData) {
@@ -133,4 +143,8 @@ void eae6320::Physics::Octree::CleanUp()
 	for (int i = 0; i < 585; i++) {
 		debugBox[i].cleanUp();
 	}
+	for (auto& boxMesh : s_boxMeshes) {
+		delete boxMesh.second;
+	}
+	s_boxMeshes.clear();
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define EAE6320_OCTREE_H
 
 #include"../Math/cVector.h"
+#include"../Math/BoundingVolumes.h"
 #include <cstdint>
 
 namespace eae6320 
@@ -20,6 +21,7 @@ namespace eae6320
 					};
 					sPos m_center;
 					float m_width;
+					Math::sAABB GetBounds() const;
 				};
 				CubeData m_cube;
 				uint8_t m_depth;
@@ -1,4 +1,6 @@
 #include "Physics.h"
+#include "../Math/BoundingVolumes.h"
+#include "../Math/cSimdVector.h"
 #include "../Graphics/VertexData.h"
 #include "../Platform/Platform.h"
 #include "TriangleData.h"
@@ -7,6 +9,11 @@
 namespace {
 	uint32_t noOfTris = 0;
 	eae6320::Physics::sTriangle* triangles = NULL;
+	// The bounds of each triangle are used to quickly reject triangles that a probe segment can't possibly hit
+	std::vector<eae6320::Math::sAABB> s_triangleBounds;
+	// This is reused every time so that no memory is allocated while checking collisions
+	std::vector<uint32_t> s_candidateTriangles;
+	void GatherCandidateTriangles(const eae6320::Math::cVector& i_p, const eae6320::Math::cVector& i_q);
 }
 
 void eae6320::Physics::CheckCollision(Graphics::GameObject* gameObject)
@@ -17,7 +24,8 @@ void eae6320::Physics::CheckCollision(Graphics::GameObject* gameObject)
 	{
 		Math::cVector q = (gameObject->transform.getPosition()) - Math::cVector(0, gameObject->rigidBody.height, 0);
 		bool hasIntersected = false;
-		for (size_t i = 0; i < noOfTris; ++i) {
+		GatherCandidateTriangles(p, q);
+		for (const uint32_t i : s_candidateTriangles) {
 			float u, v, w, t;
 			if (IntersectSegmentTriangle(p, q, triangles[i].A, triangles[i].B, triangles[i].C, &u, &v, &w, &t)) {
 				hasIntersected = true;
@@ -38,7 +46,8 @@ void eae6320::Physics::CheckCollision(Graphics::GameObject* gameObject)
 	}
 	{
 		Math::cVector q = (gameObject->transform.getPosition()) - Math::cVector(0, 0, gameObject->rigidBody.width);
-		for (size_t i = 0; i < noOfTris; ++i) {
+		GatherCandidateTriangles(p, q);
+		for (const uint32_t i : s_candidateTriangles) {
 			float u, v, w, t;
 			if (IntersectSegmentTriangle(p, q, triangles[i].A, triangles[i].B, triangles[i].C, &u, &v, &w, &t)) {
 				const float tri_center_z = (triangles[i].A.z + triangles[i].B.z + triangles[i].C.z) / 3.0f;
@@ -50,8 +59,8 @@ void eae6320::Physics::CheckCollision(Graphics::GameObject* gameObject)
 	}
 	{
 		Math::cVector q = (gameObject->transform.getPosition()) + Math::cVector(0, 0, gameObject->rigidBody.width);
-
-		for (size_t i = 0; i < noOfTris; ++i) {
+		GatherCandidateTriangles(p, q);
+		for (const uint32_t i : s_candidateTriangles) {
 			float u, v, w, t;
 			if (IntersectSegmentTriangle(p, q, triangles[i].A, triangles[i].B, triangles[i].C, &u, &v, &w, &t)) {
 				const float tri_center_z = (triangles[i].A.z + triangles[i].B.z + triangles[i].C.z) / 3.0f;
@@ -63,7 +72,8 @@ void eae6320::Physics::CheckCollision(Graphics::GameObject* gameObject)
 	}
 	{
 		Math::cVector q = (gameObject->transform.getPosition()) - Math::cVector(gameObject->rigidBody.length, 0, 0);
-		for (size_t i = 0; i < noOfTris; ++i) {
+		GatherCandidateTriangles(p, q);
+		for (const uint32_t i : s_candidateTriangles) {
 			float u, v, w, t;
 			if (IntersectSegmentTriangle(p, q, triangles[i].A, triangles[i].B, triangles[i].C, &u, &v, &w, &t)) {
 				const float tri_center_x = (triangles[i].A.x + triangles[i].B.x + triangles[i].C.x) / 3.0f;
@@ -75,7 +85,8 @@ void eae6320::Physics::CheckCollision(Graphics::GameObject* gameObject)
 	}
 	{
 		Math::cVector q = (gameObject->transform.getPosition()) + Math::cVector(gameObject->rigidBody.length, 0, 0);
-		for (size_t i = 0; i < noOfTris; ++i) {
+		GatherCandidateTriangles(p, q);
+		for (const uint32_t i : s_candidateTriangles) {
 			float u, v, w, t;
 			if (IntersectSegmentTriangle(p, q, triangles[i].A, triangles[i].B, triangles[i].C, &u, &v, &w, &t)) {
 				const float tri_center_x = (triangles[i].A.x + triangles[i].B.x + triangles[i].C.x) / 3.0f;
@@ -89,13 +100,16 @@ void eae6320::Physics::CheckCollision(Graphics::GameObject* gameObject)
 
 int eae6320::Physics::IntersectSegmentTriangle(const Math::cVector& p, const Math::cVector& q, const Math::cVector& a, const Math::cVector& b, const Math::cVector& c, float *o_u, float *o_v, float *o_w, float *o_t)
 {
-	eae6320::Math::cVector ab = b - a;
-	eae6320::Math::cVector ac = c - a;
-	eae6320::Math::cVector qp = p - q;
+	// This is called for every triangle in the scene for every probe segment,
+	// and so the vector math is done in SIMD registers
+	const Math::cSimdVector simd_a(a);
+	const Math::cSimdVector ab = Math::cSimdVector(b) - simd_a;
+	const Math::cSimdVector ac = Math::cSimdVector(c) - simd_a;
+	const Math::cSimdVector qp = Math::cSimdVector(p) - Math::cSimdVector(q);
 
 	// Compute triangle normal. Can be precalculated or cached if
 	// intersecting multiple segments against the same triangle
-	eae6320::Math::cVector n = Cross(ab, ac);
+	const Math::cSimdVector n = Cross(ab, ac);
 	// Compute denominator d. If d <= 0, segment is parallel to or points
 	// away from triangle, so exit early
 	float d = Dot(qp, n);
@@ -104,13 +118,13 @@ int eae6320::Physics::IntersectSegmentTriangle(const Math::cVector& p, const Mat
 	// Compute intersection t value of pq with plane of triangle. A ray
 	// intersects if 0 <= t. Segment intersects if 0 <= t <= 1. Delay
 	// dividing by d until intersection has been found to pierce triangle
-	eae6320::Math::cVector ap = p - a;
+	const Math::cSimdVector ap = Math::cSimdVector(p) - simd_a;
 	*o_t = Dot(ap, n);
 	if (*o_t < 0.0f) return 0;
 	if (*o_t > d) return 0; // For segment; exclude this code line for a ray test
 
 						 // Compute barycentric coordinate components and test if within bounds
-	eae6320::Math::cVector e = Cross(qp, ap);
+	const Math::cSimdVector e = Cross(qp, ap);
 	*o_v = Dot(ac, e);
 	if (*o_v < 0.0f || *o_v > d) return 0;
 	*o_w = -Dot(ab, e);
@@ -141,9 +155,48 @@ bool eae6320::Physics::Load(const char* const i_path)
 			triangles = static_cast<eae6320::Physics::sTriangle*>(malloc(size));
 			memcpy(triangles, meshdata, size);
 		}
+		//Bounds
+		{
+			s_triangleBounds.resize(noOfTris);
+			for (uint32_t i = 0; i < noOfTris; ++i)
+			{
+				const Math::cVector vertices[] = { triangles[i].A, triangles[i].B, triangles[i].C };
+				s_triangleBounds[i] = Math::sAABB::CreateFromPoints(vertices, 3);
+			}
+			s_candidateTriangles.reserve(noOfTris);
+		}
 		return true;
 	}
 	else {
 		return false;
 	}
+}
+
+namespace {
+	void GatherCandidateTriangles(const eae6320::Math::cVector& i_p, const eae6320::Math::cVector& i_q)
+	{
+		// The smallest sphere containing the segment is tested against eight triangles' bounds at a time
+		const eae6320::Math::sSphere segmentBounds = { (i_p + i_q) * 0.5f, (i_q - i_p).GetLength() * 0.5f };
+		s_candidateTriangles.clear();
+		uint32_t i = 0;
+		for (; (i + 8) <= noOfTris; i += 8)
+		{
+			const uint32_t overlapMask = eae6320::Math::Overlaps8(segmentBounds, &s_triangleBounds[i]);
+			if (overlapMask != 0)
+			{
+				for (uint32_t j = 0; j < 8; ++j)
+				{
+					if (overlapMask & (1u << j))
+						s_candidateTriangles.push_back(i + j);
+				}
+			}
+		}
+		for (; i < noOfTris; ++i)
+		{
+			if (eae6320::Math::Overlaps(s_triangleBounds[i], segmentBounds))
+			{
+				s_candidateTriangles.push_back(i);
+			}
+		}
+	}
 }
\ No newline at end of file
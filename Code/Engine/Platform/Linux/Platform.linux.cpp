@@ -0,0 +1,326 @@
+// Header Files
+//=============
+
+#include "../Platform.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <sstream>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	std::string GetLastSystemError();
+	bool SetLastWriteTime( const char* const i_path, const timespec& i_time, std::string* const o_errorMessage );
+}
+
+// Interface
+//==========
+
+bool eae6320::Platform::CopyFile( const char* const i_path_source, const char* i_path_target,
+	const bool i_shouldFunctionFailIfTargetAlreadyExists, const bool i_shouldTargetFileTimeBeModified,
+	std::string* o_errorMessage )
+{
+	if ( i_shouldFunctionFailIfTargetAlreadyExists && DoesFileExist( i_path_target ) )
+	{
+		if ( o_errorMessage )
+		{
+			*o_errorMessage = std::string( "The file \"" ) + i_path_target + "\" already exists";
+		}
+		return false;
+	}
+	struct stat sourceInfo;
+	if ( stat( i_path_source, &sourceInfo ) != 0 )
+	{
+		if ( o_errorMessage )
+		{
+			*o_errorMessage = GetLastSystemError();
+		}
+		return false;
+	}
+	sDataFromFile dataFromFile;
+	if ( !LoadBinaryFile( i_path_source, dataFromFile, o_errorMessage ) )
+	{
+		return false;
+	}
+	const bool result = WriteBinaryFile( i_path_target, dataFromFile.data, dataFromFile.size, o_errorMessage );
+	dataFromFile.Free();
+	if ( !result )
+	{
+		return false;
+	}
+	// Windows keeps the source's last write time when copying,
+	// and so the same is done here unless the caller wants the target to be newer
+	if ( !i_shouldTargetFileTimeBeModified )
+	{
+		return SetLastWriteTime( i_path_target, sourceInfo.st_mtim, o_errorMessage );
+	}
+	return true;
+}
+
+bool eae6320::Platform::CreateDirectoryIfNecessary( const std::string& i_path, std::string* const o_errorMessage )
+{
+	// If the path is to a file (likely), remove it so that only the directory remains
+	std::string directory;
+	{
+		const size_t pos_slash = i_path.find_last_of( "\\/" );
+		if ( pos_slash != std::string::npos )
+		{
+			directory = i_path.substr( 0, pos_slash );
+		}
+		else
+		{
+			directory = i_path;
+		}
+	}
+	// Every directory in the path is created in order
+	for ( size_t pos_slash = directory.find_first_of( "\\/", 1 ); ; pos_slash = directory.find_first_of( "\\/", pos_slash + 1 ) )
+	{
+		const std::string parentDirectory = directory.substr( 0, pos_slash );
+		if ( !parentDirectory.empty() && ( mkdir( parentDirectory.c_str(), 0755 ) != 0 ) && ( errno != EEXIST ) )
+		{
+			if ( o_errorMessage )
+			{
+				*o_errorMessage = "Failed to create the directory \"" + parentDirectory + "\": " + GetLastSystemError();
+			}
+			return false;
+		}
+		if ( pos_slash == std::string::npos )
+		{
+			return true;
+		}
+	}
+}
+
+bool eae6320::Platform::DoesFileExist( const char* const i_path, std::string* const o_errorMessage )
+{
+	struct stat fileInfo;
+	if ( stat( i_path, &fileInfo ) == 0 )
+	{
+		return true;
+	}
+	else
+	{
+		if ( o_errorMessage )
+		{
+			*o_errorMessage = GetLastSystemError();
+		}
+		return false;
+	}
+}
+
+bool eae6320::Platform::ExecuteCommand( const char* const i_command, int* const o_exitCode, std::string* const o_errorMessage )
+{
+	const int result = std::system( i_command );
+	if ( ( result != -1 ) && WIFEXITED( result ) )
+	{
+		if ( o_exitCode )
+		{
+			*o_exitCode = WEXITSTATUS( result );
+		}
+		return true;
+	}
+	else
+	{
+		if ( o_errorMessage )
+		{
+			*o_errorMessage = std::string( "The command \"" ) + i_command + "\" couldn't be executed";
+		}
+		return false;
+	}
+}
+
+bool eae6320::Platform::GetEnvironmentVariable( const char* const i_key, std::string& o_value, std::string* const o_errorMessage )
+{
+	const char* const value = std::getenv( i_key );
+	if ( value )
+	{
+		o_value = value;
+		return true;
+	}
+	else
+	{
+		if ( o_errorMessage )
+		{
+			*o_errorMessage = std::string( "The environment variable \"" ) + i_key + "\" doesn't exist";
+		}
+		return false;
+	}
+}
+
+bool eae6320::Platform::GetLastWriteTime( const char* const i_path, uint64_t& o_lastWriteTime, std::string* const o_errorMessage )
+{
+	struct stat fileInfo;
+	if ( stat( i_path, &fileInfo ) == 0 )
+	{
+		// The time is only compared with other last write times,
+		// and so nanoseconds since the epoch work as well as the 100 nanosecond intervals that Windows uses
+		o_lastWriteTime = ( static_cast<uint64_t>( fileInfo.st_mtim.tv_sec ) * 1000000000u ) + static_cast<uint64_t>( fileInfo.st_mtim.tv_nsec );
+		return true;
+	}
+	else
+	{
+		if ( o_errorMessage )
+		{
+			*o_errorMessage = GetLastSystemError();
+		}
+		return false;
+	}
+}
+
+bool eae6320::Platform::InvalidateLastWriteTime( const char* const i_path, std::string* const o_errorMessage )
+{
+	// This is the same time that the Windows implementation uses (January 1st, 1980)
+	timespec earliestPossibleTime;
+	{
+		earliestPossibleTime.tv_sec = 315532800;
+		earliestPossibleTime.tv_nsec = 0;
+	}
+	return SetLastWriteTime( i_path, earliestPossibleTime, o_errorMessage );
+}
+
+bool eae6320::Platform::LoadBinaryFile( const char* const i_path, sDataFromFile& o_data, std::string* const o_errorMessage )
+{
+	bool wereThereErrors = false;
+
+	// Open the file
+	FILE* const file = std::fopen( i_path, "rb" );
+	if ( !file )
+	{
+		wereThereErrors = true;
+		if ( o_errorMessage )
+		{
+			std::ostringstream errorMessage;
+			errorMessage << "Failed to open the file \"" << i_path << "\" for reading: " << GetLastSystemError();
+			*o_errorMessage = errorMessage.str();
+		}
+		goto OnExit;
+	}
+	// Get the file's size
+	{
+		long fileSize;
+		if ( ( std::fseek( file, 0, SEEK_END ) != 0 ) || ( ( fileSize = std::ftell( file ) ) < 0 ) || ( std::fseek( file, 0, SEEK_SET ) != 0 ) )
+		{
+			wereThereErrors = true;
+			if ( o_errorMessage )
+			{
+				std::ostringstream errorMessage;
+				errorMessage << "Failed to get the size of the file \"" << i_path << "\": " << GetLastSystemError();
+				*o_errorMessage = errorMessage.str();
+			}
+			goto OnExit;
+		}
+		o_data.size = static_cast<size_t>( fileSize );
+	}
+	// Read the file's contents into allocated memory
+	// (at least one byte is allocated so that an empty file still has non-NULL data, like on Windows)
+	o_data.data = malloc( ( o_data.size > 0 ) ? o_data.size : 1 );
+	if ( o_data.data )
+	{
+		if ( std::fread( o_data.data, 1, o_data.size, file ) != o_data.size )
+		{
+			wereThereErrors = true;
+			if ( o_errorMessage )
+			{
+				std::ostringstream errorMessage;
+				errorMessage << "Failed to read the contents of the file \"" << i_path << "\"";
+				*o_errorMessage = errorMessage.str();
+			}
+			goto OnExit;
+		}
+	}
+	else
+	{
+		wereThereErrors = true;
+		if ( o_errorMessage )
+		{
+			std::ostringstream errorMessage;
+			errorMessage << "Failed to allocate " << o_data.size << " bytes to read in the file \"" << i_path << "\"";
+			*o_errorMessage = errorMessage.str();
+		}
+		goto OnExit;
+	}
+
+OnExit:
+
+	if ( wereThereErrors )
+	{
+		o_data.Free();
+	}
+	if ( file )
+	{
+		std::fclose( file );
+	}
+
+	return !wereThereErrors;
+}
+
+bool eae6320::Platform::WriteBinaryFile( const char* const i_path, const void* const i_data, const size_t i_size, std::string* const o_errorMessage )
+{
+	FILE* const file = std::fopen( i_path, "wb" );
+	if ( !file )
+	{
+		if ( o_errorMessage )
+		{
+			std::ostringstream errorMessage;
+			errorMessage << "Failed to open the file \"" << i_path << "\" for writing: " << GetLastSystemError();
+			*o_errorMessage = errorMessage.str();
+		}
+		return false;
+	}
+	const bool wasEverythingWritten = std::fwrite( i_data, 1, i_size, file ) == i_size;
+	const bool wasTheFileClosed = std::fclose( file ) == 0;
+	if ( !wasEverythingWritten || !wasTheFileClosed )
+	{
+		if ( o_errorMessage )
+		{
+			std::ostringstream errorMessage;
+			errorMessage << "Failed to write " << i_size << " bytes to the file \"" << i_path << "\"";
+			*o_errorMessage = errorMessage.str();
+		}
+		return false;
+	}
+	return true;
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	std::string GetLastSystemError()
+	{
+		return std::strerror( errno );
+	}
+
+	bool SetLastWriteTime( const char* const i_path, const timespec& i_time, std::string* const o_errorMessage )
+	{
+		// The first time is the last access time, which isn't changed
+		timespec times[2];
+		{
+			times[0].tv_sec = 0;
+			times[0].tv_nsec = UTIME_OMIT;
+			times[1] = i_time;
+		}
+		if ( utimensat( AT_FDCWD, i_path, times, 0 ) == 0 )
+		{
+			return true;
+		}
+		else
+		{
+			if ( o_errorMessage )
+			{
+				*o_errorMessage = GetLastSystemError();
+			}
+			return false;
+		}
+	}
+}
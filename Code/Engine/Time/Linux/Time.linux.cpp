@@ -0,0 +1,151 @@
+// Header Files
+//=============
+
+#include "../Time.h"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include "../../Asserts/Asserts.h"
+#include "../../Logging/Logging.h"
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+	bool s_isInitialized = false;
+
+	// The monotonic clock is already in nanoseconds,
+	// and so unlike on Windows there is no frequency to query
+	const double s_secondsPerTick = 1.0e-9;
+	int64_t s_totalTicksElapsed_atInitializion = 0;
+	int64_t s_totalTicksElapsed_duringRun = 0;
+	int64_t s_totalTicksElapsed_previousFrame = 0;
+
+	size_t frameCount = 0;
+	float elaspsedTime = 0.0f;
+}
+
+namespace eae6320
+{
+	namespace Time {
+		size_t FPS = 0;
+	}
+}
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	bool InitializeIfNecessary();
+	bool GetTotalTicksElapsed( int64_t& o_ticks );
+}
+
+// Interface
+//==========
+
+// Time
+//-----
+
+float eae6320::Time::GetElapsedSecondCount_total()
+{
+	InitializeIfNecessary();
+	return static_cast<float>( static_cast<double>( s_totalTicksElapsed_duringRun ) * s_secondsPerTick );
+}
+
+float eae6320::Time::GetElapsedSecondCount_duringPreviousFrame()
+{
+	InitializeIfNecessary();
+	return static_cast<float>(
+		static_cast<double>( s_totalTicksElapsed_duringRun - s_totalTicksElapsed_previousFrame )
+		* s_secondsPerTick );
+}
+
+void eae6320::Time::OnNewFrame()
+{
+	InitializeIfNecessary();
+	
+	float currentTime = GetElapsedSecondCount_total();
+	frameCount++;
+	if (currentTime - elaspsedTime > 1.0f)
+	{
+		elaspsedTime = currentTime;
+		FPS = frameCount;
+		frameCount = 0;
+	}
+	// Update the previous frame
+	{
+		s_totalTicksElapsed_previousFrame = s_totalTicksElapsed_duringRun;
+	}
+	// Update the current frame
+	{
+		int64_t totalTicksElapsed = 0;
+		const bool result = GetTotalTicksElapsed( totalTicksElapsed );
+		EAE6320_ASSERTF( result, "clock_gettime() failed" );
+		s_totalTicksElapsed_duringRun = totalTicksElapsed - s_totalTicksElapsed_atInitializion;
+	}
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+bool eae6320::Time::Initialize()
+{
+	bool wereThereErrors = false;
+
+	if ( !s_isInitialized )
+	{
+		// Store how many ticks have elapsed so far
+		if ( !GetTotalTicksElapsed( s_totalTicksElapsed_atInitializion ) )
+		{
+			wereThereErrors = true;
+			const char* const errorMessage = std::strerror( errno );
+			EAE6320_ASSERTF( false, errorMessage );
+			Logging::OutputMessage( "Failed to query the monotonic clock: %s", errorMessage );
+			goto OnExit;
+		}
+
+		Logging::OutputMessage( "Initialized time" );
+		s_isInitialized = true;
+	}
+	else
+	{
+		EAE6320_ASSERTF( false, "Time has already been initialized" );
+		goto OnExit;
+	}
+
+OnExit:
+
+	return !wereThereErrors;
+}
+
+bool eae6320::Time::CleanUp()
+{
+	return true;
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	bool InitializeIfNecessary()
+	{
+		EAE6320_ASSERTF( s_isInitialized, "Time being used but was never explicitly initialized" );
+		return s_isInitialized ? true : eae6320::Time::Initialize();
+	}
+
+	bool GetTotalTicksElapsed( int64_t& o_ticks )
+	{
+		timespec time;
+		if ( clock_gettime( CLOCK_MONOTONIC, &time ) == 0 )
+		{
+			o_ticks = ( static_cast<int64_t>( time.tv_sec ) * 1000000000 ) + static_cast<int64_t>( time.tv_nsec );
+			return true;
+		}
+		return false;
+	}
+}
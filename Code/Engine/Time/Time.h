@@ -5,6 +5,11 @@
 #ifndef EAE6320_TIME_H
 #define EAE6320_TIME_H
 
+// Header Files
+//=============
+
+#include <cstddef>
+
 // Interface
 //==========
 
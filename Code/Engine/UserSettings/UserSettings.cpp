@@ -122,7 +122,7 @@ namespace
 	bool IsNumberAnInteger( const lua_Number i_number )
 	{
 		lua_Number integralPart;
-		lua_Number fractionalPart = modf( i_number, &integralPart );
+		modf( i_number, &integralPart );
 		return integralPart == i_number;
 	}
 
@@ -29,11 +29,13 @@ extern PFNGLACTIVETEXTUREPROC glActiveTexture;
 extern PFNGLATTACHSHADERPROC glAttachShader;
 extern PFNGLBINDBUFFERPROC glBindBuffer;
 extern PFNGLBINDBUFFERBASEPROC glBindBufferBase;
+extern PFNGLBINDBUFFERRANGEPROC glBindBufferRange;
 extern PFNGLBINDSAMPLERPROC glBindSampler;
 extern PFNGLBINDVERTEXARRAYPROC glBindVertexArray;
 extern PFNGLBLENDEQUATIONPROC glBlendEquation;
 extern PFNGLBUFFERDATAPROC glBufferData;
 extern PFNGLBUFFERSUBDATAPROC glBufferSubData;
+extern PFNGLCLIENTWAITSYNCPROC glClientWaitSync;
 extern PFNGLCOMPILESHADERPROC glCompileShader;
 extern PFNGLCOMPRESSEDTEXIMAGE2DPROC glCompressedTexImage2D;
 extern PFNGLCREATEPROGRAMPROC glCreateProgram;
@@ -42,8 +44,11 @@ extern PFNGLDELETEBUFFERSPROC glDeleteBuffers;
 extern PFNGLDELETEPROGRAMPROC glDeleteProgram;
 extern PFNGLDELETESAMPLERSPROC glDeleteSamplers;
 extern PFNGLDELETESHADERPROC glDeleteShader;
+extern PFNGLDELETESYNCPROC glDeleteSync;
 extern PFNGLDELETEVERTEXARRAYSPROC glDeleteVertexArrays;
+extern PFNGLDRAWELEMENTSINSTANCEDPROC glDrawElementsInstanced;
 extern PFNGLENABLEVERTEXATTRIBARRAYARBPROC glEnableVertexAttribArray;
+extern PFNGLFENCESYNCPROC glFenceSync;
 extern PFNGLGENBUFFERSPROC glGenBuffers;
 extern PFNGLGENSAMPLERSPROC glGenSamplers;
 extern PFNGLGENVERTEXARRAYSPROC glGenVertexArrays;
@@ -54,6 +59,7 @@ extern PFNGLGETSHADERIVPROC glGetShaderiv;
 extern PFNGLGETUNIFORMLOCATIONPROC glGetUniformLocation;
 extern PFNGLINVALIDATEBUFFERDATAPROC glInvalidateBufferData;
 extern PFNGLLINKPROGRAMPROC glLinkProgram;
+extern PFNGLMAPBUFFERRANGEPROC glMapBufferRange;
 extern PFNGLSAMPLERPARAMETERIPROC glSamplerParameteri;
 extern PFNGLSHADERSOURCEPROC glShaderSource;
 extern PFNGLUNIFORM1FVPROC glUniform1fv;
@@ -63,6 +69,7 @@ extern PFNGLUNIFORM3FVPROC glUniform3fv;
 extern PFNGLUNIFORM4FVPROC glUniform4fv;
 extern PFNGLUNIFORMBLOCKBINDINGPROC glUniformBlockBinding;
 extern PFNGLUNIFORMMATRIX4FVPROC glUniformMatrix4fv;
+extern PFNGLUNMAPBUFFERPROC glUnmapBuffer;
 extern PFNGLUSEPROGRAMPROC glUseProgram;
 extern PFNGLVERTEXATTRIBPOINTERPROC glVertexAttribPointer;
 #if defined( EAE6320_PLATFORM_WINDOWS )
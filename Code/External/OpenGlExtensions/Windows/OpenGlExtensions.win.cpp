@@ -26,11 +26,13 @@ PFNGLACTIVETEXTUREPROC glActiveTexture = NULL;
 PFNGLATTACHSHADERPROC glAttachShader = NULL;
 PFNGLBINDBUFFERPROC glBindBuffer = NULL;
 PFNGLBINDBUFFERBASEPROC glBindBufferBase = NULL;
+PFNGLBINDBUFFERRANGEPROC glBindBufferRange = NULL;
 PFNGLBINDSAMPLERPROC glBindSampler = NULL;
 PFNGLBINDVERTEXARRAYPROC glBindVertexArray = NULL;
 PFNGLBLENDEQUATIONPROC glBlendEquation = NULL;
 PFNGLBUFFERDATAPROC glBufferData = NULL;
 PFNGLBUFFERSUBDATAPROC glBufferSubData = NULL;
+PFNGLCLIENTWAITSYNCPROC glClientWaitSync = NULL;
 PFNGLCOMPILESHADERPROC glCompileShader = NULL;
 PFNGLCOMPRESSEDTEXIMAGE2DPROC glCompressedTexImage2D = NULL;
 PFNGLCREATEPROGRAMPROC glCreateProgram = NULL;
@@ -39,8 +41,11 @@ PFNGLDELETEBUFFERSPROC glDeleteBuffers = NULL;
 PFNGLDELETEPROGRAMPROC glDeleteProgram = NULL;
 PFNGLDELETESAMPLERSPROC glDeleteSamplers = NULL;
 PFNGLDELETESHADERPROC glDeleteShader = NULL;
+PFNGLDELETESYNCPROC glDeleteSync = NULL;
 PFNGLDELETEVERTEXARRAYSPROC glDeleteVertexArrays = NULL;
+PFNGLDRAWELEMENTSINSTANCEDPROC glDrawElementsInstanced = NULL;
 PFNGLENABLEVERTEXATTRIBARRAYARBPROC glEnableVertexAttribArray = NULL;
+PFNGLFENCESYNCPROC glFenceSync = NULL;
 PFNGLGENBUFFERSPROC glGenBuffers = NULL;
 PFNGLGENSAMPLERSPROC glGenSamplers = NULL;
 PFNGLGENVERTEXARRAYSPROC glGenVertexArrays = NULL;
@@ -51,6 +56,7 @@ PFNGLGETSHADERIVPROC glGetShaderiv = NULL;
 PFNGLGETUNIFORMLOCATIONPROC glGetUniformLocation = NULL;
 PFNGLINVALIDATEBUFFERDATAPROC glInvalidateBufferData = NULL;
 PFNGLLINKPROGRAMPROC glLinkProgram = NULL;
+PFNGLMAPBUFFERRANGEPROC glMapBufferRange = NULL;
 PFNGLSAMPLERPARAMETERIPROC glSamplerParameteri = NULL;
 PFNGLSHADERSOURCEPROC glShaderSource = NULL;
 PFNGLUSEPROGRAMPROC glUseProgram = NULL;
@@ -61,6 +67,7 @@ PFNGLUNIFORM3FVPROC glUniform3fv = NULL;
 PFNGLUNIFORM4FVPROC glUniform4fv = NULL;
 PFNGLUNIFORMBLOCKBINDINGPROC glUniformBlockBinding = NULL;
 PFNGLUNIFORMMATRIX4FVPROC glUniformMatrix4fv = NULL;
+PFNGLUNMAPBUFFERPROC glUnmapBuffer = NULL;
 PFNGLVERTEXATTRIBPOINTERPROC glVertexAttribPointer = NULL;
 PFNWGLCHOOSEPIXELFORMATARBPROC wglChoosePixelFormatARB = NULL;
 PFNWGLCREATECONTEXTATTRIBSARBPROC wglCreateContextAttribsARB = NULL;
@@ -101,11 +108,13 @@ bool eae6320::OpenGlExtensions::Load( std::string* o_errorMessage )
 	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glAttachShader, PFNGLATTACHSHADERPROC );
 	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glBindBuffer, PFNGLBINDBUFFERPROC );
 	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glBindBufferBase, PFNGLBINDBUFFERBASEPROC );
+	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glBindBufferRange, PFNGLBINDBUFFERRANGEPROC );
 	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glBindSampler, PFNGLBINDSAMPLERPROC );
 	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glBindVertexArray, PFNGLBINDVERTEXARRAYPROC );
 	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glBlendEquation, PFNGLBLENDEQUATIONPROC );
 	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glBufferData, PFNGLBUFFERDATAPROC );
 	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glBufferSubData, PFNGLBUFFERSUBDATAPROC );
+	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glClientWaitSync, PFNGLCLIENTWAITSYNCPROC );
 	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glCompileShader, PFNGLCOMPILESHADERPROC );
 	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glCompressedTexImage2D, PFNGLCOMPRESSEDTEXIMAGE2DPROC );
 	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glCreateProgram, PFNGLCREATEPROGRAMPROC );
@@ -115,7 +124,10 @@ bool eae6320::OpenGlExtensions::Load( std::string* o_errorMessage )
 	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glDeleteVertexArrays, PFNGLDELETEVERTEXARRAYSPROC );
 	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glDeleteSamplers, PFNGLDELETESAMPLERSPROC );
 	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glDeleteShader, PFNGLDELETESHADERPROC );
+	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glDeleteSync, PFNGLDELETESYNCPROC );
+	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glDrawElementsInstanced, PFNGLDRAWELEMENTSINSTANCEDPROC );
 	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glEnableVertexAttribArray, PFNGLENABLEVERTEXATTRIBARRAYARBPROC );
+	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glFenceSync, PFNGLFENCESYNCPROC );
 	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glGenBuffers, PFNGLGENBUFFERSPROC );
 	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glGenSamplers, PFNGLGENSAMPLERSPROC );
 	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glGenVertexArrays, PFNGLGENVERTEXARRAYSPROC );
@@ -126,6 +138,7 @@ bool eae6320::OpenGlExtensions::Load( std::string* o_errorMessage )
 	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glGetUniformLocation, PFNGLGETUNIFORMLOCATIONPROC );
 	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glInvalidateBufferData, PFNGLINVALIDATEBUFFERDATAPROC );
 	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glLinkProgram, PFNGLLINKPROGRAMPROC );
+	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glMapBufferRange, PFNGLMAPBUFFERRANGEPROC );
 	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glSamplerParameteri, PFNGLSAMPLERPARAMETERIPROC );
 	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glShaderSource, PFNGLSHADERSOURCEPROC );
 	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glUniform1fv, PFNGLUNIFORM1FVPROC );
@@ -135,6 +148,7 @@ bool eae6320::OpenGlExtensions::Load( std::string* o_errorMessage )
 	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glUniform4fv, PFNGLUNIFORM4FVPROC );
 	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glUniformBlockBinding, PFNGLUNIFORMBLOCKBINDINGPROC );
 	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glUniformMatrix4fv, PFNGLUNIFORMMATRIX4FVPROC );
+	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glUnmapBuffer, PFNGLUNMAPBUFFERPROC );
 	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glUseProgram, PFNGLUSEPROGRAMPROC );
 	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( glVertexAttribPointer, PFNGLVERTEXATTRIBPOINTERPROC );
 	EAE6320_OPENGLEXTENSIONS_LOADFUNCTION( wglChoosePixelFormatARB, PFNWGLCHOOSEPIXELFORMATARBPROC );
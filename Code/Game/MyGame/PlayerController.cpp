@@ -4,13 +4,12 @@
 #include "../../Engine/Physics/Physics.h"
 
 
-void eae6320::PlayerController::UpdateCamera(Graphics::Camera &camera, Graphics::GameObject gameObject)
+void eae6320::PlayerController::UpdateCamera(Graphics::Camera &camera, const Math::cVector& i_targetPosition, const Math::cVector& i_targetRotation)
 {
-	Math::cVector target = gameObject.transform.getPosition() - (gameObject.transform.getForward() * 200) + (gameObject.transform.getUp() * 50);
 	Math::cVector current = camera.transform.getPosition();
-	Math::cVector increment = (target - current)* 0.01f;
+	Math::cVector increment = (i_targetPosition - current)* 0.01f;
 	camera.Move(current + increment);
-	Math::cVector targetRot = gameObject.transform.getRotation();
+	Math::cVector targetRot = i_targetRotation;
 	Math::cVector currentRot = camera.transform.getRotation();
 	Math::cVector incrementRot = (targetRot - currentRot) * 0.01f;
 	camera.Rotate(currentRot + incrementRot);
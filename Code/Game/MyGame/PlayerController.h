@@ -12,7 +12,7 @@ namespace eae6320
 	public:
 		float MAXSPEED;
 		void Update(Graphics::GameObject & gameObject, Graphics::Camera &camera);
-		void UpdateCamera(Graphics::Camera &camera, Graphics::GameObject gameObject);
+		void UpdateCamera(Graphics::Camera &camera, const Math::cVector& i_targetPosition, const Math::cVector& i_targetRotation);
 	private:
 		Math::cVector offset;
 		Math::cQuaternion x;
@@ -54,13 +54,13 @@ bool eae6320::cMyGame::Initialize()
 	createDebugShapes();
 
 	myScoreText.text = new Graphics::cText("My Score: ", -600, 350);
-	myScoreText.material.Load("data/materials/sprite.material");
+	myScoreText.material = Graphics::cMaterial::LoadShared("data/materials/sprite.material");
 
-	opponentScoreText.text = new Graphics::cText("Opponent Score: ", 600, 350);
-	opponentScoreText.material.Load("data/materials/sprite.material");
+	opponentScoreText.text = new Graphics::cText("Opponent Score: ", 200, 350);
+	opponentScoreText.material = Graphics::cMaterial::LoadShared("data/materials/sprite.material");
 
 	stamina.text = new Graphics::cText("Stamina: ", -600, 325);
-	stamina.material.Load("data/materials/sprite.material");
+	stamina.material = Graphics::cMaterial::LoadShared("data/materials/sprite.material");
 
 	Physics::Octree::Compute();
 
@@ -83,34 +83,33 @@ void eae6320::cMyGame::createDebugShapes() {
 	debugSphere2.initializeSphereDebugObject(Math::cVector(250.0f, -185.0f,-1200.0f), Math::cVector(), 50, 20, 20, 255, 0, 0, 1);
 
 	Graphics::cText::LoadFontData("data/fontdata.txt");
-	Graphics::cText::Initialize();
 
 	fpsText.text = new Graphics::cText("FPS", -600, 350);
-	fpsText.material.Load("data/materials/sprite.material");
+	fpsText.material = Graphics::cMaterial::LoadShared("data/materials/sprite.material");
 
 	arrowText.text = new Graphics::cText(">", -580, 300);
-	arrowText.material.Load("data/materials/sprite.material");
+	arrowText.material = Graphics::cMaterial::LoadShared("data/materials/sprite.material");
 
 	checkBox = new Graphics::Checkbox("Checkbox [*]", -550, 325);
 
 	sliderText.text = new Graphics::cText("Radius <------->", -550, 300);
-	sliderText.material.Load("data/materials/sprite.material");
+	sliderText.material = Graphics::cMaterial::LoadShared("data/materials/sprite.material");
 	
 	sliderIndexText.text = new Graphics::cText("|", -390, 300);
-	sliderIndexText.material.Load("data/materials/sprite.material");
+	sliderIndexText.material = Graphics::cMaterial::LoadShared("data/materials/sprite.material");
 	
 	resetText.text = new Graphics::cText("Reset Radius 'R'", -550, 275);
-	resetText.material.Load("data/materials/sprite.material");
+	resetText.material = Graphics::cMaterial::LoadShared("data/materials/sprite.material");
 
 	musicVolumeSliderText.text = new Graphics::cText("Music Volume <--------->", -550, 300);
-	musicVolumeSliderText.material.Load("data/materials/sprite.material");
+	musicVolumeSliderText.material = Graphics::cMaterial::LoadShared("data/materials/sprite.material");
 	musicVolumeSliderIndexText.text = new Graphics::cText("|", -230, 300);
-	musicVolumeSliderIndexText.material.Load("data/materials/sprite.material");
+	musicVolumeSliderIndexText.material = Graphics::cMaterial::LoadShared("data/materials/sprite.material");
 
 	effectVolumeSliderText.text = new Graphics::cText("Effect Volume <--------->", -550 , 275);
-	effectVolumeSliderText.material.Load("data/materials/sprite.material");
+	effectVolumeSliderText.material = Graphics::cMaterial::LoadShared("data/materials/sprite.material");
 	effectVolumeSliderIndexText.text = new Graphics::cText("|", -92, 275);
-	effectVolumeSliderIndexText.material.Load("data/materials/sprite.material");
+	effectVolumeSliderIndexText.material = Graphics::cMaterial::LoadShared("data/materials/sprite.material");
 #endif
 }
 
@@ -126,17 +125,39 @@ bool eae6320::cMyGame::CleanUp()
 	railingGameObject.cleanUp();
 	wallsGameObject.cleanUp();
 	player.CleanUp();
+	// Every text shares the same material, which is cleaned up when the last one is released
+	Graphics::cMaterial::ReleaseShared(myScoreText.material);
+	Graphics::cMaterial::ReleaseShared(opponentScoreText.material);
+	Graphics::cMaterial::ReleaseShared(stamina.material);
 #ifdef _DEBUG
-	fpsText.material.CleanUp();
-	fpsText.text->CleanUp();
-	sliderIndexText.text->CleanUp();
-	sliderText.text->CleanUp();
-	resetText.text->CleanUp();
+	Graphics::cMaterial::ReleaseShared(fpsText.material);
+	Graphics::cMaterial::ReleaseShared(arrowText.material);
+	Graphics::cMaterial::ReleaseShared(sliderText.material);
+	Graphics::cMaterial::ReleaseShared(sliderIndexText.material);
+	Graphics::cMaterial::ReleaseShared(resetText.material);
+	Graphics::cMaterial::ReleaseShared(musicVolumeSliderText.material);
+	Graphics::cMaterial::ReleaseShared(musicVolumeSliderIndexText.material);
+	Graphics::cMaterial::ReleaseShared(effectVolumeSliderText.material);
+	Graphics::cMaterial::ReleaseShared(effectVolumeSliderIndexText.material);
+	delete checkBox;
+	delete fpsText.text;
+	delete sliderIndexText.text;
+	delete sliderText.text;
+	delete resetText.text;
 	cleanUpDebugShapes();
 #endif
 	return true;
 }
 
+void eae6320::cMyGame::updateSliderSphere()
+{
+#ifdef _DEBUG
+	// The sphere keeps its mesh and material and only the mesh is rebuilt with the new radius
+	debugSphere2.Move(Math::cVector(-100.0f, -150.0f, -300.0f));
+	debugSphere2.updateSphere(sphereRadius * ((sliderIndex + 1) / (float)sliderMax), 20, 20, 0, 0, 255, 1);
+#endif
+}
+
 void eae6320::cMyGame::cleanUpDebugShapes()
 {
 		debugSphere.cleanUp();
@@ -159,9 +180,9 @@ void eae6320::cMyGame::SetUpFrame() {
 		}
 		for (auto player : s_players)
 		{
-			//	Graphics::SetMesh(player->debugCylinder.meshObject);
-			Graphics::SetMesh(player->gameObject.meshObject);
-			Graphics::SetMesh(player->opponentFlag->meshObject);
+			//	Graphics::SetMesh(player->debugCylinder.GetMeshObject());
+			Graphics::SetMesh(player->gameObject.GetMeshObject());
+			Graphics::SetMesh(player->opponentFlag->GetMeshObject());
 			if (enableFlyCam)
 			{
 				flyCam.Update(flyCamera);
@@ -172,21 +193,12 @@ void eae6320::cMyGame::SetUpFrame() {
 			}
 			if (player->m_myPlayer) {
 
-				std::string myScore = "My Score: " + std::to_string(player->m_score);
-				char * msStr = new char[myScore.length() + 1];
-				std::strcpy(msStr, myScore.c_str());
-				myScoreText.text = new Graphics::cText(msStr, -600, 350);
-
-				std::string myStamina = "Stamina: " + std::to_string((int)(player->m_stamina));
-				char * sStr = new char[myStamina.length() + 1];
-				std::strcpy(sStr, myStamina.c_str());
-				stamina.text = new Graphics::cText(sStr, -600, 325);
+				// The texts are only laid out again when the numbers change
+				myScoreText.text->SetNumber(player->m_score, "My Score: ");
+				stamina.text->SetNumber(static_cast<int>(player->m_stamina), "Stamina: ");
 			}
 			else {
-				std::string opponentScore = "Opponent Score: " + std::to_string(player->m_score);
-				char * osStr = new char[opponentScore.length() + 1];
-				std::strcpy(osStr, opponentScore.c_str());
-				opponentScoreText.text = new Graphics::cText(osStr, 200, 350);
+				opponentScoreText.text->SetNumber(player->m_score, "Opponent Score: ");
 			}
 			for (auto other_player : s_players) {
 				if (player == other_player)
@@ -196,29 +208,25 @@ void eae6320::cMyGame::SetUpFrame() {
 			}
 		}
 	}
-	Graphics::SetMesh(floorGameObject.meshObject);
-	Graphics::SetMesh(ceilingGameObject.meshObject);
-	Graphics::SetMesh(metalGameObject.meshObject);
-	Graphics::SetMesh(railingGameObject.meshObject);
-	Graphics::SetMesh(wallsGameObject.meshObject);
-	Graphics::SetMesh(propsGameObject.meshObject);
+	Graphics::SetMesh(floorGameObject.GetMeshObject());
+	Graphics::SetMesh(ceilingGameObject.GetMeshObject());
+	Graphics::SetMesh(metalGameObject.GetMeshObject());
+	Graphics::SetMesh(railingGameObject.GetMeshObject());
+	Graphics::SetMesh(wallsGameObject.GetMeshObject());
+	Graphics::SetMesh(propsGameObject.GetMeshObject());
 #ifdef _DEBUG
 	if (isDebug) {
-		std::string str;
-		str = "FPS: " + std::to_string(Time::FPS);
-		char * cstr = new char[str.length() + 1];
-		std::strcpy(cstr, str.c_str());
-		fpsText.text = new Graphics::cText(cstr, -600, 350);
+		fpsText.text->SetNumber(static_cast<int>(Time::FPS), "FPS: ");
 
 		if (UserInput::IsKeyPressedOnce(VK_DOWN))
 		{
 			optionsIndex = static_cast<DebugOptions>((optionsIndex + 1) % 3);
-			arrowText.text = new Graphics::cText(">", -580, 325 - (optionsIndex * 25));
+			arrowText.text->SetPosition(-580, 325 - (optionsIndex * 25));
 		}
 		else if (UserInput::IsKeyPressedOnce(VK_UP))
 		{
 			optionsIndex = static_cast<DebugOptions>((optionsIndex + 3) % 3);
-			arrowText.text = new Graphics::cText(">", -580, 325 - (optionsIndex * 25));
+			arrowText.text->SetPosition(-580, 325 - (optionsIndex * 25));
 		}
 
 		switch (optionsIndex)
@@ -226,12 +234,12 @@ void eae6320::cMyGame::SetUpFrame() {
 		case eae6320::cMyGame::CHECKBOX:
 			if (UserInput::IsKeyPressedOnce(VK_RIGHT))
 			{
-				checkBox = new Graphics::Checkbox("Checkbox [*]", -550, 325);
+				checkBox->Text.text->SetText("Checkbox [*]");
 				checkBox->checked = true;
 			}
 			else if (UserInput::IsKeyPressedOnce(VK_LEFT))
 			{
-				checkBox = new Graphics::Checkbox("Checkbox [ ]", -550, 325);
+				checkBox->Text.text->SetText("Checkbox [ ]");
 				checkBox->checked = false;
 			}
 			break;
@@ -240,25 +248,23 @@ void eae6320::cMyGame::SetUpFrame() {
 			{
 				sliderIndex++;
 				sliderIndex %= sliderMax;
-				sliderIndexText.text = new Graphics::cText("|", -390 + (sliderIndex * 30), 300);
-				debugSphere2.initializeSphereDebugObject(Math::cVector(-100.0f, -150.0f, -300.0f), Math::cVector(), sphereRadius * ((sliderIndex + 1) / (float)sliderMax), 20, 20, 0, 0, 255, 1);
+				sliderIndexText.text->SetPosition(-390 + (sliderIndex * 30), 300);
+				updateSliderSphere();
 			}
 			else if (UserInput::IsKeyPressedOnce(VK_LEFT))
 			{
 				sliderIndex += sliderMax - 1;
 				sliderIndex %= sliderMax;
-				sliderIndexText.text = new Graphics::cText("|", -390 + (sliderIndex * 30), 300);
-				Graphics::Mesh* debugSphere2Mesh = new Graphics::Mesh();
-				debugSphere2.initializeSphereDebugObject(Math::cVector(-100.0f, -150.0f, -300.0f), Math::cVector(), sphereRadius * ((sliderIndex + 1) / (float)sliderMax), 20, 20, 0, 0, 255, 1);
+				sliderIndexText.text->SetPosition(-390 + (sliderIndex * 30), 300);
+				updateSliderSphere();
 			}
 			break;
 		case eae6320::cMyGame::RESET:
 			if (UserInput::IsKeyPressedOnce(82))
 			{
 				sliderIndex = 0;
-				sliderIndexText.text = new Graphics::cText("|", -390 + (sliderIndex * 30), 300);
-				Graphics::Mesh* debugSphere2Mesh = new Graphics::Mesh();
-				debugSphere2.initializeSphereDebugObject(Math::cVector(-100.0f, -150.0f, -300.0f), Math::cVector(), sphereRadius * ((sliderIndex + 1) / (float)sliderMax), 20, 20, 0, 0, 255, 1);
+				sliderIndexText.text->SetPosition(-390 + (sliderIndex * 30), 300);
+				updateSliderSphere();
 			}
 			break;
 		default:
@@ -280,12 +286,12 @@ void eae6320::cMyGame::SetUpFrame() {
 		if (UserInput::IsKeyPressedOnce(VK_DOWN))
 		{
 			vOpsIndex = static_cast<VolumeOptions>((vOpsIndex + 1) % 2);
-			arrowText.text = new Graphics::cText(">", -580, 300 - (vOpsIndex * 25));
+			arrowText.text->SetPosition(-580, 300 - (vOpsIndex * 25));
 		}
 		else if (UserInput::IsKeyPressedOnce(VK_UP))
 		{
 			vOpsIndex = static_cast<VolumeOptions>((vOpsIndex + 1) % 2);
-			arrowText.text = new Graphics::cText(">", -580, 300 - (vOpsIndex * 25));
+			arrowText.text->SetPosition(-580, 300 - (vOpsIndex * 25));
 		}
 		switch (vOpsIndex)
 		{
@@ -294,7 +300,7 @@ void eae6320::cMyGame::SetUpFrame() {
 			{
 				if (musicSliderIndex < sliderMax) {
 					musicSliderIndex++;
-					musicVolumeSliderIndexText.text = new Graphics::cText("|", -260 + (musicSliderIndex * 30), 300);
+					musicVolumeSliderIndexText.text->SetPosition(-260 + (musicSliderIndex * 30), 300);
 					Audio::ModifyMusicVolume(0.2f);
 				}
 			}
@@ -303,7 +309,7 @@ void eae6320::cMyGame::SetUpFrame() {
 				if (musicSliderIndex > 0) 
 				{
 					musicSliderIndex--;
-					musicVolumeSliderIndexText.text = new Graphics::cText("|", -260 + (musicSliderIndex * 30), 300);
+					musicVolumeSliderIndexText.text->SetPosition(-260 + (musicSliderIndex * 30), 300);
 					Audio::ModifyMusicVolume(-0.2f);
 				}
 			}
@@ -313,7 +319,7 @@ void eae6320::cMyGame::SetUpFrame() {
 			{
 				if (effectSliderIndex < sliderMax) {
 					effectSliderIndex++;
-					effectVolumeSliderIndexText.text = new Graphics::cText("|", -242 + (effectSliderIndex * 30), 275);
+					effectVolumeSliderIndexText.text->SetPosition(-242 + (effectSliderIndex * 30), 275);
 					Audio::ModifyEffectVolume(0.2f);
 				}
 			}
@@ -321,7 +327,7 @@ void eae6320::cMyGame::SetUpFrame() {
 			{
 				if (effectSliderIndex > 0) {
 					effectSliderIndex--;
-					effectVolumeSliderIndexText.text = new Graphics::cText("|", -242 + (effectSliderIndex * 30), 275);
+					effectVolumeSliderIndexText.text->SetPosition(-242 + (effectSliderIndex * 30), 275);
 					Audio::ModifyEffectVolume(-0.2f);
 				}
 			}
@@ -339,9 +345,9 @@ void eae6320::cMyGame::SetUpFrame() {
 
 void eae6320::cMyGame::setDebugShapes() {
 	if (checkBox->checked)
-		Graphics::SetMesh(debugSphere.meshObject);
-	Graphics::SetMesh(debugSphere2.meshObject);
-//	Graphics::SetMesh(debugLine2.meshObject);
+		Graphics::SetMesh(debugSphere.GetMeshObject());
+	Graphics::SetMesh(debugSphere2.GetMeshObject());
+//	Graphics::SetMesh(debugLine2.GetMeshObject());
 	Physics::Octree::displayOctree();
 }
 
@@ -150,6 +150,7 @@ namespace eae6320
 
 		void  createDebugShapes();
 		void setDebugShapes();
+		void updateSliderSphere();
 		void cleanUpDebugShapes();
 	};
 }
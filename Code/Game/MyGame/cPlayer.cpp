@@ -8,13 +8,19 @@ namespace {
 	void RemotePlayerUpdate(eae6320::Networking::sPlayerData* i_remoteplayer);
 	eae6320::Networking::sPlayerData* main_player;
 	eae6320::Networking::sPlayerData* remote_player;
-	const float MAX_STAMINA = 100;
-	const eae6320::Math::cVector redFlagDefaultPos = eae6320::Math::cVector(250.0f, -185.0f, -1200.0f);
-	const eae6320::Math::cVector redFlagWorldPos = eae6320::Math::cVector(250.0f, -185.0f, 1200.0f);
-	 eae6320::Math::cVector blueflagDefaultPos = eae6320::Math::cVector(250.0f, -185.0f, 1200.0f);
-	const eae6320::Math::cVector blueflagWorldPos = eae6320::Math::cVector(250.0f, -185.0f,-1200.0f);
+	constexpr float MAX_STAMINA = 100;
+	constexpr eae6320::Math::cVector redFlagDefaultPos = eae6320::Math::cVector(250.0f, -185.0f, -1200.0f);
+	constexpr eae6320::Math::cVector redFlagWorldPos = eae6320::Math::cVector(250.0f, -185.0f, 1200.0f);
+	constexpr eae6320::Math::cVector blueflagDefaultPos = eae6320::Math::cVector(250.0f, -185.0f, 1200.0f);
+	constexpr eae6320::Math::cVector blueflagWorldPos = eae6320::Math::cVector(250.0f, -185.0f,-1200.0f);
 	void UpdateOpponentFlagPosition(eae6320::Game::cPlayer* player);
 	bool isSoundPlaying = false;
+	// Every player's attachments are stored in a single hierarchy
+	eae6320::Graphics::cTransformHierarchy s_attachments;
+	// These are relative to the player
+	// (forward is -z, and so the camera sits behind and above)
+	constexpr eae6320::Math::cVector s_carriedFlagOffset(0.0f, 0.0f, 0.0f);
+	constexpr eae6320::Math::cVector s_cameraTargetOffset(0.0f, 50.0f, 200.0f);
 }
 
 bool eae6320::Game::cPlayer::Initialize(eae6320::Networking::eSession i_sessionType, bool i_myPlayer)
@@ -35,6 +41,9 @@ bool eae6320::Game::cPlayer::Initialize(eae6320::Networking::eSession i_sessionT
 		gameObject.Initialize(Math::cVector(250.0f, -185.0f, -1200.0f), Math::cVector(0, 180, 0), "data/meshes/player.mesh", "data/materials/red.material");
 		opponentFlag->Initialize(blueflagDefaultPos, Math::cVector(), "data/meshes/flag.mesh", "data/materials/blue.material");
 	}
+	m_playerNode = s_attachments.AddNode(Graphics::cTransformHierarchy::InvalidNodeId, gameObject.transform.getPosition(), gameObject.transform.getOrientation());
+	m_carriedFlagNode = s_attachments.AddNode(m_playerNode, s_carriedFlagOffset);
+	m_cameraTargetNode = s_attachments.AddNode(m_playerNode, s_cameraTargetOffset);
 	if (!m_myPlayer)
 	{
 		std::function<void(eae6320::Networking::sPlayerData*)> callback = RemotePlayerUpdate;
@@ -73,8 +82,6 @@ void eae6320::Game::cPlayer::Update()
 			}
 		}
 		gameObject.transform.Rotate(remote_player->m_rotation);
-		gameObject.meshObject.position = gameObject.transform.getPosition();
-		gameObject.meshObject.rotation = gameObject.transform.getOrientation();
 
 		if (remote_player->m_hasFalg&&!m_hasFlag)
 			Audio::PlayEffect("data/sounds/theenemyhastakenyourflag.wav");
@@ -82,7 +89,8 @@ void eae6320::Game::cPlayer::Update()
 		m_hasFlag = remote_player->m_hasFalg;
 		if (m_hasFlag)
 		{
-			opponentFlag->meshObject.position = gameObject.transform.getPosition();
+			UpdateAttachments();
+			opponentFlag->transform.Move(s_attachments.GetWorldPosition(m_carriedFlagNode));
 		}
 		else
 		{
@@ -99,12 +107,16 @@ void eae6320::Game::cPlayer::Update()
 	UpdateOpponentFlagPosition(this);
 	if (m_hasFlag)
 	{
-		opponentFlag->meshObject.position = gameObject.transform.getPosition();
 		UpdateScore();
 	}
 	UpdateStamina();
 	controller.Update(gameObject, camera);
-	controller.UpdateCamera(camera, gameObject);
+	UpdateAttachments();
+	if (m_hasFlag)
+	{
+		opponentFlag->transform.Move(s_attachments.GetWorldPosition(m_carriedFlagNode));
+	}
+	controller.UpdateCamera(camera, s_attachments.GetWorldPosition(m_cameraTargetNode), gameObject.transform.getRotation());
 	Audio::UpdateListener(camera.transform);
 
 	if (gameObject.rigidBody.velocity.GetLength() > 100)
@@ -127,7 +139,7 @@ void eae6320::Game::cPlayer::Update()
 	if (eae6320::Math::cVector(gameObject.rigidBody.velocity.x, 0, gameObject.rigidBody.velocity.z).GetLength() > 1)
 	{
 		debugLine.updateLine(gameObject.transform.getPosition(), gameObject.rigidBody.toVelocityPoint, 255, 255, 255, 1);
-		Graphics::SetMesh(debugLine.meshObject);
+		Graphics::SetMesh(debugLine.GetMeshObject());
 	}
 	//debugLine2.updateLine(player.transform.getPosition(), player.rigidBody.toFloorPoint, 255, 255, 255, 1);
 }
@@ -183,16 +195,22 @@ void eae6320::Game::cPlayer::UpdateScore()
 	}
 }
 
+void eae6320::Game::cPlayer::UpdateAttachments()
+{
+	s_attachments.SetLocalTransform(m_playerNode, gameObject.transform.getPosition(), gameObject.transform.getOrientation());
+	s_attachments.UpdateWorldTransforms();
+}
+
 void eae6320::Game::cPlayer::ResetOpponentFlag()
 {
 	m_hasFlag = false;
 	if (m_session == eae6320::Networking::eSession::CLIENT) 
 	{
-		opponentFlag->meshObject.position = blueflagDefaultPos;
+		opponentFlag->transform.Move(blueflagDefaultPos);
 	} 
 	else
 	{
-		opponentFlag->meshObject.position = redFlagDefaultPos;
+		opponentFlag->transform.Move(redFlagDefaultPos);
 	}
 }
 
@@ -5,6 +5,7 @@
 #include "../../Engine/Graphics/GameObject.h"
 #include "../../Engine/Graphics/Camera.h"
 #include "../../Engine/Graphics/DebugObject.h"
+#include "../../Engine/Graphics/cTransformHierarchy.h"
 
 namespace eae6320
 {
@@ -36,7 +37,12 @@ namespace eae6320
 		private:
 			Graphics::DebugObject debugLine;
 			//Graphics::DebugObject debugLine2;
+			// The carried flag and the camera's target are attached to the player
+			Graphics::cTransformHierarchy::tNodeId m_playerNode;
+			Graphics::cTransformHierarchy::tNodeId m_carriedFlagNode;
+			Graphics::cTransformHierarchy::tNodeId m_cameraTargetNode;
 			void UpdateStamina();
+			void UpdateAttachments();
 		};
 	}
 }
@@ -0,0 +1,132 @@
+/*
+	The main() function is where the program starts execution
+
+	The render replay submits the same scene for a fixed number of frames
+	using the null graphics platform,
+	which records every frame's commands to a file instead of drawing them.
+	This makes it possible to see how changes to submission, sorting, and batching
+	affect what would be sent to the GPU (and how long it takes)
+	without a window or a GPU.
+
+	Usage:
+		RenderReplay commandListPath [frameCount] [assetDirectory]
+*/
+
+// Header Files
+//=============
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include "cReplayScene.h"
+#include "../../Engine/Graphics/Graphics.h"
+#include "../../Engine/Logging/Logging.h"
+#include "../../Engine/Time/Time.h"
+
+// Entry Point
+//============
+
+int main( int i_argumentCount, char** i_arguments )
+{
+	if ( ( i_argumentCount < 2 ) || ( i_argumentCount > 4 ) )
+	{
+		std::fprintf( stderr, "Usage: %s commandListPath [frameCount] [assetDirectory]\n", i_arguments[0] );
+		return EXIT_FAILURE;
+	}
+	const char* const commandListPath = i_arguments[1];
+	const int frameCount = ( i_argumentCount > 2 ) ? std::atoi( i_arguments[2] ) : 60;
+	const char* const assetDirectory = ( i_argumentCount > 3 ) ? i_arguments[3] : "replay_data";
+	if ( frameCount <= 0 )
+	{
+		std::fprintf( stderr, "The frame count must be positive\n" );
+		return EXIT_FAILURE;
+	}
+
+	bool wereThereErrors = false;
+	eae6320::cReplayScene scene;
+	bool wasGraphicsInitialized = false;
+	bool wasRenderThreadStarted = false;
+	double submissionSecondCount = 0.0;
+
+	if ( !eae6320::Logging::Initialize() || !eae6320::Time::Initialize() )
+	{
+		std::fprintf( stderr, "Failed to initialize logging and time\n" );
+		return EXIT_FAILURE;
+	}
+	{
+		eae6320::Graphics::sInitializationParameters initializationParameters;
+		initializationParameters.commandListPath = commandListPath;
+		if ( !eae6320::Graphics::Initialize( initializationParameters ) )
+		{
+			wereThereErrors = true;
+			std::fprintf( stderr, "Failed to initialize graphics (see the log for details)\n" );
+			goto OnExit;
+		}
+		wasGraphicsInitialized = true;
+	}
+	if ( !scene.Initialize( assetDirectory ) )
+	{
+		wereThereErrors = true;
+		std::fprintf( stderr, "Failed to initialize the replay scene (see the log for details)\n" );
+		goto OnExit;
+	}
+	// Frames are drawn on a separate render thread the same way as in the game
+	if ( !eae6320::Graphics::StartRenderThread() )
+	{
+		wereThereErrors = true;
+		std::fprintf( stderr, "Failed to start the render thread\n" );
+		goto OnExit;
+	}
+	wasRenderThreadStarted = true;
+
+	// Replay the frames
+	{
+		const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+		for ( int i = 0; i < frameCount; ++i )
+		{
+			eae6320::Time::OnNewFrame();
+			// The scene is animated with a fixed time step so that every replay submits the same frames
+			scene.SubmitFrame( static_cast<uint32_t>( i ), static_cast<float>( i ) / 60.0f );
+			eae6320::Graphics::RenderFrame();
+		}
+		// The last frame is only known to be drawn once the render thread has stopped
+		wasRenderThreadStarted = false;
+		if ( !eae6320::Graphics::StopRenderThread() )
+		{
+			wereThereErrors = true;
+			goto OnExit;
+		}
+		submissionSecondCount = std::chrono::duration<double>( std::chrono::steady_clock::now() - startTime ).count();
+	}
+
+	// Report the results
+	{
+		const eae6320::Graphics::sRenderStatistics& statistics = eae6320::Graphics::GetRenderStatistics();
+		std::printf( "Replayed %d frames in %.3f ms (%.3f ms per frame)\n",
+			frameCount, submissionSecondCount * 1000.0, ( submissionSecondCount * 1000.0 ) / frameCount );
+		std::printf( "Statistics of the last frame that finished before the render thread stopped:\n"
+			"\tdraws: %u\n\tinstances: %u\n\tstate changes: %u (%u unsorted)\n\tculled: %u\n\ttriangles: %u\n\tUI draws: %u\n",
+			statistics.drawCount, statistics.instanceCount, statistics.stateChangeCount, statistics.stateChangeCount_unsorted,
+			statistics.culledCount, statistics.triangleCount, statistics.uiDrawCount );
+		std::printf( "The command list was written to %s\n", commandListPath );
+	}
+
+OnExit:
+
+	if ( wasRenderThreadStarted )
+	{
+		eae6320::Graphics::StopRenderThread();
+	}
+	if ( !scene.CleanUp() )
+	{
+		wereThereErrors = true;
+	}
+	if ( wasGraphicsInitialized && !eae6320::Graphics::CleanUp() )
+	{
+		wereThereErrors = true;
+	}
+	eae6320::Time::CleanUp();
+	eae6320::Logging::CleanUp();
+
+	return wereThereErrors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
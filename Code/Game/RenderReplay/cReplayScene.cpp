@@ -0,0 +1,385 @@
+// Header Files
+//=============
+
+#include "cReplayScene.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include "../../Engine/Asserts/Asserts.h"
+#include "../../Engine/Graphics/cRenderState.h"
+#include "../../Engine/Graphics/cTexture/DdsFormat.h"
+#include "../../Engine/Logging/Logging.h"
+#include "../../Engine/Math/BoundingVolumes.h"
+#include "../../Engine/Math/Functions.h"
+#include "../../Engine/Platform/Platform.h"
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	// Each of these writes a file in the same format as the matching asset builder
+	bool WriteEffect( const std::string& i_path, const uint8_t i_renderStateBits );
+	bool WriteFont( const std::string& i_path );
+	bool WriteMaterial( const std::string& i_path, const float i_r, const float i_g, const float i_b, const float i_a,
+		const std::string& i_effectPath, const std::string& i_texturePath );
+	bool WriteMesh( const std::string& i_path );
+	bool WriteTexture( const std::string& i_path );
+
+	bool WriteFile( const std::string& i_path, const std::vector<uint8_t>& i_data );
+	void AppendString( const std::string& i_string, std::vector<uint8_t>& io_data );
+	template<typename tData> void AppendData( const tData& i_data, std::vector<uint8_t>& io_data );
+}
+
+// Interface
+//==========
+
+// Initialization / Clean Up
+//--------------------------
+
+bool eae6320::cReplayScene::Initialize( const std::string& i_assetDirectory )
+{
+	const std::string directory = i_assetDirectory + "/";
+	{
+		std::string errorMessage;
+		if ( !Platform::CreateDirectoryIfNecessary( directory, &errorMessage ) )
+		{
+			Logging::OutputError( "Failed to create the asset directory \"%s\": %s", directory.c_str(), errorMessage.c_str() );
+			return false;
+		}
+	}
+
+	// Write the assets
+	const std::string path_meshEffect = directory + "mesh.effect";
+	const std::string path_spriteEffect = directory + "sprite.effect";
+	const std::string path_texture = directory + "white.dds";
+	const std::string path_spriteMaterial = directory + "sprite.material";
+	const std::string path_mesh = directory + "cube.mesh";
+	const std::string path_font = directory + "fontdata.txt";
+	std::string path_materials[s_materialCount];
+	{
+		if ( !WriteEffect( path_meshEffect, Graphics::RenderStates::DepthBuffering )
+			|| !WriteEffect( path_spriteEffect, Graphics::RenderStates::AlphaTransparency | Graphics::RenderStates::DrawBothTriangleSides )
+			|| !WriteTexture( path_texture )
+			|| !WriteMaterial( path_spriteMaterial, 1.0f, 1.0f, 1.0f, 1.0f, path_spriteEffect, path_texture )
+			|| !WriteMesh( path_mesh )
+			|| !WriteFont( path_font ) )
+		{
+			return false;
+		}
+		for ( uint32_t i = 0; i < s_materialCount; ++i )
+		{
+			char name[32];
+			std::snprintf( name, sizeof( name ), "color%u.material", i );
+			path_materials[i] = directory + name;
+			const float shade = static_cast<float>( i + 1 ) / s_materialCount;
+			if ( !WriteMaterial( path_materials[i], shade, 1.0f - shade, 0.5f, 1.0f, path_meshEffect, path_texture ) )
+			{
+				return false;
+			}
+		}
+	}
+
+	// Load the assets
+	{
+		if ( !m_mesh.LoadBinaryFile( path_mesh.c_str() ) )
+		{
+			return false;
+		}
+		for ( uint32_t i = 0; i < s_materialCount; ++i )
+		{
+			if ( !m_materials[i].Load( path_materials[i].c_str() ) )
+			{
+				return false;
+			}
+		}
+		char fontPath[256];
+		std::snprintf( fontPath, sizeof( fontPath ), "%s", path_font.c_str() );
+		if ( !Graphics::cText::LoadFontData( fontPath ) )
+		{
+			Logging::OutputError( "Failed to load the font data \"%s\"", path_font.c_str() );
+			return false;
+		}
+	}
+
+	// Create the objects
+	{
+		// The cubes are a grid on the XZ plane,
+		// and neighbours use different materials so that sorting matters
+		const size_t objectCount = s_gridWidth * s_gridWidth;
+		m_meshObjects.resize( objectCount );
+		m_positions.resize( objectCount );
+		m_eulerAngles.resize( objectCount );
+		m_orientations.resize( objectCount );
+		m_transforms.resize( objectCount );
+		for ( uint32_t z = 0; z < s_gridWidth; ++z )
+		{
+			for ( uint32_t x = 0; x < s_gridWidth; ++x )
+			{
+				Graphics::MeshObject& meshObject = m_meshObjects[( z * s_gridWidth ) + x];
+				meshObject.mesh = &m_mesh;
+				meshObject.material = &m_materials[( x + ( z * 3 ) ) % s_materialCount];
+				const float halfWidth = 0.5f * static_cast<float>( s_gridWidth - 1 );
+				m_positions[( z * s_gridWidth ) + x] =
+					Math::cVector( ( static_cast<float>( x ) - halfWidth ) * 2.0f, 0.0f, ( static_cast<float>( z ) - halfWidth ) * 2.0f );
+				meshObject.transform_localToWorld = Math::cMatrix_transformation( Math::cQuaternion(), m_positions[( z * s_gridWidth ) + x] );
+			}
+		}
+		// Every sprite and text shares one material (the way that the game's HUD does),
+		// and so they are all drawn with a single draw call
+		for ( uint32_t i = 0; i < s_spriteCount; ++i )
+		{
+			const float left = -0.95f + ( 0.2f * i );
+			m_sprites[i] = new Graphics::cSprite( left, left + 0.15f, -0.8f, -0.95f, 0.0f, 1.0f, 1.0f, 0.0f );
+			m_uiObjects[i].material = Graphics::cMaterial::LoadShared( path_spriteMaterial.c_str() );
+			m_uiObjects[i].sprite = m_sprites[i];
+		}
+		for ( uint32_t i = 0; i < s_textCount; ++i )
+		{
+			m_texts[i] = new Graphics::cText( "", -600, 350 - ( 40 * static_cast<int>( i ) ) );
+			m_uiTexts[i].material = Graphics::cMaterial::LoadShared( path_spriteMaterial.c_str() );
+			m_uiTexts[i].text = m_texts[i];
+		}
+	}
+
+	m_camera = Graphics::Camera( Math::cVector( 0.0f, 10.0f, 40.0f ), Math::cVector(),
+		Math::ConvertDegreesToRadians( 60.0f ), 0.1f, 200.0f, 16.0f / 9.0f );
+
+	return true;
+}
+
+bool eae6320::cReplayScene::CleanUp()
+{
+	bool wereThereErrors = false;
+
+	if ( !m_mesh.CleanUp() )
+	{
+		wereThereErrors = true;
+	}
+	for ( uint32_t i = 0; i < s_materialCount; ++i )
+	{
+		if ( !m_materials[i].CleanUp() )
+		{
+			wereThereErrors = true;
+		}
+	}
+	for ( uint32_t i = 0; i < s_spriteCount; ++i )
+	{
+		Graphics::cMaterial::ReleaseShared( m_uiObjects[i].material );
+		delete m_sprites[i];
+		m_sprites[i] = NULL;
+	}
+	for ( uint32_t i = 0; i < s_textCount; ++i )
+	{
+		Graphics::cMaterial::ReleaseShared( m_uiTexts[i].material );
+		delete m_texts[i];
+		m_texts[i] = NULL;
+	}
+
+	return !wereThereErrors;
+}
+
+// Render
+//-------
+
+void eae6320::cReplayScene::SubmitFrame( const uint32_t i_frameIndex, const float i_elapsedSecondCount )
+{
+	// The camera turns a full circle every 360 frames
+	{
+		const float angle = static_cast<float>( i_frameIndex % 360 );
+		const float angle_radians = Math::ConvertDegreesToRadians( angle );
+		m_camera.Set( Math::cVector( 40.0f * std::sin( angle_radians ), 10.0f, 40.0f * std::cos( angle_radians ) ),
+			Math::cVector( 15.0f, -angle, 0.0f ) );
+		Graphics::SetCamera( m_camera );
+	}
+	// The cubes spin at different rates around x and y,
+	// and all of their orientations and transforms are created at once
+	{
+		const size_t objectCount = m_meshObjects.size();
+		for ( size_t i = 0; i < objectCount; ++i )
+		{
+			const float rate = 0.5f + ( 0.01f * static_cast<float>( i ) );
+			m_eulerAngles[i] = Math::cVector( i_elapsedSecondCount * rate, i_elapsedSecondCount * rate * 2.0f, 0.0f );
+		}
+		Math::CreateOrientations( m_eulerAngles.data(), m_orientations.data(), objectCount );
+		Math::CreateTransforms( m_orientations.data(), m_positions.data(), m_transforms.data(), objectCount );
+		for ( size_t i = 0; i < objectCount; ++i )
+		{
+			m_meshObjects[i].transform_localToWorld = m_transforms[i];
+			Graphics::SetMesh( m_meshObjects[i] );
+		}
+	}
+	for ( uint32_t i = 0; i < s_spriteCount; ++i )
+	{
+		Graphics::SetSprite( m_uiObjects[i] );
+	}
+	// Only some of the text changes every frame,
+	// which is how a HUD usually behaves
+	m_texts[0]->SetNumber( static_cast<int>( i_frameIndex ), "Frame: " );
+	m_texts[1]->SetNumber( i_elapsedSecondCount, 2, "Time: " );
+	m_texts[2]->SetText( "Render Replay" );
+	m_texts[3]->SetNumber( static_cast<int>( m_meshObjects.size() ), "Objects: " );
+	for ( uint32_t i = 0; i < s_textCount; ++i )
+	{
+		Graphics::AddUIText( m_uiTexts[i] );
+	}
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	bool WriteEffect( const std::string& i_path, const uint8_t i_renderStateBits )
+	{
+		// The null platform only records the shader paths,
+		// and so they don't need to exist
+		std::vector<uint8_t> data;
+		AppendData( i_renderStateBits, data );
+		AppendString( "data/shaders/replay.shader.vertex", data );
+		AppendString( "data/shaders/replay.shader.fragment", data );
+		return WriteFile( i_path, data );
+	}
+
+	bool WriteFont( const std::string& i_path )
+	{
+		// Every printable ASCII character is the same width
+		std::vector<uint8_t> data;
+		const int characterCount = 95;
+		for ( int i = 0; i < characterCount; ++i )
+		{
+			char line[64];
+			const int length = std::snprintf( line, sizeof( line ), "%d %c %f %f 8\n",
+				32 + i, static_cast<char>( 32 + i ),
+				static_cast<float>( i ) / characterCount, static_cast<float>( i + 1 ) / characterCount );
+			data.insert( data.end(), line, line + length );
+		}
+		return WriteFile( i_path, data );
+	}
+
+	bool WriteMaterial( const std::string& i_path, const float i_r, const float i_g, const float i_b, const float i_a,
+		const std::string& i_effectPath, const std::string& i_texturePath )
+	{
+		eae6320::Graphics::sMaterial material;
+		{
+			material.g_color.r = i_r;
+			material.g_color.g = i_g;
+			material.g_color.b = i_b;
+			material.g_color.a = i_a;
+		}
+		std::vector<uint8_t> data;
+		AppendData( material, data );
+		AppendString( i_effectPath, data );
+		AppendString( i_texturePath, data );
+		return WriteFile( i_path, data );
+	}
+
+	bool WriteMesh( const std::string& i_path )
+	{
+		// A unit cube with four vertices on each face
+		// (so that each face has its own texture coordinates)
+		const uint32_t vertexCount = 24;
+		const uint32_t indexCount = 36;
+		eae6320::Graphics::sVertex vertices[vertexCount];
+		uint16_t indices[indexCount];
+		{
+			// Each face is given by its normal axis and direction
+			for ( uint32_t face = 0; face < 6; ++face )
+			{
+				const int axis = face / 2;
+				const float side = ( face % 2 ) ? 0.5f : -0.5f;
+				for ( uint32_t corner = 0; corner < 4; ++corner )
+				{
+					const float a = ( corner & 1 ) ? 0.5f : -0.5f;
+					const float b = ( corner & 2 ) ? 0.5f : -0.5f;
+					float position[3];
+					position[axis] = side;
+					position[( axis + 1 ) % 3] = a;
+					position[( axis + 2 ) % 3] = b;
+					vertices[( face * 4 ) + corner] = eae6320::Graphics::sVertex( position[0], position[1], position[2],
+						255, 255, 255, 255, a + 0.5f, b + 0.5f );
+				}
+				const uint16_t firstVertex = static_cast<uint16_t>( face * 4 );
+				// The winding is flipped on the negative faces so that every face points outward
+				const uint16_t faceIndices[2][6] =
+				{
+					{ 0, 2, 1, 1, 2, 3 },
+					{ 0, 1, 2, 1, 3, 2 },
+				};
+				for ( uint32_t i = 0; i < 6; ++i )
+				{
+					indices[( face * 6 ) + i] = static_cast<uint16_t>( firstVertex + faceIndices[face % 2][i] );
+				}
+			}
+		}
+		std::vector<uint8_t> data;
+		{
+			AppendData( vertexCount, data );
+			AppendData( indexCount, data );
+			AppendData( static_cast<uint32_t>( sizeof( uint16_t ) ), data );
+			const eae6320::Graphics::sVertexFormat vertexFormat = { eae6320::Graphics::VertexFormats::Uncompressed, { 1.0f, 1.0f, 1.0f }, { 0.0f, 0.0f, 0.0f } };
+			AppendData( vertexFormat, data );
+			eae6320::Math::sAABB boundingBox;
+			{
+				boundingBox.m_min = eae6320::Math::cVector( -0.5f, -0.5f, -0.5f );
+				boundingBox.m_max = eae6320::Math::cVector( 0.5f, 0.5f, 0.5f );
+			}
+			AppendData( boundingBox, data );
+			const eae6320::Math::sSphere boundingSphere = { eae6320::Math::cVector(), std::sqrt( 0.75f ) };
+			AppendData( boundingSphere, data );
+			AppendData( static_cast<uint32_t>( 1 ), data );
+			const eae6320::Graphics::Mesh::sLod lod = { 0, indexCount };
+			AppendData( lod, data );
+			AppendData( vertices, data );
+			AppendData( indices, data );
+		}
+		return WriteFile( i_path, data );
+	}
+
+	bool WriteTexture( const std::string& i_path )
+	{
+		// A single white 4x4 BC1 block
+		DirectX::DDS_HEADER header;
+		{
+			std::memset( &header, 0, sizeof( header ) );
+			header.dwSize = sizeof( DirectX::DDS_HEADER );
+			header.dwFlags = 0x1 | 0x2 | 0x4 | 0x1000;	// Caps, height, width, and pixel format
+			header.dwHeight = 4;
+			header.dwWidth = 4;
+			header.dwMipMapCount = 1;
+			header.ddspf = DirectX::DDSPF_DXT1;
+			header.dwCaps = 0x1000;	// Texture
+		}
+		const uint8_t block[8] = { 0xff, 0xff, 0xff, 0xff, 0, 0, 0, 0 };
+		std::vector<uint8_t> data;
+		AppendData( DirectX::DDS_MAGIC, data );
+		AppendData( header, data );
+		AppendData( block, data );
+		return WriteFile( i_path, data );
+	}
+
+	bool WriteFile( const std::string& i_path, const std::vector<uint8_t>& i_data )
+	{
+		std::string errorMessage;
+		if ( !eae6320::Platform::WriteBinaryFile( i_path.c_str(), i_data.data(), i_data.size(), &errorMessage ) )
+		{
+			EAE6320_ASSERTF( false, errorMessage.c_str() );
+			eae6320::Logging::OutputError( "Failed to write the replay asset \"%s\": %s", i_path.c_str(), errorMessage.c_str() );
+			return false;
+		}
+		return true;
+	}
+
+	void AppendString( const std::string& i_string, std::vector<uint8_t>& io_data )
+	{
+		// The terminating NULL is included
+		io_data.insert( io_data.end(), i_string.c_str(), i_string.c_str() + i_string.size() + 1 );
+	}
+
+	template<typename tData> void AppendData( const tData& i_data, std::vector<uint8_t>& io_data )
+	{
+		const uint8_t* const bytes = reinterpret_cast<const uint8_t*>( &i_data );
+		io_data.insert( io_data.end(), bytes, bytes + sizeof( tData ) );
+	}
+}
@@ -0,0 +1,77 @@
+/*
+	A replay scene is a fixed set of objects that is submitted to the renderer every frame
+
+	It doesn't need any built assets:
+	It writes its own small binary files (in the same formats that the asset builders write)
+	and then loads them the same way that the game does,
+	and so it can run anywhere that the null graphics platform builds.
+*/
+
+#ifndef EAE6320_CREPLAYSCENE_H
+#define EAE6320_CREPLAYSCENE_H
+
+// Header Files
+//=============
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../../Engine/Graphics/Graphics.h"
+#include "../../Engine/Math/cMatrix_transformation.h"
+#include "../../Engine/Math/cQuaternion.h"
+#include "../../Engine/Math/cVector.h"
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+	class cReplayScene
+	{
+		// Interface
+		//==========
+
+	public:
+
+		// Initialization / Clean Up
+		//--------------------------
+
+		// The assets are written to the given directory before they are loaded
+		bool Initialize( const std::string& i_assetDirectory );
+		bool CleanUp();
+
+		// Render
+		//-------
+
+		// Submits everything that is visible at the given time
+		// (the camera orbits the scene so that culling and sorting change from frame to frame)
+		void SubmitFrame( const uint32_t i_frameIndex, const float i_elapsedSecondCount );
+
+		// Data
+		//=====
+
+	private:
+
+		static const uint32_t s_materialCount = 4;
+		static const uint32_t s_gridWidth = 24;
+		static const uint32_t s_spriteCount = 8;
+		static const uint32_t s_textCount = 4;
+
+		Graphics::Mesh m_mesh;
+		Graphics::cMaterial m_materials[s_materialCount];
+		std::vector<Graphics::MeshObject> m_meshObjects;
+		// Every cube spins at its own rate,
+		// and so all of their transforms are recalculated every frame
+		std::vector<Math::cVector> m_positions;
+		std::vector<Math::cVector> m_eulerAngles;
+		std::vector<Math::cQuaternion> m_orientations;
+		std::vector<Math::cMatrix_transformation> m_transforms;
+		Graphics::cSprite* m_sprites[s_spriteCount] = {};
+		Graphics::UIObject m_uiObjects[s_spriteCount];
+		Graphics::cText* m_texts[s_textCount] = {};
+		Graphics::UIText m_uiTexts[s_textCount];
+		Graphics::Camera m_camera;
+	};
+}
+
+#endif	// EAE6320_CREPLAYSCENE_H
@@ -0,0 +1,343 @@
+/*
+	The main() function is where the program starts execution
+
+	This tests that the batched (SIMD) overlap tests return the same results as the scalar tests
+	for random boxes against random frustums and spheres,
+	and then times both so that any change to them can be compared.
+	It returns EXIT_FAILURE and prints every check that failed.
+
+	Usage:
+		BoundingVolumesTests [repetitionCount]
+*/
+
+// Header Files
+//=============
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "../../Engine/Math/BoundingVolumes.h"
+#include "../../Engine/Math/cMatrix_transformation.h"
+#include "../../Engine/Math/cQuaternion.h"
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	bool s_wereThereFailures = false;
+
+	void Check( const bool i_condition, const char* const i_description, const unsigned int i_lineNumber );
+	#define TEST_CHECK( i_condition ) Check( ( i_condition ), #i_condition, __LINE__ )
+
+	// A deterministic generator so that every run tests (and times) the same shapes
+	class cRandom
+	{
+	public:
+		float Get( const float i_min, const float i_max );
+	private:
+		uint32_t m_state = 1;
+	};
+
+	std::vector<eae6320::Math::sAABB> CreateBoxes( cRandom& io_random, const size_t i_count );
+	eae6320::Math::sFrustum CreateFrustum( cRandom& io_random );
+	eae6320::Math::sSphere CreateSphere( cRandom& io_random );
+
+	// Rounding can differ between the scalar and batched tests,
+	// and so a mismatch is only a failure if the shapes aren't within a rounding error of touching
+	bool IsFrustumResultAmbiguous( const eae6320::Math::sFrustum& i_frustum, const eae6320::Math::sAABB& i_box );
+	bool IsSphereResultAmbiguous( const eae6320::Math::sSphere& i_sphere, const eae6320::Math::sAABB& i_box );
+
+	void TestFrustums( cRandom& io_random );
+	void TestSpheres( cRandom& io_random );
+	void TimeTests( cRandom& io_random, const unsigned int i_repetitionCount );
+
+	constexpr size_t s_boxCount = 4096;
+	constexpr float s_roundingTolerance = 1.0e-4f;
+}
+
+// Entry Point
+//============
+
+int main( int i_argumentCount, char** i_arguments )
+{
+	const int repetitionCount = ( i_argumentCount > 1 ) ? std::atoi( i_arguments[1] ) : 200;
+	if ( repetitionCount <= 0 )
+	{
+		std::fprintf( stderr, "The repetition count must be positive\n" );
+		return EXIT_FAILURE;
+	}
+
+	cRandom random;
+	TestFrustums( random );
+	TestSpheres( random );
+	TimeTests( random, static_cast<unsigned int>( repetitionCount ) );
+
+	if ( !s_wereThereFailures )
+	{
+		std::printf( "Every bounding volume test passed\n" );
+	}
+	return s_wereThereFailures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	void Check( const bool i_condition, const char* const i_description, const unsigned int i_lineNumber )
+	{
+		if ( !i_condition )
+		{
+			std::fprintf( stderr, "Line %u: Failed check: %s\n", i_lineNumber, i_description );
+			s_wereThereFailures = true;
+		}
+	}
+
+	float cRandom::Get( const float i_min, const float i_max )
+	{
+		m_state = ( m_state * 1103515245u ) + 12345u;
+		const float t = static_cast<float>( ( m_state >> 8 ) & 0xffff ) / 65535.0f;
+		return i_min + ( ( i_max - i_min ) * t );
+	}
+
+	std::vector<eae6320::Math::sAABB> CreateBoxes( cRandom& io_random, const size_t i_count )
+	{
+		// The boxes are spread over a volume about as large as the frustums
+		// with a mix of sizes so that every result (outside, intersecting, and inside) is common
+		std::vector<eae6320::Math::sAABB> boxes( i_count );
+		for ( eae6320::Math::sAABB& box : boxes )
+		{
+			const eae6320::Math::cVector center( io_random.Get( -60.0f, 60.0f ), io_random.Get( -60.0f, 60.0f ), io_random.Get( -60.0f, 60.0f ) );
+			const float size = ( io_random.Get( 0.0f, 1.0f ) < 0.9f ) ? 4.0f : 40.0f;
+			const eae6320::Math::cVector halfExtents( io_random.Get( 0.0f, size ), io_random.Get( 0.0f, size ), io_random.Get( 0.0f, size ) );
+			box = eae6320::Math::sAABB::CreateFromCenterAndHalfExtents( center, halfExtents );
+		}
+		return boxes;
+	}
+
+	eae6320::Math::sFrustum CreateFrustum( cRandom& io_random )
+	{
+		const eae6320::Math::cVector axis( io_random.Get( -1.0f, 1.0f ), io_random.Get( -1.0f, 1.0f ), io_random.Get( 0.1f, 1.0f ) );
+		const eae6320::Math::cQuaternion orientation( io_random.Get( -3.14f, 3.14f ), axis.CreateNormalized() );
+		const eae6320::Math::cVector position( io_random.Get( -20.0f, 20.0f ), io_random.Get( -20.0f, 20.0f ), io_random.Get( -20.0f, 20.0f ) );
+		return eae6320::Math::sFrustum::CreateFromTransform(
+			eae6320::Math::cMatrix_transformation::CreateWorldToCameraTransform( orientation, position )
+			* eae6320::Math::cMatrix_transformation::CreateCameraToScreenTransform_perspectiveProjection(
+				io_random.Get( 0.5f, 1.5f ), io_random.Get( 1.0f, 2.0f ), 0.1f, io_random.Get( 50.0f, 100.0f ) ) );
+	}
+
+	eae6320::Math::sSphere CreateSphere( cRandom& io_random )
+	{
+		eae6320::Math::sSphere sphere;
+		sphere.m_center = eae6320::Math::cVector( io_random.Get( -50.0f, 50.0f ), io_random.Get( -50.0f, 50.0f ), io_random.Get( -50.0f, 50.0f ) );
+		sphere.m_radius = io_random.Get( 5.0f, 40.0f );
+		return sphere;
+	}
+
+	bool IsFrustumResultAmbiguous( const eae6320::Math::sFrustum& i_frustum, const eae6320::Math::sAABB& i_box )
+	{
+		const eae6320::Math::cVector center = i_box.GetCenter();
+		const eae6320::Math::cVector halfExtents = i_box.GetHalfExtents();
+		for ( const eae6320::Math::sPlane& plane : i_frustum.m_planes )
+		{
+			const float distance = plane.GetSignedDistance( center );
+			const float radius = ( halfExtents.x * std::abs( plane.m_normal.x ) )
+				+ ( halfExtents.y * std::abs( plane.m_normal.y ) ) + ( halfExtents.z * std::abs( plane.m_normal.z ) );
+			const float tolerance = s_roundingTolerance * ( std::abs( distance ) + radius + std::abs( plane.m_distance ) + 1.0f );
+			if ( ( std::abs( distance + radius ) <= tolerance ) || ( std::abs( distance - radius ) <= tolerance ) )
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool IsSphereResultAmbiguous( const eae6320::Math::sSphere& i_sphere, const eae6320::Math::sAABB& i_box )
+	{
+		float distanceSquared = 0.0f;
+		const float center[] = { i_sphere.m_center.x, i_sphere.m_center.y, i_sphere.m_center.z };
+		const float min[] = { i_box.m_min.x, i_box.m_min.y, i_box.m_min.z };
+		const float max[] = { i_box.m_max.x, i_box.m_max.y, i_box.m_max.z };
+		for ( unsigned int i = 0; i < 3; ++i )
+		{
+			const float offset = std::min( std::max( center[i], min[i] ), max[i] ) - center[i];
+			distanceSquared += offset * offset;
+		}
+		const float radiusSquared = i_sphere.m_radius * i_sphere.m_radius;
+		return std::abs( distanceSquared - radiusSquared ) <= ( s_roundingTolerance * ( radiusSquared + 1.0f ) );
+	}
+
+	void TestFrustums( cRandom& io_random )
+	{
+		const std::vector<eae6320::Math::sAABB> boxes = CreateBoxes( io_random, s_boxCount );
+		unsigned int resultCounts[3] = {};
+		unsigned int ambiguousCount = 0;
+		for ( unsigned int frustumIndex = 0; frustumIndex < 64; ++frustumIndex )
+		{
+			const eae6320::Math::sFrustum frustum = CreateFrustum( io_random );
+			for ( size_t i = 0; i < s_boxCount; i += 8 )
+			{
+				uint32_t insideMask4_low, insideMask4_high, insideMask8;
+				const uint32_t overlapMask4 = eae6320::Math::Overlaps4( frustum, &boxes[i], &insideMask4_low )
+					| ( eae6320::Math::Overlaps4( frustum, &boxes[i + 4], &insideMask4_high ) << 4 );
+				const uint32_t insideMask4 = insideMask4_low | ( insideMask4_high << 4 );
+				const uint32_t overlapMask8 = eae6320::Math::Overlaps8( frustum, &boxes[i], &insideMask8 );
+				// The inside mask is optional, and not asking for it must not change the overlap mask
+				TEST_CHECK( eae6320::Math::Overlaps8( frustum, &boxes[i] ) == overlapMask8 );
+				for ( unsigned int j = 0; j < 8; ++j )
+				{
+					const eae6320::Math::eContainment expected = eae6320::Math::Classify( frustum, boxes[i + j] );
+					++resultCounts[expected];
+					const bool doesOverlap = expected != eae6320::Math::Outside;
+					const bool isInside = expected == eae6320::Math::Inside;
+					const uint32_t bit = 1u << j;
+					// A box that is inside must also overlap
+					TEST_CHECK( ( ( insideMask4 & ~overlapMask4 ) & bit ) == 0 );
+					TEST_CHECK( ( ( insideMask8 & ~overlapMask8 ) & bit ) == 0 );
+					if ( ( ( ( overlapMask4 & bit ) != 0 ) != doesOverlap ) || ( ( ( insideMask4 & bit ) != 0 ) != isInside )
+						|| ( ( ( overlapMask8 & bit ) != 0 ) != doesOverlap ) || ( ( ( insideMask8 & bit ) != 0 ) != isInside ) )
+					{
+						const bool isAmbiguous = IsFrustumResultAmbiguous( frustum, boxes[i + j] );
+						TEST_CHECK( isAmbiguous );
+						++ambiguousCount;
+					}
+				}
+			}
+		}
+		// Make sure that the shapes actually tested every kind of result
+		TEST_CHECK( resultCounts[eae6320::Math::Outside] > 1000 );
+		TEST_CHECK( resultCounts[eae6320::Math::Intersecting] > 1000 );
+		TEST_CHECK( resultCounts[eae6320::Math::Inside] > 1000 );
+		std::printf( "Frustums: %u outside, %u intersecting, %u inside (%u differed by less than a rounding error)\n",
+			resultCounts[eae6320::Math::Outside], resultCounts[eae6320::Math::Intersecting], resultCounts[eae6320::Math::Inside],
+			ambiguousCount );
+	}
+
+	void TestSpheres( cRandom& io_random )
+	{
+		const std::vector<eae6320::Math::sAABB> boxes = CreateBoxes( io_random, s_boxCount );
+		unsigned int overlapCount = 0;
+		unsigned int ambiguousCount = 0;
+		for ( unsigned int sphereIndex = 0; sphereIndex < 64; ++sphereIndex )
+		{
+			const eae6320::Math::sSphere sphere = CreateSphere( io_random );
+			for ( size_t i = 0; i < s_boxCount; i += 8 )
+			{
+				const uint32_t overlapMask4 = eae6320::Math::Overlaps4( sphere, &boxes[i] )
+					| ( eae6320::Math::Overlaps4( sphere, &boxes[i + 4] ) << 4 );
+				const uint32_t overlapMask8 = eae6320::Math::Overlaps8( sphere, &boxes[i] );
+				for ( unsigned int j = 0; j < 8; ++j )
+				{
+					const bool expected = eae6320::Math::Overlaps( boxes[i + j], sphere );
+					overlapCount += expected ? 1 : 0;
+					const uint32_t bit = 1u << j;
+					if ( ( ( ( overlapMask4 & bit ) != 0 ) != expected ) || ( ( ( overlapMask8 & bit ) != 0 ) != expected ) )
+					{
+						const bool isAmbiguous = IsSphereResultAmbiguous( sphere, boxes[i + j] );
+						TEST_CHECK( isAmbiguous );
+						++ambiguousCount;
+					}
+				}
+			}
+		}
+		const unsigned int testCount = static_cast<unsigned int>( s_boxCount * 64 );
+		TEST_CHECK( overlapCount > ( testCount / 20 ) );
+		TEST_CHECK( overlapCount < ( testCount - ( testCount / 20 ) ) );
+		std::printf( "Spheres: %u of %u overlapped (%u differed by less than a rounding error)\n",
+			overlapCount, testCount, ambiguousCount );
+	}
+
+	void TimeTests( cRandom& io_random, const unsigned int i_repetitionCount )
+	{
+		// Every result is added to a total that is printed
+		// so that the compiler can't remove any of the tests
+		const std::vector<eae6320::Math::sAABB> boxes = CreateBoxes( io_random, s_boxCount );
+		const eae6320::Math::sFrustum frustum = CreateFrustum( io_random );
+		const eae6320::Math::sSphere sphere = CreateSphere( io_random );
+		const double testCount = static_cast<double>( s_boxCount ) * i_repetitionCount;
+		uint32_t total = 0;
+		double nanosecondsPerBox[6];
+		{
+			std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+			for ( unsigned int r = 0; r < i_repetitionCount; ++r )
+			{
+				for ( size_t i = 0; i < s_boxCount; ++i )
+				{
+					total += static_cast<uint32_t>( eae6320::Math::Classify( frustum, boxes[i] ) );
+				}
+			}
+			nanosecondsPerBox[0] = std::chrono::duration<double, std::nano>( std::chrono::steady_clock::now() - startTime ).count() / testCount;
+
+			startTime = std::chrono::steady_clock::now();
+			for ( unsigned int r = 0; r < i_repetitionCount; ++r )
+			{
+				for ( size_t i = 0; i < s_boxCount; i += 4 )
+				{
+					uint32_t insideMask;
+					total += eae6320::Math::Overlaps4( frustum, &boxes[i], &insideMask ) + insideMask;
+				}
+			}
+			nanosecondsPerBox[1] = std::chrono::duration<double, std::nano>( std::chrono::steady_clock::now() - startTime ).count() / testCount;
+
+			startTime = std::chrono::steady_clock::now();
+			for ( unsigned int r = 0; r < i_repetitionCount; ++r )
+			{
+				for ( size_t i = 0; i < s_boxCount; i += 8 )
+				{
+					uint32_t insideMask;
+					total += eae6320::Math::Overlaps8( frustum, &boxes[i], &insideMask ) + insideMask;
+				}
+			}
+			nanosecondsPerBox[2] = std::chrono::duration<double, std::nano>( std::chrono::steady_clock::now() - startTime ).count() / testCount;
+		}
+		{
+			std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+			for ( unsigned int r = 0; r < i_repetitionCount; ++r )
+			{
+				for ( size_t i = 0; i < s_boxCount; ++i )
+				{
+					total += eae6320::Math::Overlaps( boxes[i], sphere ) ? 1 : 0;
+				}
+			}
+			nanosecondsPerBox[3] = std::chrono::duration<double, std::nano>( std::chrono::steady_clock::now() - startTime ).count() / testCount;
+
+			startTime = std::chrono::steady_clock::now();
+			for ( unsigned int r = 0; r < i_repetitionCount; ++r )
+			{
+				for ( size_t i = 0; i < s_boxCount; i += 4 )
+				{
+					total += eae6320::Math::Overlaps4( sphere, &boxes[i] );
+				}
+			}
+			nanosecondsPerBox[4] = std::chrono::duration<double, std::nano>( std::chrono::steady_clock::now() - startTime ).count() / testCount;
+
+			startTime = std::chrono::steady_clock::now();
+			for ( unsigned int r = 0; r < i_repetitionCount; ++r )
+			{
+				for ( size_t i = 0; i < s_boxCount; i += 8 )
+				{
+					total += eae6320::Math::Overlaps8( sphere, &boxes[i] );
+				}
+			}
+			nanosecondsPerBox[5] = std::chrono::duration<double, std::nano>( std::chrono::steady_clock::now() - startTime ).count() / testCount;
+		}
+#if defined( __AVX__ )
+		const char* const overlaps8Description = "AVX";
+#else
+		const char* const overlaps8Description = "2 x SSE without AVX";
+#endif
+		std::printf( "Time per box (%u boxes x %u repetitions, checksum %u):\n"
+			"\tfrustum: Classify() %.2f ns, Overlaps4() %.2f ns (%.1fx), Overlaps8() %.2f ns (%.1fx, %s)\n"
+			"\tsphere: Overlaps() %.2f ns, Overlaps4() %.2f ns (%.1fx), Overlaps8() %.2f ns (%.1fx, %s)\n",
+			static_cast<unsigned int>( s_boxCount ), i_repetitionCount, total,
+			nanosecondsPerBox[0], nanosecondsPerBox[1], nanosecondsPerBox[0] / nanosecondsPerBox[1],
+			nanosecondsPerBox[2], nanosecondsPerBox[0] / nanosecondsPerBox[2], overlaps8Description,
+			nanosecondsPerBox[3], nanosecondsPerBox[4], nanosecondsPerBox[3] / nanosecondsPerBox[4],
+			nanosecondsPerBox[5], nanosecondsPerBox[3] / nanosecondsPerBox[5], overlaps8Description );
+	}
+}
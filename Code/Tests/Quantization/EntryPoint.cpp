@@ -0,0 +1,375 @@
+/*
+	The main() function is where the program starts execution
+
+	This checks the encodings in Quantization.h against the bounds that it documents.
+	It returns EXIT_FAILURE and prints every check that failed.
+*/
+
+// Header Files
+//=============
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include "../../Engine/Math/BoundingVolumes.h"
+#include "../../Engine/Math/cQuaternion.h"
+#include "../../Engine/Math/cVector.h"
+#include "../../Engine/Math/Quantization.h"
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	bool s_wereThereFailures = false;
+
+	void Check( const bool i_condition, const char* const i_description, const unsigned int i_lineNumber );
+	#define TEST_CHECK( i_condition ) Check( ( i_condition ), #i_condition, __LINE__ )
+
+	// A deterministic generator so that every run tests the same values
+	class cRandom
+	{
+	public:
+		float Get( const float i_min, const float i_max );
+	private:
+		uint32_t m_state = 1;
+	};
+
+	eae6320::Math::cVector GetRandomDirection( cRandom& io_random );
+	// These are calculated with doubles so that the angle isn't limited by float precision
+	// (acos() of a dot product can't tell apart angles less than about 0.03 degrees)
+	double GetAngleInDegrees( const eae6320::Math::cVector& i_lhs, const eae6320::Math::cVector& i_rhs );
+	double GetAngleInDegrees( const eae6320::Math::cQuaternion& i_lhs, const eae6320::Math::cQuaternion& i_rhs );
+
+	void TestPositions( cRandom& io_random );
+	void TestUnitVectors( cRandom& io_random );
+	void TestRotations( cRandom& io_random );
+	void TestHalfFloats_specialValues();
+	void TestHalfFloats_roundTrip();
+	void TestHalfFloats_error( cRandom& io_random );
+
+	constexpr unsigned int s_valueCount = 1 << 20;
+}
+
+// Entry Point
+//============
+
+int main( int, char** )
+{
+	cRandom random;
+	TestPositions( random );
+	TestUnitVectors( random );
+	TestRotations( random );
+	TestHalfFloats_specialValues();
+	TestHalfFloats_roundTrip();
+	TestHalfFloats_error( random );
+
+	if ( !s_wereThereFailures )
+	{
+		std::printf( "Every quantization test passed\n" );
+	}
+	return s_wereThereFailures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	void Check( const bool i_condition, const char* const i_description, const unsigned int i_lineNumber )
+	{
+		if ( !i_condition )
+		{
+			std::fprintf( stderr, "Line %u: Failed check: %s\n", i_lineNumber, i_description );
+			s_wereThereFailures = true;
+		}
+	}
+
+	float cRandom::Get( const float i_min, const float i_max )
+	{
+		m_state = ( m_state * 1103515245u ) + 12345u;
+		const uint32_t high = m_state >> 16;
+		m_state = ( m_state * 1103515245u ) + 12345u;
+		const double t = static_cast<double>( ( high << 16 ) | ( m_state >> 16 ) ) / 4294967295.0;
+		return static_cast<float>( i_min + ( ( static_cast<double>( i_max ) - i_min ) * t ) );
+	}
+
+	eae6320::Math::cVector GetRandomDirection( cRandom& io_random )
+	{
+		// Points are rejected outside of the unit sphere so that every direction is equally likely
+		while ( true )
+		{
+			const eae6320::Math::cVector point( io_random.Get( -1.0f, 1.0f ), io_random.Get( -1.0f, 1.0f ), io_random.Get( -1.0f, 1.0f ) );
+			const float length = point.GetLength();
+			if ( ( length > 0.01f ) && ( length <= 1.0f ) )
+			{
+				return point / length;
+			}
+		}
+	}
+
+	double GetAngleInDegrees( const eae6320::Math::cVector& i_lhs, const eae6320::Math::cVector& i_rhs )
+	{
+		const double lhs[] = { i_lhs.x, i_lhs.y, i_lhs.z };
+		const double rhs[] = { i_rhs.x, i_rhs.y, i_rhs.z };
+		const double cross[] = { ( lhs[1] * rhs[2] ) - ( lhs[2] * rhs[1] ), ( lhs[2] * rhs[0] ) - ( lhs[0] * rhs[2] ), ( lhs[0] * rhs[1] ) - ( lhs[1] * rhs[0] ) };
+		const double dot = ( lhs[0] * rhs[0] ) + ( lhs[1] * rhs[1] ) + ( lhs[2] * rhs[2] );
+		const double crossLength = std::sqrt( ( cross[0] * cross[0] ) + ( cross[1] * cross[1] ) + ( cross[2] * cross[2] ) );
+		return std::atan2( crossLength, dot ) * ( 180.0 / 3.14159265358979323846 );
+	}
+
+	double GetAngleInDegrees( const eae6320::Math::cQuaternion& i_lhs, const eae6320::Math::cQuaternion& i_rhs )
+	{
+		const double lhs[] = { i_lhs.m_w, i_lhs.m_x, i_lhs.m_y, i_lhs.m_z };
+		const double rhs[] = { i_rhs.m_w, i_rhs.m_x, i_rhs.m_y, i_rhs.m_z };
+		// q and -q are the same rotation
+		double dot = 0.0;
+		for ( unsigned int i = 0; i < 4; ++i )
+		{
+			dot += lhs[i] * rhs[i];
+		}
+		const double sign = ( dot < 0.0 ) ? -1.0 : 1.0;
+		// The rotation between them is twice the angle between the 4D vectors,
+		// which is 2 * atan( |a - b| / |a + b| ) for unit vectors
+		double differenceLengthSquared = 0.0, sumLengthSquared = 0.0;
+		for ( unsigned int i = 0; i < 4; ++i )
+		{
+			differenceLengthSquared += ( lhs[i] - ( sign * rhs[i] ) ) * ( lhs[i] - ( sign * rhs[i] ) );
+			sumLengthSquared += ( lhs[i] + ( sign * rhs[i] ) ) * ( lhs[i] + ( sign * rhs[i] ) );
+		}
+		return 4.0 * std::atan2( std::sqrt( differenceLengthSquared ), std::sqrt( sumLengthSquared ) ) * ( 180.0 / 3.14159265358979323846 );
+	}
+
+	void TestPositions( cRandom& io_random )
+	{
+		using namespace eae6320::Math;
+
+		// Each component is within half of a step of the original (plus float rounding),
+		// and encoding a decoded position gives back the same bits
+		// as long as a step is at least twice the float precision of the bounds' coordinates
+		double maxFloatRounding = 0.0;
+		unsigned int driftCount = 0, driftTestCount = 0;
+		for ( unsigned int i = 0; i < s_valueCount; ++i )
+		{
+			// The bounds are a different size on every axis and aren't centered on the origin
+			// (some are small enough that their steps are less than the float precision)
+			const cVector center( io_random.Get( -1000.0f, 1000.0f ), io_random.Get( -1000.0f, 1000.0f ), io_random.Get( -1000.0f, 1000.0f ) );
+			const cVector halfExtents( std::exp2( io_random.Get( -4.0f, 12.0f ) ), std::exp2( io_random.Get( -4.0f, 12.0f ) ), std::exp2( io_random.Get( -4.0f, 12.0f ) ) );
+			const sAABB bounds = sAABB::CreateFromCenterAndHalfExtents( center, halfExtents );
+			const cVector position( io_random.Get( bounds.m_min.x, bounds.m_max.x ), io_random.Get( bounds.m_min.y, bounds.m_max.y ),
+				io_random.Get( bounds.m_min.z, bounds.m_max.z ) );
+
+			const sQuantizedPosition position_quantized = QuantizePosition( position, bounds );
+			const cVector position_decoded = DequantizePosition( position_quantized, bounds );
+			const sQuantizedPosition position_requantized = QuantizePosition( position_decoded, bounds );
+			const float original[] = { position.x, position.y, position.z };
+			const float decoded[] = { position_decoded.x, position_decoded.y, position_decoded.z };
+			const uint16_t quantized[] = { position_quantized.x, position_quantized.y, position_quantized.z };
+			const uint16_t requantized[] = { position_requantized.x, position_requantized.y, position_requantized.z };
+			const float boundsMin[] = { bounds.m_min.x, bounds.m_min.y, bounds.m_min.z };
+			const float boundsMax[] = { bounds.m_max.x, bounds.m_max.y, bounds.m_max.z };
+			for ( unsigned int j = 0; j < 3; ++j )
+			{
+				const double step = ( static_cast<double>( boundsMax[j] ) - boundsMin[j] ) / 65535.0;
+				const double error = std::abs( static_cast<double>( decoded[j] ) - original[j] );
+				// The float precision is the distance between floats the size of the largest coordinate,
+				// and the float rounding is measured in those
+				const double floatPrecision = std::ldexp( 1.0, std::ilogb( std::max( std::abs( boundsMin[j] ), std::abs( boundsMax[j] ) ) ) - 23 );
+				maxFloatRounding = std::max( maxFloatRounding, ( error - ( 0.5 * step ) ) / floatPrecision );
+				if ( step >= ( 2.0 * floatPrecision ) )
+				{
+					++driftTestCount;
+					if ( requantized[j] != quantized[j] )
+					{
+						++driftCount;
+					}
+				}
+			}
+		}
+		std::printf( "Positions: the largest error is half of a step plus %.2f times the float precision"
+			" and %u of %u re-encoded coordinates drifted\n", maxFloatRounding, driftCount, driftTestCount );
+		TEST_CHECK( maxFloatRounding <= 4.0 );
+		TEST_CHECK( driftCount == 0 );
+
+		// Positions outside of the bounds are clamped to the bounds
+		{
+			const sAABB bounds = sAABB::CreateFromCenterAndHalfExtents( cVector( 1.0f, 2.0f, 3.0f ), cVector( 4.0f, 5.0f, 6.0f ) );
+			const sQuantizedPosition below = QuantizePosition( cVector( -100.0f, -100.0f, -100.0f ), bounds );
+			const sQuantizedPosition above = QuantizePosition( cVector( 100.0f, 100.0f, 100.0f ), bounds );
+			TEST_CHECK( ( below.x == 0 ) && ( below.y == 0 ) && ( below.z == 0 ) );
+			TEST_CHECK( ( above.x == 0xffff ) && ( above.y == 0xffff ) && ( above.z == 0xffff ) );
+		}
+	}
+
+	void TestUnitVectors( cRandom& io_random )
+	{
+		using namespace eae6320::Math;
+
+		// 32 bits are less than 0.003 degrees from the original direction
+		// and 16 bits are less than 0.65 degrees from it
+		double maxAngle_32 = 0.0, maxAngle_16 = 0.0;
+		for ( unsigned int i = 0; i < s_valueCount; ++i )
+		{
+			const cVector direction = GetRandomDirection( io_random );
+			maxAngle_32 = std::max( maxAngle_32, GetAngleInDegrees( direction, DecodeUnitVector_32( EncodeUnitVector_32( direction ) ) ) );
+			maxAngle_16 = std::max( maxAngle_16, GetAngleInDegrees( direction, DecodeUnitVector_16( EncodeUnitVector_16( direction ) ) ) );
+		}
+		// The axes and the octahedron's edges (where the bottom half is folded) are where the encoding is most likely to go wrong
+		const cVector edgeCases[] =
+		{
+			cVector( 1.0f, 0.0f, 0.0f ), cVector( -1.0f, 0.0f, 0.0f ), cVector( 0.0f, 1.0f, 0.0f ), cVector( 0.0f, -1.0f, 0.0f ),
+			cVector( 0.0f, 0.0f, 1.0f ), cVector( 0.0f, 0.0f, -1.0f ),
+			cVector( 1.0f, 1.0f, 0.0f ).CreateNormalized(), cVector( -1.0f, 1.0f, 0.0f ).CreateNormalized(),
+			cVector( 1.0f, -1.0f, 0.0f ).CreateNormalized(), cVector( -1.0f, -1.0f, 0.0f ).CreateNormalized(),
+			cVector( 1.0f, 1.0f, -1.0f ).CreateNormalized(), cVector( -1.0f, -1.0f, -1.0f ).CreateNormalized(),
+			cVector( 1.0e-4f, -1.0e-4f, -1.0f ).CreateNormalized(), cVector( 1.0f, 0.0f, -1.0e-6f ).CreateNormalized(),
+		};
+		for ( const cVector& direction : edgeCases )
+		{
+			maxAngle_32 = std::max( maxAngle_32, GetAngleInDegrees( direction, DecodeUnitVector_32( EncodeUnitVector_32( direction ) ) ) );
+			maxAngle_16 = std::max( maxAngle_16, GetAngleInDegrees( direction, DecodeUnitVector_16( EncodeUnitVector_16( direction ) ) ) );
+		}
+		std::printf( "Unit vectors: the largest error is %.5f degrees with 32 bits and %.4f degrees with 16 bits\n", maxAngle_32, maxAngle_16 );
+		TEST_CHECK( maxAngle_32 < 0.003 );
+		TEST_CHECK( maxAngle_16 < 0.65 );
+	}
+
+	void TestRotations( cRandom& io_random )
+	{
+		using namespace eae6320::Math;
+
+		// Rotations are less than 0.26 degrees from the original rotation
+		double maxAngle = 0.0;
+		for ( unsigned int i = 0; i < s_valueCount; ++i )
+		{
+			const cQuaternion rotation( io_random.Get( -3.14159265f, 3.14159265f ), GetRandomDirection( io_random ) );
+			maxAngle = std::max( maxAngle, GetAngleInDegrees( rotation, DecodeRotation( EncodeRotation( rotation ) ) ) );
+		}
+		// Rotations where two components are equally large are where the wrong largest component is most likely to be chosen
+		const cVector axes[] = { cVector( 1.0f, 0.0f, 0.0f ), cVector( 0.0f, 1.0f, 0.0f ), cVector( 0.0f, 0.0f, 1.0f ), cVector( 1.0f, 1.0f, 1.0f ).CreateNormalized() };
+		for ( const cVector& axis : axes )
+		{
+			const float angles[] = { 0.0f, 1.57079633f, -1.57079633f, 3.14159265f, 2.0943951f };
+			for ( const float angle : angles )
+			{
+				const cQuaternion rotation( angle, axis );
+				maxAngle = std::max( maxAngle, GetAngleInDegrees( rotation, DecodeRotation( EncodeRotation( rotation ) ) ) );
+			}
+		}
+		std::printf( "Rotations: the largest error is %.4f degrees\n", maxAngle );
+		TEST_CHECK( maxAngle < 0.26 );
+	}
+
+	void TestHalfFloats_specialValues()
+	{
+		using namespace eae6320::Math;
+
+		// Zeros keep their sign
+		TEST_CHECK( EncodeHalfFloat( 0.0f ) == 0x0000 );
+		TEST_CHECK( EncodeHalfFloat( -0.0f ) == 0x8000 );
+		TEST_CHECK( ( DecodeHalfFloat( 0x0000 ) == 0.0f ) && !std::signbit( DecodeHalfFloat( 0x0000 ) ) );
+		TEST_CHECK( ( DecodeHalfFloat( 0x8000 ) == 0.0f ) && std::signbit( DecodeHalfFloat( 0x8000 ) ) );
+
+		// The smallest denormalized half float is 2^-24,
+		// and anything less than half of that rounds to zero
+		const float smallestDenormalized = std::ldexp( 1.0f, -24 );
+		TEST_CHECK( EncodeHalfFloat( smallestDenormalized ) == 0x0001 );
+		TEST_CHECK( EncodeHalfFloat( -smallestDenormalized ) == 0x8001 );
+		TEST_CHECK( DecodeHalfFloat( 0x0001 ) == smallestDenormalized );
+		TEST_CHECK( EncodeHalfFloat( std::ldexp( 1.0f, -26 ) ) == 0x0000 );
+		TEST_CHECK( EncodeHalfFloat( std::numeric_limits<float>::denorm_min() ) == 0x0000 );
+		// The largest denormalized and smallest normalized half floats
+		TEST_CHECK( EncodeHalfFloat( std::ldexp( 1023.0f, -24 ) ) == 0x03ff );
+		TEST_CHECK( EncodeHalfFloat( std::ldexp( 1.0f, -14 ) ) == 0x0400 );
+		// Rounding up the largest denormalized mantissa carries into the exponent
+		TEST_CHECK( EncodeHalfFloat( std::ldexp( 1023.75f, -24 ) ) == 0x0400 );
+
+		// 65504 is the largest half float,
+		// and anything that rounds to more than that becomes infinity
+		TEST_CHECK( EncodeHalfFloat( 65504.0f ) == 0x7bff );
+		TEST_CHECK( DecodeHalfFloat( 0x7bff ) == 65504.0f );
+		TEST_CHECK( EncodeHalfFloat( 65519.0f ) == 0x7bff );
+		TEST_CHECK( EncodeHalfFloat( 65520.0f ) == 0x7c00 );
+		TEST_CHECK( EncodeHalfFloat( -65520.0f ) == 0xfc00 );
+		TEST_CHECK( EncodeHalfFloat( 1.0e10f ) == 0x7c00 );
+		TEST_CHECK( EncodeHalfFloat( std::numeric_limits<float>::max() ) == 0x7c00 );
+		TEST_CHECK( EncodeHalfFloat( std::numeric_limits<float>::infinity() ) == 0x7c00 );
+		TEST_CHECK( EncodeHalfFloat( -std::numeric_limits<float>::infinity() ) == 0xfc00 );
+		TEST_CHECK( DecodeHalfFloat( 0x7c00 ) == std::numeric_limits<float>::infinity() );
+		TEST_CHECK( DecodeHalfFloat( 0xfc00 ) == -std::numeric_limits<float>::infinity() );
+
+		// NaN stays NaN
+		{
+			const uint16_t encodedNaN = EncodeHalfFloat( std::numeric_limits<float>::quiet_NaN() );
+			TEST_CHECK( ( ( encodedNaN & 0x7c00 ) == 0x7c00 ) && ( ( encodedNaN & 0x03ff ) != 0 ) );
+			TEST_CHECK( std::isnan( DecodeHalfFloat( encodedNaN ) ) );
+			TEST_CHECK( std::isnan( DecodeHalfFloat( 0x7c01 ) ) );
+			TEST_CHECK( std::isnan( DecodeHalfFloat( 0xffff ) ) );
+		}
+
+		// Integers up to 2048 are exact
+		// (2049 is the first that isn't)
+		{
+			bool areIntegersExact = true;
+			for ( int i = -2048; i <= 2048; ++i )
+			{
+				const float value = static_cast<float>( i );
+				areIntegersExact = areIntegersExact && ( DecodeHalfFloat( EncodeHalfFloat( value ) ) == value );
+			}
+			TEST_CHECK( areIntegersExact );
+			TEST_CHECK( DecodeHalfFloat( EncodeHalfFloat( 2049.0f ) ) != 2049.0f );
+		}
+	}
+
+	void TestHalfFloats_roundTrip()
+	{
+		using namespace eae6320::Math;
+
+		// Every half float that isn't NaN decodes to a float that encodes back to the same bits
+		unsigned int failureCount = 0;
+		for ( uint32_t i = 0; i <= 0xffff; ++i )
+		{
+			const uint16_t encodedValue = static_cast<uint16_t>( i );
+			const bool isNaN = ( ( encodedValue & 0x7c00 ) == 0x7c00 ) && ( ( encodedValue & 0x03ff ) != 0 );
+			if ( !isNaN && ( EncodeHalfFloat( DecodeHalfFloat( encodedValue ) ) != encodedValue ) )
+			{
+				++failureCount;
+			}
+		}
+		std::printf( "Half floats: %u of the 63488 that aren't NaN didn't round trip\n", failureCount );
+		TEST_CHECK( failureCount == 0 );
+	}
+
+	void TestHalfFloats_error( cRandom& io_random )
+	{
+		using namespace eae6320::Math;
+
+		// Normalized values are within 1/2048 of the original value (relative to its size),
+		// and denormalized ones are within half of the smallest step (2^-25)
+		// (both of which mean that the encoding rounded to the nearest half float)
+		double maxRelativeError = 0.0, maxDenormalizedError = 0.0;
+		for ( unsigned int i = 0; i < s_valueCount; ++i )
+		{
+			// The exponents are uniformly distributed to cover every half float exponent equally
+			const float exponent = io_random.Get( -26.0f, 16.0f );
+			const float sign = ( io_random.Get( 0.0f, 1.0f ) < 0.5f ) ? -1.0f : 1.0f;
+			const float value = sign * std::min( std::exp2( exponent ), 65504.0f );
+			const double error = std::abs( static_cast<double>( DecodeHalfFloat( EncodeHalfFloat( value ) ) ) - value );
+			if ( std::abs( value ) >= std::ldexp( 1.0f, -14 ) )
+			{
+				maxRelativeError = std::max( maxRelativeError, error / std::abs( value ) );
+			}
+			else
+			{
+				maxDenormalizedError = std::max( maxDenormalizedError, error );
+			}
+		}
+		std::printf( "Half floats: the largest relative error is 1/%.0f and the largest denormalized error is 2^%.2f\n",
+			1.0 / maxRelativeError, std::log2( maxDenormalizedError ) );
+		TEST_CHECK( maxRelativeError <= ( 1.0 / 2048.0 ) );
+		TEST_CHECK( maxDenormalizedError <= std::ldexp( 1.0, -25 ) );
+	}
+}
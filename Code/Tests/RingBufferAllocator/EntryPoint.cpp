@@ -0,0 +1,223 @@
+/*
+	The main() function is where the program starts execution
+
+	This tests the ring buffer allocator that the constant buffers use for per-draw-call data
+	(it only keeps track of offsets and so it doesn't need a GPU).
+	It returns EXIT_FAILURE and prints every check that failed.
+*/
+
+// Header Files
+//=============
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "../../Engine/Graphics/cRingBufferAllocator.h"
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	bool s_wereThereFailures = false;
+
+	void Check( const bool i_condition, const char* const i_description, const unsigned int i_lineNumber );
+	#define TEST_CHECK( i_condition ) Check( ( i_condition ), #i_condition, __LINE__ )
+
+	void TestAlignment();
+	void TestNoSplitAtTheEnd();
+	void TestWrapAround();
+	void TestInFlightFrameLimit();
+}
+
+// Entry Point
+//============
+
+int main()
+{
+	TestAlignment();
+	TestNoSplitAtTheEnd();
+	TestWrapAround();
+	TestInFlightFrameLimit();
+
+	if ( !s_wereThereFailures )
+	{
+		std::printf( "Every ring buffer allocator test passed\n" );
+	}
+	return s_wereThereFailures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	void Check( const bool i_condition, const char* const i_description, const unsigned int i_lineNumber )
+	{
+		if ( !i_condition )
+		{
+			std::fprintf( stderr, "Line %u: Failed check: %s\n", i_lineNumber, i_description );
+			s_wereThereFailures = true;
+		}
+	}
+
+	void TestAlignment()
+	{
+		eae6320::Graphics::cRingBufferAllocator allocator;
+		TEST_CHECK( allocator.Initialize( 1024, 256 ) );
+		size_t offset;
+		// Every size is rounded up to the alignment
+		TEST_CHECK( allocator.Allocate( 1, offset ) && ( offset == 0 ) );
+		TEST_CHECK( allocator.Allocate( 100, offset ) && ( offset == 256 ) );
+		TEST_CHECK( allocator.Allocate( 257, offset ) && ( offset == 512 ) );
+		TEST_CHECK( allocator.GetUsedSize() == 1024 );
+		// The buffer is full
+		TEST_CHECK( !allocator.Allocate( 1, offset ) );
+		// Nothing can be allocated that is empty or larger than the whole buffer
+		allocator.Reset();
+		TEST_CHECK( !allocator.Allocate( 0, offset ) );
+		TEST_CHECK( !allocator.Allocate( 1025, offset ) );
+		TEST_CHECK( allocator.GetUsedSize() == 0 );
+	}
+
+	void TestNoSplitAtTheEnd()
+	{
+		eae6320::Graphics::cRingBufferAllocator allocator;
+		TEST_CHECK( allocator.Initialize( 1024, 256 ) );
+		size_t offset;
+		// Frame A: [0, 512)
+		TEST_CHECK( allocator.Allocate( 512, offset ) && ( offset == 0 ) );
+		allocator.EndFrame();
+		// Frame B: [512, 768)
+		TEST_CHECK( allocator.Allocate( 256, offset ) && ( offset == 512 ) );
+		allocator.EndFrame();
+		allocator.ReleaseOldestFrame();
+		TEST_CHECK( allocator.GetUsedSize() == 256 );
+		// Frame C doesn't fit in [768, 1024),
+		// and so it must skip the end of the buffer and start at the beginning instead of being split
+		TEST_CHECK( allocator.Allocate( 512, offset ) && ( offset == 0 ) );
+		// The skipped memory stays in use until frame C is released
+		TEST_CHECK( allocator.GetUsedSize() == 1024 );
+		TEST_CHECK( !allocator.Allocate( 1, offset ) );
+		allocator.EndFrame();
+		allocator.ReleaseOldestFrame();
+		TEST_CHECK( allocator.GetUsedSize() == 768 );
+		allocator.ReleaseOldestFrame();
+		TEST_CHECK( allocator.GetUsedSize() == 0 );
+		TEST_CHECK( allocator.GetInFlightFrameCount() == 0 );
+		// A range that ends exactly at the end of the buffer isn't skipped
+		TEST_CHECK( allocator.Allocate( 768, offset ) && ( offset == 0 ) );
+		TEST_CHECK( allocator.Allocate( 256, offset ) && ( offset == 768 ) );
+		TEST_CHECK( allocator.GetUsedSize() == 1024 );
+	}
+
+	void TestWrapAround()
+	{
+		// Frames with varying numbers of allocations of varying sizes are made many times around the buffer
+		// the same way that the renderer uses it (with a frame released whenever the maximum number are in flight),
+		// and every range that is handed out must be aligned, inside of the buffer,
+		// and not overlap any range that is still in flight
+		const size_t bufferSize = 64 * 1024;
+		const size_t alignment = 256;
+		eae6320::Graphics::cRingBufferAllocator allocator;
+		TEST_CHECK( allocator.Initialize( bufferSize, alignment ) );
+		struct sRange { size_t begin, end; };
+		std::vector<sRange> frameRanges[eae6320::Graphics::cRingBufferAllocator::s_maxFrameCount];
+		std::vector<sRange> currentFrameRanges;
+		unsigned int randomState = 1;
+		size_t totalAllocatedSize = 0;
+		unsigned int wrapCount = 0;
+		size_t previousOffset = 0;
+		for ( unsigned int frame = 0; frame < 1000; ++frame )
+		{
+			if ( !allocator.CanEndFrame() )
+			{
+				frameRanges[allocator.GetOldestInFlightFrameIndex()].clear();
+				allocator.ReleaseOldestFrame();
+			}
+			currentFrameRanges.clear();
+			randomState = ( randomState * 1103515245u ) + 12345u;
+			const unsigned int allocationCount = 1 + ( ( randomState >> 16 ) % 8 );
+			for ( unsigned int i = 0; i < allocationCount; ++i )
+			{
+				randomState = ( randomState * 1103515245u ) + 12345u;
+				const size_t size = 1 + ( ( randomState >> 8 ) % ( 4 * 1024 ) );
+				size_t offset;
+				if ( !allocator.Allocate( size, offset ) )
+				{
+					// Every frame is small enough that this is only possible when frames are in flight
+					TEST_CHECK( allocator.GetInFlightFrameCount() > 0 );
+					if ( allocator.GetInFlightFrameCount() == 0 )
+					{
+						break;
+					}
+					frameRanges[allocator.GetOldestInFlightFrameIndex()].clear();
+					allocator.ReleaseOldestFrame();
+					--i;
+					continue;
+				}
+				TEST_CHECK( ( offset % alignment ) == 0 );
+				TEST_CHECK( ( offset + size ) <= bufferSize );
+				const sRange range = { offset, offset + size };
+				for ( const std::vector<sRange>& ranges : frameRanges )
+				{
+					for ( const sRange& other : ranges )
+					{
+						TEST_CHECK( ( range.end <= other.begin ) || ( other.end <= range.begin ) );
+					}
+				}
+				for ( const sRange& other : currentFrameRanges )
+				{
+					TEST_CHECK( ( range.end <= other.begin ) || ( other.end <= range.begin ) );
+				}
+				currentFrameRanges.push_back( range );
+				if ( offset < previousOffset )
+				{
+					++wrapCount;
+				}
+				previousOffset = offset;
+				totalAllocatedSize += size;
+			}
+			allocator.EndFrame();
+			frameRanges[allocator.GetNewestInFlightFrameIndex()] = currentFrameRanges;
+			TEST_CHECK( allocator.GetUsedSize() <= bufferSize );
+		}
+		// Make sure that the test actually went around the buffer
+		TEST_CHECK( totalAllocatedSize > ( 10 * bufferSize ) );
+		TEST_CHECK( wrapCount > 10 );
+		while ( allocator.GetInFlightFrameCount() > 0 )
+		{
+			allocator.ReleaseOldestFrame();
+		}
+		TEST_CHECK( allocator.GetUsedSize() == 0 );
+	}
+
+	void TestInFlightFrameLimit()
+	{
+		const unsigned int maxFrameCount = eae6320::Graphics::cRingBufferAllocator::s_maxFrameCount;
+		TEST_CHECK( maxFrameCount == 4 );
+		eae6320::Graphics::cRingBufferAllocator allocator;
+		TEST_CHECK( allocator.Initialize( 1024, 16 ) );
+		size_t offset;
+		for ( unsigned int i = 0; i < maxFrameCount; ++i )
+		{
+			TEST_CHECK( allocator.CanEndFrame() );
+			TEST_CHECK( allocator.Allocate( 16, offset ) );
+			allocator.EndFrame();
+			TEST_CHECK( allocator.GetInFlightFrameCount() == ( i + 1 ) );
+			TEST_CHECK( allocator.GetNewestInFlightFrameIndex() == i );
+		}
+		// A fifth frame can't end until the oldest has been released
+		TEST_CHECK( !allocator.CanEndFrame() );
+		TEST_CHECK( allocator.GetOldestInFlightFrameIndex() == 0 );
+		allocator.ReleaseOldestFrame();
+		TEST_CHECK( allocator.CanEndFrame() );
+		TEST_CHECK( allocator.GetOldestInFlightFrameIndex() == 1 );
+		TEST_CHECK( allocator.GetUsedSize() == ( 3 * 16 ) );
+		// The frame indices wrap around so that per-frame data can be kept in a parallel array
+		TEST_CHECK( allocator.Allocate( 16, offset ) );
+		allocator.EndFrame();
+		TEST_CHECK( allocator.GetNewestInFlightFrameIndex() == 0 );
+		TEST_CHECK( !allocator.CanEndFrame() );
+	}
+}
@@ -0,0 +1,456 @@
+/*
+	The main() function is where the program starts execution
+
+	This measures the errors of the SIMD functions against the double-precision standard library
+	and checks them against the bounds that SimdFunctions.h documents,
+	and then times them against calling the single-precision standard library for each value.
+	It returns EXIT_FAILURE and prints every check that failed.
+
+	Usage:
+		SimdFunctionsTests [repetitionCount]
+*/
+
+// Header Files
+//=============
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "../../Engine/Math/cQuaternion.h"
+#include "../../Engine/Math/cVector.h"
+#include "../../Engine/Math/SimdFunctions.h"
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	bool s_wereThereFailures = false;
+
+	void Check( const bool i_condition, const char* const i_description, const unsigned int i_lineNumber );
+	#define TEST_CHECK( i_condition ) Check( ( i_condition ), #i_condition, __LINE__ )
+
+	// A deterministic generator so that every run tests (and times) the same values
+	class cRandom
+	{
+	public:
+		float Get( const float i_min, const float i_max );
+	private:
+		uint32_t m_state = 1;
+	};
+
+	// The error of a float result compared to the correctly-rounded float of an exact result
+	struct sError
+	{
+		double maxAbsoluteError = 0.0;
+		double maxRelativeError = 0.0;
+		uint32_t maxUlps = 0;
+
+		void Add( const float i_result, const double i_exact );
+	};
+	uint32_t GetUlpDistance( const float i_lhs, const float i_rhs );
+
+	void TestSinCos( cRandom& io_random );
+	void TestAcos( cRandom& io_random );
+	void TestAtan2( cRandom& io_random );
+	void TestRsqrt( cRandom& io_random );
+	void TestOrientations( cRandom& io_random );
+	void TimeFunctions( cRandom& io_random, const unsigned int i_repetitionCount );
+
+	// A count that isn't a multiple of either lane count
+	// so that the padding of the remaining values is tested too
+	constexpr size_t s_valueCount = ( 1 << 20 ) + 3;
+}
+
+// Entry Point
+//============
+
+int main( int i_argumentCount, char** i_arguments )
+{
+	const int repetitionCount = ( i_argumentCount > 1 ) ? std::atoi( i_arguments[1] ) : 16;
+	if ( repetitionCount <= 0 )
+	{
+		std::fprintf( stderr, "The repetition count must be positive\n" );
+		return EXIT_FAILURE;
+	}
+
+	cRandom random;
+	TestSinCos( random );
+	TestAcos( random );
+	TestAtan2( random );
+	TestRsqrt( random );
+	TestOrientations( random );
+	TimeFunctions( random, static_cast<unsigned int>( repetitionCount ) );
+
+	if ( !s_wereThereFailures )
+	{
+		std::printf( "Every SIMD function test passed\n" );
+	}
+	return s_wereThereFailures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	void Check( const bool i_condition, const char* const i_description, const unsigned int i_lineNumber )
+	{
+		if ( !i_condition )
+		{
+			std::fprintf( stderr, "Line %u: Failed check: %s\n", i_lineNumber, i_description );
+			s_wereThereFailures = true;
+		}
+	}
+
+	float cRandom::Get( const float i_min, const float i_max )
+	{
+		m_state = ( m_state * 1103515245u ) + 12345u;
+		const uint32_t high = m_state >> 16;
+		m_state = ( m_state * 1103515245u ) + 12345u;
+		const double t = static_cast<double>( ( high << 16 ) | ( m_state >> 16 ) ) / 4294967295.0;
+		return static_cast<float>( i_min + ( ( static_cast<double>( i_max ) - i_min ) * t ) );
+	}
+
+	void sError::Add( const float i_result, const double i_exact )
+	{
+		const double absoluteError = std::abs( static_cast<double>( i_result ) - i_exact );
+		maxAbsoluteError = std::max( maxAbsoluteError, absoluteError );
+		if ( i_exact != 0.0 )
+		{
+			maxRelativeError = std::max( maxRelativeError, absoluteError / std::abs( i_exact ) );
+		}
+		maxUlps = std::max( maxUlps, GetUlpDistance( i_result, static_cast<float>( i_exact ) ) );
+	}
+
+	uint32_t GetUlpDistance( const float i_lhs, const float i_rhs )
+	{
+		// The bits are mapped so that consecutive floats are consecutive integers (including across zero)
+		int32_t lhs, rhs;
+		std::memcpy( &lhs, &i_lhs, sizeof( lhs ) );
+		std::memcpy( &rhs, &i_rhs, sizeof( rhs ) );
+		const int64_t lhs_ordered = ( lhs < 0 ) ? ( static_cast<int64_t>( INT32_MIN ) - lhs ) : lhs;
+		const int64_t rhs_ordered = ( rhs < 0 ) ? ( static_cast<int64_t>( INT32_MIN ) - rhs ) : rhs;
+		return static_cast<uint32_t>( std::min<int64_t>( std::abs( lhs_ordered - rhs_ordered ), UINT32_MAX ) );
+	}
+
+	void TestSinCos( cRandom& io_random )
+	{
+		std::vector<float> angles( s_valueCount ), sines( s_valueCount ), cosines( s_valueCount );
+		for ( float& angle : angles )
+		{
+			// Most angles are small (like they usually are) but the whole documented range is tested
+			angle = ( io_random.Get( 0.0f, 1.0f ) < 0.75f ) ? io_random.Get( -10.0f, 10.0f ) : io_random.Get( -8192.0f, 8192.0f );
+		}
+		for ( const eae6320::Math::eAccuracy accuracy : { eae6320::Math::HighAccuracy, eae6320::Math::LowAccuracy } )
+		{
+			eae6320::Math::SinCos( angles.data(), sines.data(), cosines.data(), s_valueCount, accuracy );
+			sError error;
+			// ULPs are only meaningful away from the zeros
+			sError error_ulps;
+			for ( size_t i = 0; i < s_valueCount; ++i )
+			{
+				const double exact_sin = std::sin( static_cast<double>( angles[i] ) );
+				const double exact_cos = std::cos( static_cast<double>( angles[i] ) );
+				error.Add( sines[i], exact_sin );
+				error.Add( cosines[i], exact_cos );
+				if ( std::abs( exact_sin ) >= 0.001 )
+				{
+					error_ulps.Add( sines[i], exact_sin );
+				}
+				if ( std::abs( exact_cos ) >= 0.001 )
+				{
+					error_ulps.Add( cosines[i], exact_cos );
+				}
+			}
+			if ( accuracy == eae6320::Math::HighAccuracy )
+			{
+				TEST_CHECK( error_ulps.maxUlps <= 2 );
+				TEST_CHECK( error.maxAbsoluteError < 1.0e-7 );
+				std::printf( "SinCos (high): %u ULPs, absolute error %.3g\n", error_ulps.maxUlps, error.maxAbsoluteError );
+			}
+			else
+			{
+				TEST_CHECK( error.maxAbsoluteError < 3.7e-5 );
+				std::printf( "SinCos (low): absolute error %.3g\n", error.maxAbsoluteError );
+			}
+		}
+	}
+
+	void TestAcos( cRandom& io_random )
+	{
+		std::vector<float> values( s_valueCount ), angles( s_valueCount );
+		for ( float& value : values )
+		{
+			value = io_random.Get( -1.0f, 1.0f );
+		}
+		// The limits are where the approximations are least accurate
+		values[0] = -1.0f;
+		values[1] = 1.0f;
+		values[2] = 0.0f;
+		for ( const eae6320::Math::eAccuracy accuracy : { eae6320::Math::HighAccuracy, eae6320::Math::LowAccuracy } )
+		{
+			eae6320::Math::Acos( values.data(), angles.data(), s_valueCount, accuracy );
+			sError error;
+			for ( size_t i = 0; i < s_valueCount; ++i )
+			{
+				error.Add( angles[i], std::acos( static_cast<double>( values[i] ) ) );
+			}
+			if ( accuracy == eae6320::Math::HighAccuracy )
+			{
+				TEST_CHECK( error.maxUlps <= 2 );
+				std::printf( "Acos (high): %u ULPs, absolute error %.3g\n", error.maxUlps, error.maxAbsoluteError );
+			}
+			else
+			{
+				TEST_CHECK( error.maxAbsoluteError < 6.8e-5 );
+				std::printf( "Acos (low): absolute error %.3g\n", error.maxAbsoluteError );
+			}
+		}
+	}
+
+	void TestAtan2( cRandom& io_random )
+	{
+		const size_t count = s_valueCount & ~size_t( 3 );
+		std::vector<float> ys( count ), xs( count );
+		for ( size_t i = 0; i < count; ++i )
+		{
+			ys[i] = io_random.Get( -100.0f, 100.0f );
+			xs[i] = io_random.Get( -100.0f, 100.0f );
+		}
+		// The axes are tested exactly
+		const float axes[][2] = { { 0.0f, 1.0f }, { 1.0f, 0.0f }, { 0.0f, -1.0f }, { -1.0f, 0.0f } };
+		for ( size_t i = 0; i < 4; ++i )
+		{
+			ys[i] = axes[i][0];
+			xs[i] = axes[i][1];
+		}
+		for ( const eae6320::Math::eAccuracy accuracy : { eae6320::Math::HighAccuracy, eae6320::Math::LowAccuracy } )
+		{
+			sError error;
+			for ( size_t i = 0; i < count; i += 4 )
+			{
+				float angles[4];
+				_mm_storeu_ps( angles, eae6320::Math::Atan2_4( _mm_loadu_ps( &ys[i] ), _mm_loadu_ps( &xs[i] ), accuracy ) );
+				for ( size_t j = 0; j < 4; ++j )
+				{
+					error.Add( angles[j], std::atan2( static_cast<double>( ys[i + j] ), static_cast<double>( xs[i + j] ) ) );
+				}
+			}
+			// Both zeros return zero (which isn't what std::atan2() does for a negative zero x)
+			float angles[4];
+			_mm_storeu_ps( angles, eae6320::Math::Atan2_4( _mm_setzero_ps(), _mm_setzero_ps(), accuracy ) );
+			TEST_CHECK( ( angles[0] == 0.0f ) && ( angles[3] == 0.0f ) );
+			if ( accuracy == eae6320::Math::HighAccuracy )
+			{
+				TEST_CHECK( error.maxUlps <= 4 );
+				std::printf( "Atan2 (high): %u ULPs, absolute error %.3g\n", error.maxUlps, error.maxAbsoluteError );
+			}
+			else
+			{
+				TEST_CHECK( error.maxAbsoluteError < 1.2e-5 );
+				std::printf( "Atan2 (low): absolute error %.3g\n", error.maxAbsoluteError );
+			}
+		}
+	}
+
+	void TestRsqrt( cRandom& io_random )
+	{
+		const size_t count = s_valueCount & ~size_t( 3 );
+		std::vector<float> values( count );
+		for ( float& value : values )
+		{
+			// The values are spread evenly over the exponents of normalized floats
+			value = std::exp2( io_random.Get( -125.0f, 127.0f ) );
+		}
+		for ( const eae6320::Math::eAccuracy accuracy : { eae6320::Math::HighAccuracy, eae6320::Math::LowAccuracy } )
+		{
+			sError error;
+			for ( size_t i = 0; i < count; i += 4 )
+			{
+				float results[4];
+				_mm_storeu_ps( results, eae6320::Math::Rsqrt4( _mm_loadu_ps( &values[i] ), accuracy ) );
+				for ( size_t j = 0; j < 4; ++j )
+				{
+					error.Add( results[j], 1.0 / std::sqrt( static_cast<double>( values[i + j] ) ) );
+				}
+			}
+			if ( accuracy == eae6320::Math::HighAccuracy )
+			{
+				TEST_CHECK( error.maxUlps <= 4 );
+				std::printf( "Rsqrt (high): %u ULPs, relative error %.3g\n", error.maxUlps, error.maxRelativeError );
+			}
+			else
+			{
+				TEST_CHECK( error.maxRelativeError < 3.7e-4 );
+				std::printf( "Rsqrt (low): relative error %.3g\n", error.maxRelativeError );
+			}
+		}
+	}
+
+	void TestOrientations( cRandom& io_random )
+	{
+		// The batched conversion must make the same rotations as the scalar one
+		// (the count isn't a multiple of the block size)
+		const size_t count = 1000;
+		std::vector<eae6320::Math::cVector> eulerAngles( count );
+		std::vector<eae6320::Math::cQuaternion> orientations( count );
+		for ( eae6320::Math::cVector& angles : eulerAngles )
+		{
+			angles = eae6320::Math::cVector( io_random.Get( -10.0f, 10.0f ), io_random.Get( -10.0f, 10.0f ), io_random.Get( -10.0f, 10.0f ) );
+		}
+		eae6320::Math::CreateOrientations( eulerAngles.data(), orientations.data(), count );
+		float maxDifference = 0.0f;
+		for ( size_t i = 0; i < count; ++i )
+		{
+			const eae6320::Math::cQuaternion expected = eae6320::Math::cQuaternion::CreateFromEulerAngles( eulerAngles[i] );
+			const eae6320::Math::cQuaternion& actual = orientations[i];
+			maxDifference = std::max( maxDifference, std::max(
+				std::max( std::abs( actual.m_w - expected.m_w ), std::abs( actual.m_x - expected.m_x ) ),
+				std::max( std::abs( actual.m_y - expected.m_y ), std::abs( actual.m_z - expected.m_z ) ) ) );
+		}
+		TEST_CHECK( maxDifference < 1.0e-6f );
+		std::printf( "CreateOrientations(): largest difference from CreateFromEulerAngles() %.3g\n", maxDifference );
+	}
+
+	void TimeFunctions( cRandom& io_random, const unsigned int i_repetitionCount )
+	{
+		// Every result is added to a total that is printed
+		// so that the compiler can't remove any of the calls
+		const size_t count = 65536;
+		std::vector<float> angles( count ), values( count ), ys( count ), xs( count ), positives( count );
+		std::vector<float> output0( count ), output1( count );
+		std::vector<eae6320::Math::cVector> eulerAngles( count );
+		std::vector<eae6320::Math::cQuaternion> orientations( count );
+		for ( size_t i = 0; i < count; ++i )
+		{
+			angles[i] = io_random.Get( -10.0f, 10.0f );
+			values[i] = io_random.Get( -1.0f, 1.0f );
+			ys[i] = io_random.Get( -100.0f, 100.0f );
+			xs[i] = io_random.Get( -100.0f, 100.0f );
+			positives[i] = io_random.Get( 1.0e-3f, 1.0e3f );
+			eulerAngles[i] = eae6320::Math::cVector( angles[i], values[i], xs[i] );
+		}
+		float total = 0.0f;
+		const double valueCount = static_cast<double>( count ) * i_repetitionCount;
+		typedef std::chrono::steady_clock tClock;
+		const auto GetNanosecondsPerValue = [valueCount]( const tClock::time_point i_startTime )
+		{
+			return std::chrono::duration<double, std::nano>( tClock::now() - i_startTime ).count() / valueCount;
+		};
+		double nanoseconds_library[5], nanoseconds_simd[5];
+		const char* const names[5] = { "sin + cos", "acos", "atan2", "1 / sqrt", "Euler angles to quaternion" };
+
+		tClock::time_point startTime = tClock::now();
+		for ( unsigned int r = 0; r < i_repetitionCount; ++r )
+		{
+			for ( size_t i = 0; i < count; ++i )
+			{
+				total += std::sin( angles[i] ) + std::cos( angles[i] );
+			}
+		}
+		nanoseconds_library[0] = GetNanosecondsPerValue( startTime );
+		startTime = tClock::now();
+		for ( unsigned int r = 0; r < i_repetitionCount; ++r )
+		{
+			eae6320::Math::SinCos( angles.data(), output0.data(), output1.data(), count );
+			total += output0[r] + output1[r];
+		}
+		nanoseconds_simd[0] = GetNanosecondsPerValue( startTime );
+
+		startTime = tClock::now();
+		for ( unsigned int r = 0; r < i_repetitionCount; ++r )
+		{
+			for ( size_t i = 0; i < count; ++i )
+			{
+				total += std::acos( values[i] );
+			}
+		}
+		nanoseconds_library[1] = GetNanosecondsPerValue( startTime );
+		startTime = tClock::now();
+		for ( unsigned int r = 0; r < i_repetitionCount; ++r )
+		{
+			eae6320::Math::Acos( values.data(), output0.data(), count );
+			total += output0[r];
+		}
+		nanoseconds_simd[1] = GetNanosecondsPerValue( startTime );
+
+		startTime = tClock::now();
+		for ( unsigned int r = 0; r < i_repetitionCount; ++r )
+		{
+			for ( size_t i = 0; i < count; ++i )
+			{
+				total += std::atan2( ys[i], xs[i] );
+			}
+		}
+		nanoseconds_library[2] = GetNanosecondsPerValue( startTime );
+		startTime = tClock::now();
+		for ( unsigned int r = 0; r < i_repetitionCount; ++r )
+		{
+			__m128 sum = _mm_setzero_ps();
+			for ( size_t i = 0; i < count; i += 4 )
+			{
+				sum = _mm_add_ps( sum, eae6320::Math::Atan2_4( _mm_loadu_ps( &ys[i] ), _mm_loadu_ps( &xs[i] ) ) );
+			}
+			total += _mm_cvtss_f32( sum );
+		}
+		nanoseconds_simd[2] = GetNanosecondsPerValue( startTime );
+
+		startTime = tClock::now();
+		for ( unsigned int r = 0; r < i_repetitionCount; ++r )
+		{
+			for ( size_t i = 0; i < count; ++i )
+			{
+				total += 1.0f / std::sqrt( positives[i] );
+			}
+		}
+		nanoseconds_library[3] = GetNanosecondsPerValue( startTime );
+		startTime = tClock::now();
+		for ( unsigned int r = 0; r < i_repetitionCount; ++r )
+		{
+			__m128 sum = _mm_setzero_ps();
+			for ( size_t i = 0; i < count; i += 4 )
+			{
+				sum = _mm_add_ps( sum, eae6320::Math::Rsqrt4( _mm_loadu_ps( &positives[i] ) ) );
+			}
+			total += _mm_cvtss_f32( sum );
+		}
+		nanoseconds_simd[3] = GetNanosecondsPerValue( startTime );
+
+		startTime = tClock::now();
+		for ( unsigned int r = 0; r < i_repetitionCount; ++r )
+		{
+			for ( size_t i = 0; i < count; ++i )
+			{
+				orientations[i] = eae6320::Math::cQuaternion::CreateFromEulerAngles( eulerAngles[i] );
+			}
+			total += orientations[r].m_w;
+		}
+		nanoseconds_library[4] = GetNanosecondsPerValue( startTime );
+		startTime = tClock::now();
+		for ( unsigned int r = 0; r < i_repetitionCount; ++r )
+		{
+			eae6320::Math::CreateOrientations( eulerAngles.data(), orientations.data(), count );
+			total += orientations[r].m_w;
+		}
+		nanoseconds_simd[4] = GetNanosecondsPerValue( startTime );
+
+#if defined( __AVX__ )
+		const char* const laneDescription = "8 lanes (AVX) for arrays, 4 for Atan2_4() and Rsqrt4()";
+#else
+		const char* const laneDescription = "4 lanes (SSE)";
+#endif
+		std::printf( "Time per value (%u values x %u repetitions, %s, checksum %g):\n",
+			static_cast<unsigned int>( count ), i_repetitionCount, laneDescription, total );
+		for ( unsigned int i = 0; i < 5; ++i )
+		{
+			std::printf( "\t%s: standard library %.2f ns, SIMD %.2f ns (%.1fx)\n",
+				names[i], nanoseconds_library[i], nanoseconds_simd[i], nanoseconds_library[i] / nanoseconds_simd[i] );
+		}
+	}
+}
@@ -0,0 +1,189 @@
+// Header Files
+//=============
+
+#include "AtlasTable.h"
+
+#include <cctype>
+#include <cstddef>
+#include <cstring>
+#include "UtilityFunctions.h"
+#include "../../Engine/Platform/Platform.h"
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	bool ArePathsEqual( const char* i_path_a, const char* i_path_b );
+
+	// The file is a count of textures, a count of images, and the gutter,
+	// then each texture (its size and path),
+	// then each image (its texture index and rectangle and path).
+	// The paths are NULL-terminated.
+	void WriteUint16( const uint16_t i_value, std::vector<uint8_t>& io_data );
+	void WriteString( const std::string& i_value, std::vector<uint8_t>& io_data );
+	bool ReadUint16( const uint8_t*& io_position, const uint8_t* const i_end, uint16_t& o_value );
+	bool ReadString( const uint8_t*& io_position, const uint8_t* const i_end, std::string& o_value );
+}
+
+// Interface
+//==========
+
+const eae6320::AssetBuild::sAtlasTable::sImage* eae6320::AssetBuild::sAtlasTable::FindImage( const char* const i_sourceRelativePath ) const
+{
+	for ( const sImage& image : images )
+	{
+		if ( ArePathsEqual( image.sourceRelativePath.c_str(), i_sourceRelativePath ) )
+		{
+			return &image;
+		}
+	}
+	return NULL;
+}
+
+bool eae6320::AssetBuild::sAtlasTable::Write( const char* const i_path, std::string* const o_errorMessage ) const
+{
+	std::vector<uint8_t> data;
+	WriteUint16( static_cast<uint16_t>( textures.size() ), data );
+	WriteUint16( static_cast<uint16_t>( images.size() ), data );
+	WriteUint16( gutter, data );
+	for ( const sTexture& texture : textures )
+	{
+		WriteUint16( texture.width, data );
+		WriteUint16( texture.height, data );
+		WriteString( texture.builtRelativePath, data );
+	}
+	for ( const sImage& image : images )
+	{
+		WriteUint16( image.textureIndex, data );
+		WriteUint16( image.left, data );
+		WriteUint16( image.top, data );
+		WriteUint16( image.width, data );
+		WriteUint16( image.height, data );
+		WriteString( image.sourceRelativePath, data );
+	}
+	return Platform::WriteBinaryFile( i_path, &data[0], data.size(), o_errorMessage );
+}
+
+bool eae6320::AssetBuild::sAtlasTable::LoadBuiltAtlas( const char* const i_atlasSourceRelativePath, std::string* const o_errorMessage )
+{
+	bool wereThereErrors = false;
+
+	Platform::sDataFromFile dataFromFile;
+	std::string path;
+	{
+		std::string builtAssetDir, builtRelativePath;
+		if ( !Platform::GetEnvironmentVariable( "BuiltAssetDir", builtAssetDir, o_errorMessage )
+			|| !ConvertSourceRelativePathToBuiltRelativePath( i_atlasSourceRelativePath, "atlases", builtRelativePath, o_errorMessage ) )
+		{
+			return false;
+		}
+		path = builtAssetDir + builtRelativePath;
+	}
+	if ( !Platform::LoadBinaryFile( path.c_str(), dataFromFile, o_errorMessage ) )
+	{
+		return false;
+	}
+	{
+		const uint8_t* position = reinterpret_cast<const uint8_t*>( dataFromFile.data );
+		const uint8_t* const end = position + dataFromFile.size;
+		uint16_t textureCount, imageCount;
+		if ( !ReadUint16( position, end, textureCount ) || !ReadUint16( position, end, imageCount )
+			|| !ReadUint16( position, end, gutter ) )
+		{
+			wereThereErrors = true;
+			goto OnExit;
+		}
+		textures.resize( textureCount );
+		for ( sTexture& texture : textures )
+		{
+			if ( !ReadUint16( position, end, texture.width ) || !ReadUint16( position, end, texture.height )
+				|| !ReadString( position, end, texture.builtRelativePath ) )
+			{
+				wereThereErrors = true;
+				goto OnExit;
+			}
+		}
+		images.resize( imageCount );
+		for ( sImage& image : images )
+		{
+			if ( !ReadUint16( position, end, image.textureIndex )
+				|| !ReadUint16( position, end, image.left ) || !ReadUint16( position, end, image.top )
+				|| !ReadUint16( position, end, image.width ) || !ReadUint16( position, end, image.height )
+				|| !ReadString( position, end, image.sourceRelativePath )
+				|| ( image.textureIndex >= textureCount ) )
+			{
+				wereThereErrors = true;
+				goto OnExit;
+			}
+		}
+	}
+
+OnExit:
+
+	if ( wereThereErrors && o_errorMessage )
+	{
+		*o_errorMessage = "The built atlas " + path + " is invalid";
+	}
+	dataFromFile.Free();
+
+	return !wereThereErrors;
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	bool ArePathsEqual( const char* i_path_a, const char* i_path_b )
+	{
+		for ( ; *i_path_a && *i_path_b; ++i_path_a, ++i_path_b )
+		{
+			const bool isSlash_a = ( *i_path_a == '/' ) || ( *i_path_a == '\\' );
+			const bool isSlash_b = ( *i_path_b == '/' ) || ( *i_path_b == '\\' );
+			if ( isSlash_a != isSlash_b )
+			{
+				return false;
+			}
+			else if ( !isSlash_a && ( std::tolower( static_cast<unsigned char>( *i_path_a ) ) != std::tolower( static_cast<unsigned char>( *i_path_b ) ) ) )
+			{
+				return false;
+			}
+		}
+		return *i_path_a == *i_path_b;
+	}
+
+	void WriteUint16( const uint16_t i_value, std::vector<uint8_t>& io_data )
+	{
+		const uint8_t* const bytes = reinterpret_cast<const uint8_t*>( &i_value );
+		io_data.insert( io_data.end(), bytes, bytes + sizeof( i_value ) );
+	}
+
+	void WriteString( const std::string& i_value, std::vector<uint8_t>& io_data )
+	{
+		io_data.insert( io_data.end(), i_value.c_str(), i_value.c_str() + i_value.length() + 1 );
+	}
+
+	bool ReadUint16( const uint8_t*& io_position, const uint8_t* const i_end, uint16_t& o_value )
+	{
+		if ( ( i_end - io_position ) >= static_cast<ptrdiff_t>( sizeof( o_value ) ) )
+		{
+			std::memcpy( &o_value, io_position, sizeof( o_value ) );
+			io_position += sizeof( o_value );
+			return true;
+		}
+		return false;
+	}
+
+	bool ReadString( const uint8_t*& io_position, const uint8_t* const i_end, std::string& o_value )
+	{
+		const uint8_t* const terminator = static_cast<const uint8_t*>( std::memchr( io_position, '\0', i_end - io_position ) );
+		if ( terminator )
+		{
+			o_value.assign( reinterpret_cast<const char*>( io_position ), terminator - io_position );
+			io_position = terminator + 1;
+			return true;
+		}
+		return false;
+	}
+}
@@ -0,0 +1,72 @@
+/*
+	An atlas table says where each source image was packed by the AtlasBuilder
+
+	The AtlasBuilder writes the table as the built atlas asset
+	(and the atlas textures themselves next to it),
+	and other builders read it to use an image in the atlas instead of its own texture:
+		* The MaterialBuilder uses the atlas texture that the image is in
+		* The MeshBuilder moves texture coordinates into the image's rectangle
+
+	Rectangles are in texels with the origin at the top left of the atlas texture,
+	the same as the source images,
+	and so they can also be given to cSprite::GetTextureCoordinates().
+*/
+
+#ifndef EAE6320_ASSETBUILD_ATLASTABLE_H
+#define EAE6320_ASSETBUILD_ATLASTABLE_H
+
+// Header Files
+//=============
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Struct Declaration
+//===================
+
+namespace eae6320
+{
+	namespace AssetBuild
+	{
+		struct sAtlasTable
+		{
+			// A single atlas texture
+			struct sTexture
+			{
+				// The path that the game loads the texture from
+				// (relative to the built asset directory)
+				std::string builtRelativePath;
+				uint16_t width, height;
+			};
+			struct sImage
+			{
+				// The path that the image is referenced by in other assets
+				// (relative to the authored asset directory)
+				std::string sourceRelativePath;
+				uint16_t textureIndex;
+				uint16_t left, top, width, height;
+			};
+
+			std::vector<sTexture> textures;
+			std::vector<sImage> images;
+			// This is how many texels of each image's edge are copied around it.
+			// Every MIP level halves it, and so the AtlasBuilder only makes the levels where it is at least one texel
+			// (e.g. a gutter of 8 only protects the first 4 levels: 8, 4, 2, and 1 texels).
+			// A texture coordinate that is off by this many texels of the full size texture reads the neighboring image.
+			uint16_t gutter = 0;
+
+			// Paths are compared the same way as AssetBuildSystem.lua does
+			// (ignoring case and the kind of slash).
+			// Returns NULL if the image isn't in the atlas.
+			const sImage* FindImage( const char* const i_sourceRelativePath ) const;
+
+			bool Write( const char* const i_path, std::string* const o_errorMessage ) const;
+			// The atlas's source path is converted to its built path,
+			// and so the atlas must have already been built
+			bool LoadBuiltAtlas( const char* const i_atlasSourceRelativePath, std::string* const o_errorMessage );
+		};
+	}
+}
+
+#endif	// EAE6320_ASSETBUILD_ATLASTABLE_H
@@ -0,0 +1,48 @@
+/*
+	This file contains the image processing that is shared by the asset build tools that make textures
+	(the TextureBuilder makes a texture from a single source image,
+	and the AtlasBuilder makes textures from many source images)
+
+	The functions use DirectXTex,
+	and so a tool that uses them must initialize COM first
+	and link with the DirectXTex library.
+*/
+
+#ifndef EAE6320_ASSETBUILD_TEXTUREFUNCTIONS_H
+#define EAE6320_ASSETBUILD_TEXTUREFUNCTIONS_H
+
+// Header Files
+//=============
+
+#include <cstddef>
+
+// Forward Declarations
+//=====================
+
+namespace DirectX
+{
+	class ScratchImage;
+}
+
+// Interface
+//==========
+
+namespace eae6320
+{
+	namespace AssetBuild
+	{
+		// The image's format is chosen from the path's file extension
+		bool LoadSourceImage( const char* const i_path, DirectX::ScratchImage& o_image );
+		// Compressed source images are uncompressed to 8 bits per channel
+		bool UncompressSourceImage( const char* const i_path, DirectX::ScratchImage& io_sourceImageThatMayNotBeValidAfterThisCall,
+			DirectX::ScratchImage& o_image );
+		// The source image is flipped for the platform, given MIP maps, and compressed.
+		// If a MIP level count is given then only that many levels are generated
+		// (otherwise every possible level is).
+		bool BuildTexture( const char* const i_path, DirectX::ScratchImage& io_sourceImageThatMayNotBeValidAfterThisCall,
+			DirectX::ScratchImage& o_texture, const size_t i_mipLevelCount = 0 );
+		bool WriteTextureToFile( const char* const i_path, const DirectX::ScratchImage& i_texture );
+	}
+}
+
+#endif	// EAE6320_ASSETBUILD_TEXTUREFUNCTIONS_H
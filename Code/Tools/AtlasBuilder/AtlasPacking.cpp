@@ -0,0 +1,148 @@
+// Header Files
+//=============
+
+#include "AtlasPacking.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	// Packs as many of the rectangles as fit into a single texture of the given size.
+	// The packed rectangles are indexed the same as the sizes
+	// (only the ones that were packed are changed).
+	void PackShelves( const std::vector<eae6320::AssetBuild::sRectangleSize>& i_sizes, const std::vector<size_t>& i_order,
+		const unsigned int i_spacing, const unsigned int i_width, const unsigned int i_height,
+		std::vector<eae6320::AssetBuild::sPackedRectangle>& io_rectangles, std::vector<size_t>& o_notPacked,
+		eae6320::AssetBuild::sRectangleSize& o_usedSize );
+}
+
+// Interface
+//==========
+
+bool eae6320::AssetBuild::PackRectangles( const std::vector<sRectangleSize>& i_sizes, const unsigned int i_spacing, const unsigned int i_maxSize,
+	std::vector<sPackedRectangle>& o_rectangles, std::vector<sRectangleSize>& o_textureSizes )
+{
+	o_rectangles.resize( i_sizes.size() );
+	o_textureSizes.clear();
+
+	// Taller rectangles are packed first
+	std::vector<size_t> remaining;
+	for ( size_t i = 0; i < i_sizes.size(); ++i )
+	{
+		if ( ( i_sizes[i].width > i_maxSize ) || ( i_sizes[i].height > i_maxSize ) )
+		{
+			return false;
+		}
+		remaining.push_back( i );
+	}
+	std::sort( remaining.begin(), remaining.end(),
+		[&i_sizes]( const size_t i_lhs, const size_t i_rhs )
+		{
+			const sRectangleSize& lhs = i_sizes[i_lhs];
+			const sRectangleSize& rhs = i_sizes[i_rhs];
+			return ( lhs.height != rhs.height ) ? ( lhs.height > rhs.height )
+				: ( ( lhs.width != rhs.width ) ? ( lhs.width > rhs.width ) : ( i_lhs < i_rhs ) );
+		} );
+
+	std::vector<size_t> notPacked;
+	while ( !remaining.empty() )
+	{
+		const unsigned int textureIndex = static_cast<unsigned int>( o_textureSizes.size() );
+		// The first width that is tried would make a square if the rectangles fit perfectly
+		unsigned int width;
+		{
+			double area = 0.0;
+			unsigned int widestWidth = 0;
+			for ( const size_t index : remaining )
+			{
+				area += static_cast<double>( i_sizes[index].width + i_spacing ) * static_cast<double>( i_sizes[index].height + i_spacing );
+				widestWidth = std::max( widestWidth, i_sizes[index].width );
+			}
+			width = static_cast<unsigned int>( std::ceil( std::sqrt( area ) ) );
+			width = std::min( std::max( width, widestWidth ), i_maxSize );
+		}
+		sRectangleSize usedSize;
+		for ( ;; )
+		{
+			PackShelves( i_sizes, remaining, i_spacing, width, i_maxSize, o_rectangles, notPacked, usedSize );
+			if ( notPacked.empty() || ( width >= i_maxSize ) )
+			{
+				break;
+			}
+			width = std::min( width * 2, i_maxSize );
+		}
+		// Every rectangle fits by itself,
+		// and so there's always at least one in a new texture
+		for ( const size_t index : remaining )
+		{
+			if ( std::find( notPacked.begin(), notPacked.end(), index ) == notPacked.end() )
+			{
+				o_rectangles[index].textureIndex = textureIndex;
+			}
+		}
+		o_textureSizes.push_back( usedSize );
+		remaining.swap( notPacked );
+	}
+
+	return true;
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	void PackShelves( const std::vector<eae6320::AssetBuild::sRectangleSize>& i_sizes, const std::vector<size_t>& i_order,
+		const unsigned int i_spacing, const unsigned int i_width, const unsigned int i_height,
+		std::vector<eae6320::AssetBuild::sPackedRectangle>& io_rectangles, std::vector<size_t>& o_notPacked,
+		eae6320::AssetBuild::sRectangleSize& o_usedSize )
+	{
+		struct sShelf
+		{
+			unsigned int top, height;
+			// This is where the next rectangle on the shelf would go
+			unsigned int left;
+		};
+		std::vector<sShelf> shelves;
+		o_notPacked.clear();
+		o_usedSize.width = o_usedSize.height = 0;
+		for ( const size_t index : i_order )
+		{
+			const eae6320::AssetBuild::sRectangleSize& size = i_sizes[index];
+			sShelf* shelf = NULL;
+			for ( sShelf& existingShelf : shelves )
+			{
+				if ( ( size.height <= existingShelf.height ) && ( ( existingShelf.left + size.width ) <= i_width ) )
+				{
+					shelf = &existingShelf;
+					break;
+				}
+			}
+			if ( !shelf )
+			{
+				const unsigned int top = shelves.empty() ? 0 : ( shelves.back().top + shelves.back().height + i_spacing );
+				if ( ( top + size.height ) <= i_height )
+				{
+					const sShelf newShelf = { top, size.height, 0 };
+					shelves.push_back( newShelf );
+					shelf = &shelves.back();
+				}
+				else
+				{
+					o_notPacked.push_back( index );
+					continue;
+				}
+			}
+			io_rectangles[index].left = shelf->left;
+			io_rectangles[index].top = shelf->top;
+			shelf->left += size.width + i_spacing;
+			o_usedSize.width = std::max( o_usedSize.width, io_rectangles[index].left + size.width );
+			o_usedSize.height = std::max( o_usedSize.height, io_rectangles[index].top + size.height );
+		}
+	}
+}
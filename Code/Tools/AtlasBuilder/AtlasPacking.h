@@ -0,0 +1,49 @@
+/*
+	This file contains the bin packing that the atlas builder uses
+	to decide where each image goes
+
+	Rectangles are packed into horizontal shelves:
+	they are sorted from tallest to shortest,
+	and each one goes on the first shelf that has room for it
+	(a new shelf is started below the others if none do).
+	The width of each texture starts at what would be a square if the remaining rectangles fit perfectly
+	and is doubled until they all fit or it reaches the maximum size.
+	Rectangles that don't fit go in another texture.
+*/
+
+#ifndef EAE6320_ATLASPACKING_H
+#define EAE6320_ATLASPACKING_H
+
+// Header Files
+//=============
+
+#include <vector>
+
+// Interface
+//==========
+
+namespace eae6320
+{
+	namespace AssetBuild
+	{
+		struct sRectangleSize
+		{
+			unsigned int width, height;
+		};
+		struct sPackedRectangle
+		{
+			unsigned int textureIndex;
+			unsigned int left, top;
+		};
+
+		// The packed rectangles are in the same order as the sizes,
+		// and the texture sizes are just big enough to hold the rectangles that were packed in them.
+		// Rectangles that are next to each other have at least i_spacing between them
+		// (if every size and the spacing are multiples of something then so is every position).
+		// Returns false if a rectangle is bigger than the maximum size.
+		bool PackRectangles( const std::vector<sRectangleSize>& i_sizes, const unsigned int i_spacing, const unsigned int i_maxSize,
+			std::vector<sPackedRectangle>& o_rectangles, std::vector<sRectangleSize>& o_textureSizes );
+	}
+}
+
+#endif	// EAE6320_ATLASPACKING_H
@@ -0,0 +1,16 @@
+/*
+	The main() function is where the program starts execution
+*/
+
+// Header Files
+//=============
+
+#include "cAtlasBuilder.h"
+
+// Entry Point
+//============
+
+int main( int i_argumentCount, char** i_arguments )
+{
+	return eae6320::AssetBuild::Build<eae6320::AssetBuild::cAtlasBuilder>( i_arguments, i_argumentCount );
+}
@@ -0,0 +1,449 @@
+// Header Files
+//=============
+
+#include "cAtlasBuilder.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <utility>
+#include "AtlasPacking.h"
+#include "../../Engine/Math/Functions.h"
+#include "../../Engine/Platform/Platform.h"
+#include "../../External/DirectXTex/Includes.h"
+#include "../../External/Lua/Includes.h"
+#include "../AssetBuildLibrary/AtlasTable.h"
+#include "../AssetBuildLibrary/TextureFunctions.h"
+#include "../AssetBuildLibrary/UtilityFunctions.h"
+
+// Helper Class Declaration
+//=========================
+
+namespace
+{
+	struct sAtlasDescription
+	{
+		// These are relative to the authored asset directory
+		std::vector<std::string> imagePaths;
+		// This is how many copies of its edge texels are around each image.
+		// Each MIP level halves it, and so it also limits how many levels the atlas has:
+		// a gutter of 8 only protects the first 4 levels (8, 4, 2, and 1 texels),
+		// and anything further away than that samples the smallest of those instead of a smaller level
+		unsigned int gutter = 8;
+		// This is how much empty space is between the gutters of neighboring images
+		unsigned int padding = 0;
+		// No texture will be wider or taller than this
+		unsigned int maxSize = 2048;
+	};
+}
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	bool LoadAtlasDescription( const char* const i_path, sAtlasDescription& o_description );
+	bool LoadImagePaths( lua_State& io_luaState, const char* const i_path, std::vector<std::string>& o_imagePaths );
+	bool LoadSize( lua_State& io_luaState, const char* const i_key, const char* const i_path, unsigned int& io_size );
+	// The image is uncompressed and converted to 8 bits per channel
+	bool LoadAtlasImage( const char* const i_path, DirectX::ScratchImage& o_image );
+	// The image is copied to the top left of the rectangle
+	// and the rest of the rectangle is filled with copies of the image's closest texel
+	void CopyImageWithGutter( const DirectX::Image& i_image, const unsigned int i_gutter,
+		const unsigned int i_left, const unsigned int i_top, const unsigned int i_width, const unsigned int i_height, const DirectX::Image& io_texture );
+}
+
+// Inherited Implementation
+//=========================
+
+// Build
+//------
+
+bool eae6320::AssetBuild::cAtlasBuilder::Build( const std::vector<std::string>& )
+{
+	bool wereThereErrors = false;
+
+	sAtlasDescription description;
+	std::vector<DirectX::ScratchImage> images;
+	std::vector<sRectangleSize> rectangleSizes;
+	std::vector<sPackedRectangle> rectangles;
+	std::vector<sRectangleSize> textureSizes;
+	sAtlasTable atlasTable;
+	std::string path_authoredAssetDir, path_builtAssetDir, path_textures_relative;
+	// Each MIP level halves the gutter,
+	// and so only as many levels are made as there are while it is at least one texel wide
+	size_t mipLevelCount = 1;
+	unsigned int alignment = 4;
+	bool shouldComBeUninitialized = false;
+
+	// Load the description of the atlas
+	if ( !LoadAtlasDescription( m_path_source, description ) )
+	{
+		wereThereErrors = true;
+		goto OnExit;
+	}
+	while ( ( 1u << mipLevelCount ) <= description.gutter )
+	{
+		++mipLevelCount;
+	}
+	// A block at the smallest MIP level covers this many texels of the full size texture,
+	// and so if everything is aligned to this then no block or texel at any level is shared by two images
+	alignment = 4u << ( mipLevelCount - 1 );
+	// The MeshBuilder checks that texture coordinates moved into the atlas are precise enough for the gutter
+	atlasTable.gutter = static_cast<uint16_t>( description.gutter );
+	// The textures are written next to the table
+	{
+		std::string errorMessage;
+		if ( !Platform::GetEnvironmentVariable( "AuthoredAssetDir", path_authoredAssetDir, &errorMessage )
+			|| !Platform::GetEnvironmentVariable( "BuiltAssetDir", path_builtAssetDir, &errorMessage ) )
+		{
+			wereThereErrors = true;
+			OutputErrorMessage( errorMessage.c_str(), m_path_source );
+			goto OnExit;
+		}
+		const std::string path_target( m_path_target );
+		if ( path_target.compare( 0, path_builtAssetDir.length(), path_builtAssetDir ) != 0 )
+		{
+			wereThereErrors = true;
+			OutputErrorMessage( "The built atlas must be in the built asset directory", m_path_source );
+			goto OnExit;
+		}
+		// Everything after the last period is the extension
+		const size_t extensionPosition = path_target.find_last_of( '.' );
+		const size_t fileNamePosition = path_target.find_last_of( "/\\" );
+		path_textures_relative = path_target.substr( path_builtAssetDir.length(),
+			( ( extensionPosition != std::string::npos ) && ( ( fileNamePosition == std::string::npos ) || ( extensionPosition > fileNamePosition ) ) ?
+				extensionPosition : path_target.length() ) - path_builtAssetDir.length() );
+	}
+
+	// Initialize COM
+	{
+		void* const thisMustBeNull = NULL;
+		if ( SUCCEEDED( CoInitialize( thisMustBeNull ) ) )
+		{
+			shouldComBeUninitialized = true;
+		}
+		else
+		{
+			wereThereErrors = true;
+			OutputErrorMessage( "DirextXTex couldn't be used because COM couldn't be initialized", m_path_source );
+			goto OnExit;
+		}
+	}
+	// Load the source images
+	images.resize( description.imagePaths.size() );
+	for ( size_t i = 0; i < description.imagePaths.size(); ++i )
+	{
+		const std::string path = path_authoredAssetDir + description.imagePaths[i];
+		if ( !LoadAtlasImage( path.c_str(), images[i] ) )
+		{
+			wereThereErrors = true;
+			goto OnExit;
+		}
+		const DirectX::TexMetadata& metadata = images[i].GetMetadata();
+		const sRectangleSize rectangleSize =
+		{
+			Math::RoundUpToMultiple_powerOf2( static_cast<unsigned int>( metadata.width ) + ( description.gutter * 2 ), alignment ),
+			Math::RoundUpToMultiple_powerOf2( static_cast<unsigned int>( metadata.height ) + ( description.gutter * 2 ), alignment )
+		};
+		if ( ( rectangleSize.width > description.maxSize ) || ( rectangleSize.height > description.maxSize ) )
+		{
+			wereThereErrors = true;
+			std::ostringstream errorMessage;
+			errorMessage << description.imagePaths[i] << " is " << rectangleSize.width << "x" << rectangleSize.height
+				<< " with its gutter, which is bigger than the maximum size of " << description.maxSize;
+			OutputErrorMessage( errorMessage.str().c_str(), m_path_source );
+			goto OnExit;
+		}
+		rectangleSizes.push_back( rectangleSize );
+	}
+	// Decide where each image goes
+	if ( !PackRectangles( rectangleSizes, Math::RoundUpToMultiple_powerOf2( description.padding, alignment ), description.maxSize,
+		rectangles, textureSizes ) )
+	{
+		wereThereErrors = true;
+		OutputErrorMessage( "The images couldn't be packed", m_path_source );
+		goto OnExit;
+	}
+	// Build each texture
+	for ( size_t textureIndex = 0; textureIndex < textureSizes.size(); ++textureIndex )
+	{
+		std::string path_texture_relative;
+		{
+			std::ostringstream path;
+			path << path_textures_relative << "_" << textureIndex << ".dds";
+			path_texture_relative = path.str();
+		}
+		const std::string path_texture = path_builtAssetDir + path_texture_relative;
+		DirectX::ScratchImage texture;
+		{
+			const size_t arraySize = 1;
+			const size_t mipLevelCount_source = 1;
+			if ( FAILED( texture.Initialize2D( DXGI_FORMAT_R8G8B8A8_UNORM, textureSizes[textureIndex].width, textureSizes[textureIndex].height,
+				arraySize, mipLevelCount_source ) ) )
+			{
+				wereThereErrors = true;
+				OutputErrorMessage( "DirectXTex couldn't create an image for the atlas texture", path_texture.c_str() );
+				goto OnExit;
+			}
+			// Any space that isn't used by an image is opaque black
+			// (so that the texture can still be compressed without alpha if every image is opaque)
+			uint8_t* const pixels = texture.GetPixels();
+			const size_t pixelsSize = texture.GetPixelsSize();
+			for ( size_t i = 0; i < pixelsSize; i += 4 )
+			{
+				pixels[i + 0] = pixels[i + 1] = pixels[i + 2] = 0;
+				pixels[i + 3] = 0xff;
+			}
+		}
+		for ( size_t i = 0; i < rectangles.size(); ++i )
+		{
+			if ( rectangles[i].textureIndex == textureIndex )
+			{
+				const DirectX::Image& image = *images[i].GetImage( 0, 0, 0 );
+				CopyImageWithGutter( image, description.gutter, rectangles[i].left, rectangles[i].top,
+					rectangleSizes[i].width, rectangleSizes[i].height, *texture.GetImage( 0, 0, 0 ) );
+				const sAtlasTable::sImage atlasImage =
+				{
+					description.imagePaths[i],
+					static_cast<uint16_t>( textureIndex ),
+					static_cast<uint16_t>( rectangles[i].left + description.gutter ), static_cast<uint16_t>( rectangles[i].top + description.gutter ),
+					static_cast<uint16_t>( image.width ), static_cast<uint16_t>( image.height )
+				};
+				atlasTable.images.push_back( atlasImage );
+			}
+		}
+		DirectX::ScratchImage builtTexture;
+		if ( !BuildTexture( path_texture.c_str(), texture, builtTexture, mipLevelCount ) )
+		{
+			wereThereErrors = true;
+			goto OnExit;
+		}
+		if ( !WriteTextureToFile( path_texture.c_str(), builtTexture ) )
+		{
+			wereThereErrors = true;
+			goto OnExit;
+		}
+		const sAtlasTable::sTexture atlasTexture =
+		{
+			path_texture_relative,
+			static_cast<uint16_t>( textureSizes[textureIndex].width ), static_cast<uint16_t>( textureSizes[textureIndex].height )
+		};
+		atlasTable.textures.push_back( atlasTexture );
+		std::cout << m_path_source << ": Texture " << textureIndex << " is " << atlasTexture.width << "x" << atlasTexture.height
+			<< " with " << mipLevelCount << " MIP levels\n";
+	}
+	// Write the table
+	// (after the textures so that it is newer than all of them)
+	{
+		std::string errorMessage;
+		if ( !atlasTable.Write( m_path_target, &errorMessage ) )
+		{
+			wereThereErrors = true;
+			OutputErrorMessage( errorMessage.c_str(), m_path_target );
+			goto OnExit;
+		}
+	}
+
+OnExit:
+
+	// The images must be released before COM is uninitialized
+	images.clear();
+	if ( shouldComBeUninitialized )
+	{
+		CoUninitialize();
+	}
+
+	return !wereThereErrors;
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	bool LoadAtlasDescription( const char* const i_path, sAtlasDescription& o_description )
+	{
+		bool wereThereErrors = false;
+
+		lua_State* luaState = luaL_newstate();
+		if ( !luaState )
+		{
+			eae6320::AssetBuild::OutputErrorMessage( "Failed to create a new Lua state", i_path );
+			return false;
+		}
+		// Load and execute the file
+		{
+			const int luaResult = luaL_loadfile( luaState, i_path );
+			if ( luaResult != LUA_OK )
+			{
+				wereThereErrors = true;
+				eae6320::AssetBuild::OutputErrorMessage( lua_tostring( luaState, -1 ), i_path );
+				lua_pop( luaState, 1 );
+				goto OnExit;
+			}
+		}
+		{
+			const int argumentCount = 0;
+			const int returnValueCount = 1;
+			const int noErrorHandler = 0;
+			const int luaResult = lua_pcall( luaState, argumentCount, returnValueCount, noErrorHandler );
+			if ( luaResult != LUA_OK )
+			{
+				wereThereErrors = true;
+				eae6320::AssetBuild::OutputErrorMessage( lua_tostring( luaState, -1 ), i_path );
+				lua_pop( luaState, 1 );
+				goto OnExit;
+			}
+			if ( !lua_istable( luaState, -1 ) )
+			{
+				wereThereErrors = true;
+				std::ostringstream errorMessage;
+				errorMessage << "Asset files must return a table (instead of a " << luaL_typename( luaState, -1 ) << ")";
+				eae6320::AssetBuild::OutputErrorMessage( errorMessage.str().c_str(), i_path );
+				lua_pop( luaState, 1 );
+				goto OnExit;
+			}
+		}
+		// Load the values
+		if ( !LoadImagePaths( *luaState, i_path, o_description.imagePaths )
+			|| !LoadSize( *luaState, "gutter", i_path, o_description.gutter )
+			|| !LoadSize( *luaState, "padding", i_path, o_description.padding )
+			|| !LoadSize( *luaState, "maxSize", i_path, o_description.maxSize ) )
+		{
+			wereThereErrors = true;
+		}
+		// The table says how big textures are with 16 bits
+		else if ( ( o_description.maxSize == 0 ) || ( o_description.maxSize > 16384 ) )
+		{
+			wereThereErrors = true;
+			eae6320::AssetBuild::OutputErrorMessage( "The maximum size must be between 1 and 16384", i_path );
+		}
+		lua_pop( luaState, 1 );
+
+	OnExit:
+
+		lua_close( luaState );
+
+		return !wereThereErrors;
+	}
+
+	bool LoadImagePaths( lua_State& io_luaState, const char* const i_path, std::vector<std::string>& o_imagePaths )
+	{
+		bool wereThereErrors = false;
+
+		const char* const key = "images";
+		lua_pushstring( &io_luaState, key );
+		lua_gettable( &io_luaState, -2 );
+		if ( lua_istable( &io_luaState, -1 ) )
+		{
+			const int imageCount = static_cast<int>( luaL_len( &io_luaState, -1 ) );
+			for ( int i = 1; i <= imageCount; ++i )
+			{
+				lua_pushinteger( &io_luaState, i );
+				lua_gettable( &io_luaState, -2 );
+				if ( lua_type( &io_luaState, -1 ) == LUA_TSTRING )
+				{
+					o_imagePaths.push_back( lua_tostring( &io_luaState, -1 ) );
+				}
+				else
+				{
+					wereThereErrors = true;
+					std::ostringstream errorMessage;
+					errorMessage << "Image #" << i << " must be a path (instead of a " << luaL_typename( &io_luaState, -1 ) << ")";
+					eae6320::AssetBuild::OutputErrorMessage( errorMessage.str().c_str(), i_path );
+				}
+				lua_pop( &io_luaState, 1 );
+			}
+			if ( imageCount == 0 )
+			{
+				wereThereErrors = true;
+				eae6320::AssetBuild::OutputErrorMessage( "An atlas must have at least one image", i_path );
+			}
+		}
+		else
+		{
+			wereThereErrors = true;
+			std::ostringstream errorMessage;
+			errorMessage << "The value at \"" << key << "\" must be a table (instead of a " << luaL_typename( &io_luaState, -1 ) << ")";
+			eae6320::AssetBuild::OutputErrorMessage( errorMessage.str().c_str(), i_path );
+		}
+		lua_pop( &io_luaState, 1 );
+
+		return !wereThereErrors;
+	}
+
+	bool LoadSize( lua_State& io_luaState, const char* const i_key, const char* const i_path, unsigned int& io_size )
+	{
+		bool wereThereErrors = false;
+
+		lua_pushstring( &io_luaState, i_key );
+		lua_gettable( &io_luaState, -2 );
+		// The value is optional
+		if ( !lua_isnil( &io_luaState, -1 ) )
+		{
+			int isInteger;
+			const lua_Integer size = lua_tointegerx( &io_luaState, -1, &isInteger );
+			if ( isInteger && ( size >= 0 ) && ( size <= 0xffff ) )
+			{
+				io_size = static_cast<unsigned int>( size );
+			}
+			else
+			{
+				wereThereErrors = true;
+				std::ostringstream errorMessage;
+				errorMessage << "The value at \"" << i_key << "\" must be a whole number of texels";
+				eae6320::AssetBuild::OutputErrorMessage( errorMessage.str().c_str(), i_path );
+			}
+		}
+		lua_pop( &io_luaState, 1 );
+
+		return !wereThereErrors;
+	}
+
+	bool LoadAtlasImage( const char* const i_path, DirectX::ScratchImage& o_image )
+	{
+		DirectX::ScratchImage sourceImage, uncompressedImage;
+		if ( !eae6320::AssetBuild::LoadSourceImage( i_path, sourceImage )
+			|| !eae6320::AssetBuild::UncompressSourceImage( i_path, sourceImage, uncompressedImage ) )
+		{
+			return false;
+		}
+		const DXGI_FORMAT format = DXGI_FORMAT_R8G8B8A8_UNORM;
+		if ( uncompressedImage.GetMetadata().format != format )
+		{
+			const DWORD useDefaultFiltering = DirectX::TEX_FILTER_DEFAULT;
+			const float useDefaultThreshold = DirectX::TEX_THRESHOLD_DEFAULT;
+			if ( FAILED( DirectX::Convert( *uncompressedImage.GetImage( 0, 0, 0 ), format, useDefaultFiltering, useDefaultThreshold, o_image ) ) )
+			{
+				eae6320::AssetBuild::OutputErrorMessage( "DirectXTex failed to convert the image to 8 bits per channel", i_path );
+				return false;
+			}
+		}
+		else
+		{
+			o_image = std::move( uncompressedImage );
+		}
+		return true;
+	}
+
+	void CopyImageWithGutter( const DirectX::Image& i_image, const unsigned int i_gutter,
+		const unsigned int i_left, const unsigned int i_top, const unsigned int i_width, const unsigned int i_height, const DirectX::Image& io_texture )
+	{
+		const size_t bytesPerTexel = 4;
+		for ( unsigned int y = 0; y < i_height; ++y )
+		{
+			const size_t y_image = static_cast<size_t>( std::min( std::max( static_cast<int>( y ) - static_cast<int>( i_gutter ), 0 ),
+				static_cast<int>( i_image.height ) - 1 ) );
+			const uint8_t* const row_image = i_image.pixels + ( y_image * i_image.rowPitch );
+			uint8_t* const row_texture = io_texture.pixels + ( ( i_top + y ) * io_texture.rowPitch ) + ( i_left * bytesPerTexel );
+			for ( unsigned int x = 0; x < i_width; ++x )
+			{
+				const size_t x_image = static_cast<size_t>( std::min( std::max( static_cast<int>( x ) - static_cast<int>( i_gutter ), 0 ),
+					static_cast<int>( i_image.width ) - 1 ) );
+				std::memcpy( row_texture + ( x * bytesPerTexel ), row_image + ( x_image * bytesPerTexel ), bytesPerTexel );
+			}
+		}
+	}
+}
@@ -0,0 +1,47 @@
+/*
+	This class packs many source images into as few hardware-ready DDS textures as it can
+	so that materials that use different images can still share a texture
+
+	The source is a Lua file that lists the images
+	(and optionally how the images are separated and how big a texture can be),
+	and the target is an atlas table (see AtlasTable.h) that says where each image went.
+	The textures are written next to the target with the same name followed by their index.
+
+	Each image is surrounded by a gutter of copies of its edge texels
+	so that filtering near its edges doesn't blend in the neighboring images.
+	Every image's rectangle (including its gutter) is aligned to a multiple of the block size at the smallest MIP level
+	and only as many MIP levels are made as the gutter is wide enough for,
+	and so the neighboring images aren't blended in at any MIP level or by block compression.
+*/
+
+#ifndef EAE6320_CATLASBUILDER_H
+#define EAE6320_CATLASBUILDER_H
+
+// Header Files
+//=============
+
+#include "../AssetBuildLibrary/cbBuilder.h"
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+	namespace AssetBuild
+	{
+		class cAtlasBuilder : public cbBuilder
+		{
+			// Inherited Implementation
+			//=========================
+
+		private:
+
+			// Build
+			//------
+
+			virtual bool Build( const std::vector<std::string>& i_arguments );
+		};
+	}
+}
+
+#endif	// EAE6320_CATLASBUILDER_H
@@ -1,4 +1,5 @@
 #include "cMaterialBuilder.h"
+#include "../../Tools/AssetBuildLibrary/AtlasTable.h"
 #include "../../Tools/AssetBuildLibrary/UtilityFunctions.h"
 #include "../../External/Lua/Includes.h"
 #include "../../Engine/Graphics/ConstantBufferData.h"
@@ -11,6 +12,8 @@ namespace
 	eae6320::Graphics::sMaterial* materialInfo;
 	char* effectFilePath;
 	char* textureFilePath = "textures/default.dds";
+	// If the texture is in an atlas then the atlas's texture is used instead
+	std::string atlasFilePath;
 	bool LoadLuaFile(const char* const i_path);
 	bool LoadTableValues(lua_State& io_luaState);
 	bool LoadConstantData(lua_State& io_luaState);
@@ -18,6 +21,7 @@ namespace
 	bool LoadColorValues(lua_State& io_luaState);
 	bool LoadEffectsPath(lua_State& io_luaState);
 	bool LoadTexturePath(lua_State& io_luaState);
+	bool LoadAtlasPath(lua_State& io_luaState);
 }
 
 bool eae6320::AssetBuild::cMaterialBuilder::Build(const std::vector<std::string>&)
@@ -45,7 +49,32 @@ bool eae6320::AssetBuild::cMaterialBuilder::Build(const std::vector<std::string>
 
 		std::string builtTexturePath;
 		std::cout << " Texture Path " << textureFilePath << "\n";
-		eae6320::AssetBuild::ConvertSourceRelativePathToBuiltRelativePath(textureFilePath, "textures", builtTexturePath, &errormessage);
+		if (atlasFilePath.empty())
+		{
+			eae6320::AssetBuild::ConvertSourceRelativePathToBuiltRelativePath(textureFilePath, "textures", builtTexturePath, &errormessage);
+		}
+		else
+		{
+			// Every material that uses an image in the same atlas texture shares that texture,
+			// and the texture coordinates of the meshes that use the material are moved by the MeshBuilder
+			eae6320::AssetBuild::sAtlasTable atlasTable;
+			if (!atlasTable.LoadBuiltAtlas(atlasFilePath.c_str(), &errormessage))
+			{
+				outputBinMaterial.close();
+				eae6320::AssetBuild::OutputErrorMessage(errormessage.c_str(), m_path_source);
+				return false;
+			}
+			const eae6320::AssetBuild::sAtlasTable::sImage* const image = atlasTable.FindImage(textureFilePath);
+			if (!image)
+			{
+				outputBinMaterial.close();
+				std::ostringstream errorMessage;
+				errorMessage << "The texture " << textureFilePath << " isn't in the atlas " << atlasFilePath;
+				eae6320::AssetBuild::OutputErrorMessage(errorMessage.str().c_str(), m_path_source);
+				return false;
+			}
+			builtTexturePath = atlasTable.textures[image->textureIndex].builtRelativePath;
+		}
 		builtTexturePath = "data/" + builtTexturePath;
 		std::cout << " Built Texture Path " << builtTexturePath<<"\n";
 		outputBinMaterial.write(builtTexturePath.c_str(), std::strlen(builtTexturePath.c_str()));
@@ -156,6 +185,10 @@ namespace
 		{
 			return false;
 		}
+		if (!LoadAtlasPath(io_luaState))
+		{
+			return false;
+		}
 		return true;
 	}
 
@@ -312,4 +345,29 @@ namespace
 	OnExit:
 		return !wereThereErrors;
 	}
+
+	bool LoadAtlasPath(lua_State& io_luaState)
+	{
+		bool wereThereErrors = false;
+		const char* const key = "atlasPath";
+		lua_pushstring(&io_luaState, key);
+		lua_gettable(&io_luaState, -2);
+		if (lua_isnil(&io_luaState, -1))
+		{
+			goto OnExit;
+		}
+		if (lua_type(&io_luaState, -1) != LUA_TSTRING)
+		{
+			wereThereErrors = true;
+			std::stringstream errorMessage;
+			errorMessage << "The value at \"" << key << "\" must be a string instead of a " <<
+				luaL_typename(&io_luaState, -1) << "\n";
+			eae6320::AssetBuild::OutputErrorMessage(errorMessage.str().c_str());
+			goto OnExit;
+		}
+		atlasFilePath = lua_tostring(&io_luaState, -1);
+	OnExit:
+		lua_pop(&io_luaState, 1);
+		return !wereThereErrors;
+	}
 }
\ No newline at end of file
@@ -27,6 +27,7 @@
 #include <vector>
 #include<cfloat>
 #include"../../Engine/Math/cVector.h"
+#include "../../Engine/Math/BoundingVolumes.h"
 
 // Vertex Definition
 //==================
@@ -227,7 +228,6 @@ namespace
 		std::vector<MObject>& io_shadingGroups, std::map<std::string, size_t>& io_map_shadingGroupNamesToIndices);
 	void CreateOctTreeNode(sNode** o_node, sVector& center, float i_width, size_t i_depth = 0);
 	void AddTriangleToNode(sNode* i_node, const sVector& a, const sVector& b, const sVector& c, uint16_t tri_index);
-	bool triBoxOverlap(float boxcenter[3], const float boxhalfsize, float triverts[3][3]);
 	void GetBiggestVertexPointVal(std::vector<sVertexInfo>& vertexBuffer, float & MaxV, float &MinV);
 	void WriteOutNode(sNode& i_node, std::ofstream& fout);
 	MStatus WriteOctreeToFile(const MString& i_fileName, sNode* root);
@@ -897,25 +897,11 @@ namespace
 
 	void AddTriangleToNode(sNode * i_node, const sVector & a, const sVector & b, const sVector & c, uint16_t tri_index)
 	{
-		float boxcenter[3];
-		boxcenter[0] = i_node->m_cube.m_center.x;
-		boxcenter[1] = i_node->m_cube.m_center.y;
-		boxcenter[2] = i_node->m_cube.m_center.z;
-		float trivertex[3][3];
-
-		trivertex[0][0] = a.x;
-		trivertex[0][1] = a.y;
-		trivertex[0][2] = a.z;
-
-		trivertex[1][0] = b.x;
-		trivertex[1][1] = b.y;
-		trivertex[1][2] = b.z;
-
-		trivertex[2][0] = c.x;
-		trivertex[2][1] = c.y;
-		trivertex[2][2] = c.z;
-
-		if (triBoxOverlap(boxcenter, i_node->m_cube.m_width / 2.0f, trivertex)) {
+		const float halfWidth = i_node->m_cube.m_width / 2.0f;
+		const eae6320::Math::sAABB box = eae6320::Math::sAABB::CreateFromCenterAndHalfExtents(
+			eae6320::Math::cVector(i_node->m_cube.m_center.x, i_node->m_cube.m_center.y, i_node->m_cube.m_center.z),
+			eae6320::Math::cVector(halfWidth, halfWidth, halfWidth));
+		if (eae6320::Math::Overlaps(box, eae6320::Math::cVector(a.x, a.y, a.z), eae6320::Math::cVector(b.x, b.y, b.z), eae6320::Math::cVector(c.x, c.y, c.z))) {
 			const float MAX_DEPTH = 3;
 			if (i_node->m_depth == MAX_DEPTH) {
 				i_node->m_triangles.push_back(tri_index);
@@ -1030,173 +1016,4 @@ namespace
 
 		return MStatus::kSuccess;
 	}
-}
-
-#define X 0
-#define Y 1
-#define Z 2
-#define DOT(v1,v2) (v1[0]*v2[0]+v1[1]*v2[1]+v1[2]*v2[2])
-
-inline void SUB(float* dest, const float v1[3], const float v2[3]) {
-	dest[0] = v1[0] - v2[0];
-	dest[1] = v1[1] - v2[1];
-	dest[2] = v1[2] - v2[2];
-}
-
-inline void CROSS(float *dest, const float v1[3], const float v2[3]) {
-	dest[0] = v1[1] * v2[2] - v1[2] * v2[1];
-	dest[1] = v1[2] * v2[0] - v1[0] * v2[2];
-	dest[2] = v1[0] * v2[1] - v1[1] * v2[0];
-}
-
-inline void FINDMINMAX(const float i_x0, const float i_x1, const float i_x2, float*o_min, float * o_max) {
-	*o_min = *o_max = i_x0;
-	if (i_x1 < *o_min)
-		*o_min = i_x1;
-	if (i_x1 > *o_max)
-		*o_max = i_x1;
-	if (i_x2 < *o_min)
-		*o_min = i_x2;
-	if (i_x2 > *o_max)
-		*o_max = i_x2;
-}
-
-int planeBoxOverlap(float normal[3], float vert[3], float maxbox)
-{
-	int q;
-	float vmin[3], vmax[3], v;
-	for (q = X; q <= Z; q++)
-	{
-		v = vert[q];
-		if (normal[q]>0.0f)
-		{
-			vmin[q] = -maxbox - v;
-			vmax[q] = maxbox - v;
-		}
-		else
-		{
-			vmin[q] = maxbox - v;	
-			vmax[q] = -maxbox - v;	
-		}
-	}
-	if (DOT(normal, vmin)>0.0f) return 0;	
-	if (DOT(normal, vmax) >= 0.0f) return 1;	
-	return 0;
-
-}
-
-inline int  AXISTEST_X01(const float a, const float  b, const float fa, const float  fb,
-	const float v0[3], const float v1[3], const float v2[3], const float box_half_size,
-	float & min, float & max, float & p0, float & p2, float & rad) {
-	p0 = a*v0[Y] - b*v0[Z];
-	p2 = a*v2[Y] - b*v2[Z];
-	if (p0 < p2) { min = p0; max = p2; }
-	else { min = p2; max = p0; }
-	rad = fa * box_half_size + fb * box_half_size;
-	if (min > rad || max < -rad) return 0;
-	return 1;
-}
-
-inline int AXISTEST_X2(const float a, const float  b, const float fa, const float  fb,
-	const float v0[3], const float v1[3], const float v2[3], const float box_half_size,
-	float & min, float & max, float & p0, float & p1, float & rad) {
-	p0 = a*v0[Y] - b*v0[Z];
-	p1 = a*v1[Y] - b*v1[Z];
-	if (p0 < p1) { min = p0; max = p1; }
-	else { min = p1; max = p0; }
-	rad = fa * box_half_size + fb * box_half_size;
-	if (min > rad || max < -rad) return 0;
-	return 1;
-}
-
-inline int AXISTEST_Y02(const float a, const float  b, const float fa, const float  fb,
-	const float v0[3], const float v1[3], const float v2[3], const float box_half_size,
-	float & min, float & max, float & p0, float & p2, float & rad) {
-	p0 = -a*v0[X] + b*v0[Z];
-	p2 = -a*v2[X] + b*v2[Z];
-	if (p0 < p2) { min = p0; max = p2; }
-	else { min = p2; max = p0; }
-	rad = fa * box_half_size + fb * box_half_size;
-	if (min > rad || max < -rad) return 0;
-	return 1;
-}
-
-inline int AXISTEST_Y1(const float a, const float  b, const float fa, const float  fb,
-	const float v0[3], const float v1[3], const float v2[3], const float box_half_size,
-	float & min, float & max, float & p0, float & p1, float & rad) {
-	p0 = -a*v0[X] + b*v0[Z];
-	p1 = -a*v1[X] + b*v1[Z];
-	if (p0 < p1) { min = p0; max = p1; }
-	else { min = p1; max = p0; }
-	rad = fa * box_half_size + fb * box_half_size;
-	if (min > rad || max < -rad) return 0;
-	return 1;
-}
-
-inline int AXISTEST_Z12(const float a, const float  b, const float fa, const float  fb,
-	const float v0[3], const float v1[3], const float v2[3], const float box_half_size,
-	float & min, float & max, float & p1, float & p2, float & rad) {
-	p1 = a*v1[X] - b*v1[Y];
-	p2 = a*v2[X] - b*v2[Y];
-	if (p2 < p1) { min = p2; max = p1; }
-	else { min = p1; max = p2; }
-	rad = fa * box_half_size + fb * box_half_size;
-	if (min > rad || max < -rad) return 0;
-	return 1;
-}
-
-inline int AXISTEST_Z0(const float a, const float  b, const float fa, const float  fb,
-	const float v0[3], const float v1[3], const float v2[3], const float box_half_size,
-	float & min, float & max, float & p0, float & p1, float & rad) {
-	p0 = a*v0[X] - b*v0[Y];
-	p1 = a*v1[X] - b*v1[Y];
-	if (p0 < p1) { min = p0; max = p1; }
-	else { min = p1; max = p0; }
-	rad = fa * box_half_size + fb *box_half_size;
-	if (min > rad || max < -rad) return 0;
-	return 1;
-}
-
-namespace {
-	bool triBoxOverlap(float boxcenter[3], const float boxhalfsize, float triverts[3][3])
-	{
-		float v0[3], v1[3], v2[3];
-		float min, max, p0, p1, p2, rad, fex, fey, fez;	
-		float normal[3], e0[3], e1[3], e2[3];
-		SUB(v0, triverts[0], boxcenter);
-		SUB(v1, triverts[1], boxcenter);
-		SUB(v2, triverts[2], boxcenter);
-		SUB(e0, v1, v0);  
-		SUB(e1, v2, v1);  
-		SUB(e2, v0, v2);  
-
-		fex = fabsf(e0[X]);
-		fey = fabsf(e0[Y]);
-		fez = fabsf(e0[Z]);
-		AXISTEST_X01(e0[Z], e0[Y], fez, fey, v0, v1, v2, boxhalfsize, min, max, p0, p2, rad);
-		AXISTEST_Y02(e0[Z], e0[X], fez, fex, v0, v1, v2, boxhalfsize, min, max, p0, p2, rad);
-		AXISTEST_Z12(e0[Y], e0[X], fey, fex, v0, v1, v2, boxhalfsize, min, max, p1, p2, rad);
-		
-		fex = fabsf(e1[X]);
-		fey = fabsf(e1[Y]);
-		fez = fabsf(e1[Z]);
-		AXISTEST_X01(e1[Z], e1[Y], fez, fey, v0, v1, v2, boxhalfsize, min, max, p0, p2, rad);
-		AXISTEST_Y02(e1[Z], e1[X], fez, fex, v0, v1, v2, boxhalfsize, min, max, p0, p2, rad);
-		AXISTEST_Z0(e1[Y], e1[X], fey, fex, v0, v1, v2, boxhalfsize, min, max, p0, p1, rad);
-		fex = fabsf(e2[X]);
-		fey = fabsf(e2[Y]);
-		fez = fabsf(e2[Z]);
-		AXISTEST_X2(e2[Z], e2[Y], fez, fey, v0, v1, v2, boxhalfsize, min, max, p0, p1, rad);
-		AXISTEST_Y1(e2[Z], e2[X], fez, fex, v0, v1, v2, boxhalfsize, min, max, p0, p1, rad);
-		AXISTEST_Z12(e2[Y], e2[X], fey, fex, v0, v1, v2, boxhalfsize, min, max, p1, p2, rad);
-		FINDMINMAX(v0[X], v1[X], v2[X], &min, &max);
-		if (min > boxhalfsize || max < -boxhalfsize) return 0;
-		FINDMINMAX(v0[Y], v1[Y], v2[Y], &min, &max);
-		if (min > boxhalfsize || max < -boxhalfsize) return 0;
-		FINDMINMAX(v0[Z], v1[Z], v2[Z], &min, &max);
-		if (min > boxhalfsize || max < -boxhalfsize) return 0;
-		CROSS(normal, e0, e1);
-		if (!planeBoxOverlap(normal, v0, boxhalfsize)) return 0;
-		return 1; 
-	}
 }
\ No newline at end of file
@@ -0,0 +1,316 @@
+// Header Files
+//=============
+
+#include "MeshOptimization.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	// Finds the triangles that use each vertex:
+	// The triangles of vertex i are o_vertexTriangles[o_triangleOffsets[i]] up to o_vertexTriangles[o_triangleOffsets[i + 1]]
+	void FindVertexTriangles( const uint32_t* const i_indices, const size_t i_indexCount, const uint32_t i_vertexCount,
+		std::vector<uint32_t>& o_triangleOffsets, std::vector<uint32_t>& o_vertexTriangles );
+}
+
+// Interface
+//==========
+
+eae6320::AssetBuild::sVertexCacheStatistics eae6320::AssetBuild::AnalyzeVertexCache(
+	const uint32_t* const i_indices, const size_t i_indexCount, const uint32_t i_vertexCount )
+{
+	sVertexCacheStatistics statistics = { 0.0f, 0.0f };
+	if ( i_indexCount == 0 )
+	{
+		return statistics;
+	}
+
+	// A vertex is in the FIFO cache if fewer than the cache size of other vertices have missed since it did
+	std::vector<size_t> missTimes( i_vertexCount, 0 );
+	size_t missCount = 0;
+	size_t usedVertexCount = 0;
+	for ( size_t i = 0; i < i_indexCount; ++i )
+	{
+		const uint32_t vertex = i_indices[i];
+		if ( missTimes[vertex] == 0 )
+		{
+			++usedVertexCount;
+		}
+		else if ( ( missCount - missTimes[vertex] ) < s_vertexCacheSize )
+		{
+			continue;
+		}
+		++missCount;
+		missTimes[vertex] = missCount;
+	}
+
+	statistics.acmr = static_cast<float>( missCount ) / static_cast<float>( i_indexCount / 3 );
+	statistics.atvr = static_cast<float>( missCount ) / static_cast<float>( usedVertexCount );
+	return statistics;
+}
+
+void eae6320::AssetBuild::OptimizeVertexCache( uint32_t* const io_indices, const size_t i_indexCount, const uint32_t i_vertexCount,
+	std::vector<size_t>* const o_clusterOffsets )
+{
+	if ( o_clusterOffsets )
+	{
+		o_clusterOffsets->clear();
+	}
+	if ( i_indexCount == 0 )
+	{
+		return;
+	}
+
+	std::vector<uint32_t> triangleOffsets, vertexTriangles;
+	FindVertexTriangles( io_indices, i_indexCount, i_vertexCount, triangleOffsets, vertexTriangles );
+	// The number of triangles that use each vertex and haven't been added yet
+	std::vector<uint32_t> liveTriangleCounts( i_vertexCount );
+	for ( uint32_t i = 0; i < i_vertexCount; ++i )
+	{
+		liveTriangleCounts[i] = triangleOffsets[i + 1] - triangleOffsets[i];
+	}
+	// A vertex is in the cache if fewer than the cache size of other vertices have missed since it did
+	// (every time starts old enough to not be in the cache)
+	std::vector<uint32_t> cacheTimes( i_vertexCount, 0 );
+	uint32_t time = s_vertexCacheSize + 1;
+	std::vector<bool> wasTriangleAdded( i_indexCount / 3, false );
+	// Vertices that were recently used are remembered so that there is somewhere nearby to go
+	// when there are no more triangles around the current vertex
+	std::vector<uint32_t> deadEndStack;
+	uint32_t cursor = 0;
+	std::vector<uint32_t> candidates;
+
+	std::vector<uint32_t> indices;
+	indices.reserve( i_indexCount );
+	const uint32_t noVertex = std::numeric_limits<uint32_t>::max();
+	uint32_t fanningVertex = noVertex;
+	do
+	{
+		if ( fanningVertex == noVertex )
+		{
+			// Start a new cluster from a vertex that was used recently,
+			// or if there aren't any then from the next vertex in the original order
+			while ( !deadEndStack.empty() && ( fanningVertex == noVertex ) )
+			{
+				const uint32_t vertex = deadEndStack.back();
+				deadEndStack.pop_back();
+				if ( liveTriangleCounts[vertex] > 0 )
+				{
+					fanningVertex = vertex;
+				}
+			}
+			while ( ( cursor < i_vertexCount ) && ( fanningVertex == noVertex ) )
+			{
+				if ( liveTriangleCounts[cursor] > 0 )
+				{
+					fanningVertex = cursor;
+				}
+				++cursor;
+			}
+			if ( fanningVertex == noVertex )
+			{
+				break;
+			}
+			if ( o_clusterOffsets )
+			{
+				o_clusterOffsets->push_back( indices.size() );
+			}
+		}
+
+		// Add every remaining triangle around the fanning vertex
+		candidates.clear();
+		for ( uint32_t i = triangleOffsets[fanningVertex]; i < triangleOffsets[fanningVertex + 1]; ++i )
+		{
+			const uint32_t triangle = vertexTriangles[i];
+			if ( !wasTriangleAdded[triangle] )
+			{
+				wasTriangleAdded[triangle] = true;
+				for ( unsigned int j = 0; j < 3; ++j )
+				{
+					const uint32_t vertex = io_indices[( triangle * 3 ) + j];
+					indices.push_back( vertex );
+					deadEndStack.push_back( vertex );
+					candidates.push_back( vertex );
+					--liveTriangleCounts[vertex];
+					if ( ( time - cacheTimes[vertex] ) > s_vertexCacheSize )
+					{
+						cacheTimes[vertex] = time;
+						++time;
+					}
+				}
+			}
+		}
+
+		// The next fanning vertex is the oldest one in the cache
+		// that will still be in the cache after all of its triangles have been added
+		fanningVertex = noVertex;
+		uint32_t bestPriority = 0;
+		for ( const uint32_t vertex : candidates )
+		{
+			if ( liveTriangleCounts[vertex] > 0 )
+			{
+				uint32_t priority = 0;
+				if ( ( ( time - cacheTimes[vertex] ) + ( 2 * liveTriangleCounts[vertex] ) ) <= s_vertexCacheSize )
+				{
+					priority = time - cacheTimes[vertex];
+				}
+				if ( ( fanningVertex == noVertex ) || ( priority > bestPriority ) )
+				{
+					fanningVertex = vertex;
+					bestPriority = priority;
+				}
+			}
+		}
+	} while ( indices.size() < i_indexCount );
+
+	std::copy( indices.begin(), indices.end(), io_indices );
+}
+
+void eae6320::AssetBuild::OptimizeOverdraw( const Graphics::sVertex* const i_vertices, uint32_t* const io_indices, const size_t i_indexCount,
+	const std::vector<size_t>& i_clusterOffsets )
+{
+	const size_t clusterCount = i_clusterOffsets.size();
+	if ( clusterCount < 2 )
+	{
+		return;
+	}
+
+	// Each cluster's area-weighted center and normal are found,
+	// and the whole mesh's center is the area-weighted center of all of them
+	struct sCluster
+	{
+		double center[3];
+		double normal[3];
+		double area;
+		double sortKey;
+		size_t firstIndex, indexCount;
+	};
+	std::vector<sCluster> clusters( clusterCount );
+	double meshCenter[3] = { 0.0, 0.0, 0.0 };
+	double meshArea = 0.0;
+	for ( size_t i = 0; i < clusterCount; ++i )
+	{
+		sCluster& cluster = clusters[i];
+		cluster.firstIndex = i_clusterOffsets[i];
+		cluster.indexCount = ( ( ( i + 1 ) < clusterCount ) ? i_clusterOffsets[i + 1] : i_indexCount ) - cluster.firstIndex;
+		cluster.center[0] = cluster.center[1] = cluster.center[2] = 0.0;
+		cluster.normal[0] = cluster.normal[1] = cluster.normal[2] = 0.0;
+		cluster.area = 0.0;
+		for ( size_t j = cluster.firstIndex; j < ( cluster.firstIndex + cluster.indexCount ); j += 3 )
+		{
+			const Graphics::sVertex& vertex0 = i_vertices[io_indices[j + 0]];
+			const Graphics::sVertex& vertex1 = i_vertices[io_indices[j + 1]];
+			const Graphics::sVertex& vertex2 = i_vertices[io_indices[j + 2]];
+			const double edge0[3] = { vertex1.x - vertex0.x, vertex1.y - vertex0.y, vertex1.z - vertex0.z };
+			const double edge1[3] = { vertex2.x - vertex0.x, vertex2.y - vertex0.y, vertex2.z - vertex0.z };
+			const double normal[3] =
+			{
+				( edge0[1] * edge1[2] ) - ( edge0[2] * edge1[1] ),
+				( edge0[2] * edge1[0] ) - ( edge0[0] * edge1[2] ),
+				( edge0[0] * edge1[1] ) - ( edge0[1] * edge1[0] )
+			};
+			const double area = std::sqrt( ( normal[0] * normal[0] ) + ( normal[1] * normal[1] ) + ( normal[2] * normal[2] ) );
+			cluster.center[0] += area * ( vertex0.x + vertex1.x + vertex2.x ) / 3.0;
+			cluster.center[1] += area * ( vertex0.y + vertex1.y + vertex2.y ) / 3.0;
+			cluster.center[2] += area * ( vertex0.z + vertex1.z + vertex2.z ) / 3.0;
+			cluster.normal[0] += normal[0];
+			cluster.normal[1] += normal[1];
+			cluster.normal[2] += normal[2];
+			cluster.area += area;
+		}
+		for ( unsigned int k = 0; k < 3; ++k )
+		{
+			meshCenter[k] += cluster.center[k];
+		}
+		meshArea += cluster.area;
+		if ( cluster.area > 0.0 )
+		{
+			for ( unsigned int k = 0; k < 3; ++k )
+			{
+				cluster.center[k] /= cluster.area;
+			}
+		}
+	}
+	if ( meshArea > 0.0 )
+	{
+		for ( unsigned int k = 0; k < 3; ++k )
+		{
+			meshCenter[k] /= meshArea;
+		}
+	}
+
+	// The more a cluster faces away from the center of the mesh the more likely it is to hide other clusters
+	// (and the less likely it is to be hidden by them)
+	for ( sCluster& cluster : clusters )
+	{
+		const double normalLength = std::sqrt(
+			( cluster.normal[0] * cluster.normal[0] ) + ( cluster.normal[1] * cluster.normal[1] ) + ( cluster.normal[2] * cluster.normal[2] ) );
+		cluster.sortKey = 0.0;
+		if ( normalLength > 0.0 )
+		{
+			for ( unsigned int k = 0; k < 3; ++k )
+			{
+				cluster.sortKey += ( cluster.center[k] - meshCenter[k] ) * cluster.normal[k] / normalLength;
+			}
+		}
+	}
+	std::stable_sort( clusters.begin(), clusters.end(),
+		[]( const sCluster& i_lhs, const sCluster& i_rhs ) { return i_lhs.sortKey > i_rhs.sortKey; } );
+
+	std::vector<uint32_t> indices;
+	indices.reserve( i_indexCount );
+	for ( const sCluster& cluster : clusters )
+	{
+		indices.insert( indices.end(), io_indices + cluster.firstIndex, io_indices + cluster.firstIndex + cluster.indexCount );
+	}
+	std::copy( indices.begin(), indices.end(), io_indices );
+}
+
+void eae6320::AssetBuild::OptimizeVertexFetch( std::vector<Graphics::sVertex>& io_vertices, std::vector<uint32_t>& io_indices )
+{
+	const uint32_t noVertex = std::numeric_limits<uint32_t>::max();
+	std::vector<uint32_t> remap( io_vertices.size(), noVertex );
+	std::vector<Graphics::sVertex> vertices;
+	vertices.reserve( io_vertices.size() );
+	for ( uint32_t& index : io_indices )
+	{
+		if ( remap[index] == noVertex )
+		{
+			remap[index] = static_cast<uint32_t>( vertices.size() );
+			vertices.push_back( io_vertices[index] );
+		}
+		index = remap[index];
+	}
+	io_vertices.swap( vertices );
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	void FindVertexTriangles( const uint32_t* const i_indices, const size_t i_indexCount, const uint32_t i_vertexCount,
+		std::vector<uint32_t>& o_triangleOffsets, std::vector<uint32_t>& o_vertexTriangles )
+	{
+		o_triangleOffsets.assign( i_vertexCount + 1, 0 );
+		for ( size_t i = 0; i < i_indexCount; ++i )
+		{
+			++o_triangleOffsets[i_indices[i] + 1];
+		}
+		for ( uint32_t i = 0; i < i_vertexCount; ++i )
+		{
+			o_triangleOffsets[i + 1] += o_triangleOffsets[i];
+		}
+		o_vertexTriangles.resize( i_indexCount );
+		std::vector<uint32_t> writeOffsets( o_triangleOffsets.begin(), o_triangleOffsets.end() - 1 );
+		for ( size_t i = 0; i < i_indexCount; ++i )
+		{
+			o_vertexTriangles[writeOffsets[i_indices[i]]++] = static_cast<uint32_t>( i / 3 );
+		}
+	}
+}
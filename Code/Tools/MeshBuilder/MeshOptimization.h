@@ -0,0 +1,69 @@
+/*
+	This file contains the reordering that the mesh builder does so that meshes are cheaper to draw
+
+	The order of the triangles doesn't change how a mesh looks (other than how much overdraw there is),
+	but it does change how often the GPU has to transform a vertex that it recently transformed:
+		* Triangles are reordered with Tipsify (Sander, Nehab, and Barczak, 2007)
+			so that vertices are reused while they are still in the post-transform cache
+		* Triangles can then also be reordered in clusters
+			so that the ones facing out from the mesh are drawn first
+			and hide the ones behind them (which reduces overdraw without changing the cache order much)
+		* Vertices are reordered in the order that they are first used
+			so that the vertices that are fetched together are next to each other in memory
+
+	The triangles of each level of detail are reordered separately
+	(they are drawn separately),
+	but the vertices are shared and so they are reordered once for all of them.
+*/
+
+#ifndef EAE6320_MESHOPTIMIZATION_H
+#define EAE6320_MESHOPTIMIZATION_H
+
+// Header Files
+//=============
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "../../Engine/Graphics/VertexData.h"
+
+// Interface
+//==========
+
+namespace eae6320
+{
+	namespace AssetBuild
+	{
+		// The number of vertices that the post-transform cache is assumed to hold
+		// (it is used both to reorder triangles and to measure the result)
+		const unsigned int s_vertexCacheSize = 16;
+
+		struct sVertexCacheStatistics
+		{
+			// The average cache miss ratio is the number of vertices transformed per triangle
+			// (it can't be lower than 0.5, and 3 means that no vertex was ever reused)
+			float acmr;
+			// The average transform to vertex ratio is the number of times each vertex is transformed
+			// (it can't be lower than 1)
+			float atvr;
+		};
+
+		// Simulates a FIFO post-transform cache drawing the indices
+		sVertexCacheStatistics AnalyzeVertexCache( const uint32_t* const i_indices, const size_t i_indexCount, const uint32_t i_vertexCount );
+
+		// Reorders triangles in place for the post-transform cache.
+		// If o_clusterOffsets isn't NULL it is filled with the first index of every cluster,
+		// which is a run of triangles that was started after the cache had nothing useful left in it.
+		void OptimizeVertexCache( uint32_t* const io_indices, const size_t i_indexCount, const uint32_t i_vertexCount,
+			std::vector<size_t>* const o_clusterOffsets = NULL );
+		// Reorders clusters (as returned by OptimizeVertexCache()) in place
+		// so that the ones facing away from the center of the mesh are drawn first
+		void OptimizeOverdraw( const Graphics::sVertex* const i_vertices, uint32_t* const io_indices, const size_t i_indexCount,
+			const std::vector<size_t>& i_clusterOffsets );
+		// Reorders vertices in the order that the indices first use them and updates the indices to match.
+		// Vertices that aren't used are removed.
+		void OptimizeVertexFetch( std::vector<Graphics::sVertex>& io_vertices, std::vector<uint32_t>& io_indices );
+	}
+}
+
+#endif	// EAE6320_MESHOPTIMIZATION_H
@@ -0,0 +1,415 @@
+// Header Files
+//=============
+
+#include "MeshSimplification.h"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+// Helper Class Declarations
+//==========================
+
+namespace
+{
+	// The error of moving a vertex to a point is the sum of the squared distances from the point
+	// to every plane of the triangles that the vertex (or anything collapsed into it) touched.
+	// That sum can be stored as a symmetric 4x4 matrix (only the upper triangle is stored).
+	struct sQuadric
+	{
+		double a00, a01, a02, a03;
+		double a11, a12, a13;
+		double a22, a23;
+		double a33;
+
+		void Add( const sQuadric& i_other );
+		double Evaluate( const double* const i_point ) const;
+
+		// The plane's normal must be normalized
+		static sQuadric CreateFromPlane( const double i_a, const double i_b, const double i_c, const double i_d );
+	};
+
+	struct sCollapse
+	{
+		double error;
+		// The source vertex is moved onto the target vertex
+		uint32_t source;
+		uint32_t target;
+
+		bool operator <( const sCollapse& i_rhs ) const { return error < i_rhs.error; }
+	};
+}
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	// Gives every vertex the index of the first vertex that has the same position
+	// and the index of the first vertex that is identical to it
+	void FindSharedVertices( const eae6320::Graphics::sVertex* const i_vertices, const uint32_t i_vertexCount,
+		std::vector<uint32_t>& o_positionIds, std::vector<uint32_t>& o_vertexIds );
+	bool AreAttributesEqual( const eae6320::Graphics::sVertex& i_lhs, const eae6320::Graphics::sVertex& i_rhs );
+	void CalculateNormal( const double* const i_position0, const double* const i_position1, const double* const i_position2, double* const o_normal );
+	uint64_t MakeEdgeKey( const uint32_t i_vertex0, const uint32_t i_vertex1 );
+}
+
+// Interface
+//==========
+
+void eae6320::AssetBuild::SimplifyMesh( const Graphics::sVertex* const i_vertices, const uint32_t i_vertexCount,
+	const std::vector<uint32_t>& i_indices, const size_t i_targetIndexCount,
+	std::vector<uint32_t>& o_indices, float& o_error )
+{
+	o_indices = i_indices;
+	o_error = 0.0f;
+	if ( o_indices.size() <= i_targetIndexCount )
+	{
+		return;
+	}
+
+	// Vertices that share a position are treated as a single vertex
+	// when deciding what is locked and when calculating the error.
+	// Vertices that are identical are merged
+	// (otherwise every vertex of a mesh whose triangles don't share vertices would be treated as a seam).
+	std::vector<uint32_t> positionIds, vertexIds;
+	FindSharedVertices( i_vertices, i_vertexCount, positionIds, vertexIds );
+	for ( uint32_t& index : o_indices )
+	{
+		index = vertexIds[index];
+	}
+
+	std::vector<double> positions( i_vertexCount * 3 );
+	for ( uint32_t i = 0; i < i_vertexCount; ++i )
+	{
+		positions[( i * 3 ) + 0] = i_vertices[i].x;
+		positions[( i * 3 ) + 1] = i_vertices[i].y;
+		positions[( i * 3 ) + 2] = i_vertices[i].z;
+	}
+
+	// Find the vertices that must not be moved
+	std::vector<bool> isLocked( i_vertexCount, false );
+	{
+		// Vertices on seams
+		// (i.e. vertices that share a position with a different vertex)
+		for ( uint32_t i = 0; i < i_vertexCount; ++i )
+		{
+			if ( ( vertexIds[i] == i ) && ( positionIds[i] != i ) )
+			{
+				isLocked[i] = true;
+				isLocked[positionIds[i]] = true;
+			}
+		}
+		// Vertices on borders
+		// (an edge on a border is only used by one triangle)
+		std::unordered_map<uint64_t, uint32_t> edgeUseCounts;
+		for ( size_t i = 0; i < o_indices.size(); i += 3 )
+		{
+			for ( unsigned int j = 0; j < 3; ++j )
+			{
+				++edgeUseCounts[MakeEdgeKey( positionIds[o_indices[i + j]], positionIds[o_indices[i + ( ( j + 1 ) % 3 )]] )];
+			}
+		}
+		std::vector<bool> isPositionOnBorder( i_vertexCount, false );
+		for ( const auto& edgeUseCount : edgeUseCounts )
+		{
+			if ( edgeUseCount.second == 1 )
+			{
+				isPositionOnBorder[static_cast<uint32_t>( edgeUseCount.first >> 32 )] = true;
+				isPositionOnBorder[static_cast<uint32_t>( edgeUseCount.first & 0xffffffff )] = true;
+			}
+		}
+		for ( uint32_t i = 0; i < i_vertexCount; ++i )
+		{
+			if ( isPositionOnBorder[positionIds[i]] )
+			{
+				isLocked[i] = true;
+			}
+		}
+	}
+
+	// Every position starts with the planes of the triangles that touch it
+	std::vector<sQuadric> quadrics( i_vertexCount, sQuadric() );
+	for ( size_t i = 0; i < o_indices.size(); i += 3 )
+	{
+		const double* const position0 = &positions[o_indices[i + 0] * 3];
+		double normal[3];
+		CalculateNormal( position0, &positions[o_indices[i + 1] * 3], &positions[o_indices[i + 2] * 3], normal );
+		const double length = std::sqrt( ( normal[0] * normal[0] ) + ( normal[1] * normal[1] ) + ( normal[2] * normal[2] ) );
+		if ( length > 0.0 )
+		{
+			const double a = normal[0] / length, b = normal[1] / length, c = normal[2] / length;
+			const double d = -( ( a * position0[0] ) + ( b * position0[1] ) + ( c * position0[2] ) );
+			const sQuadric quadric = sQuadric::CreateFromPlane( a, b, c, d );
+			for ( unsigned int j = 0; j < 3; ++j )
+			{
+				quadrics[positionIds[o_indices[i + j]]].Add( quadric );
+			}
+		}
+	}
+
+	// Each pass finds every possible collapse and makes the cheapest ones that don't affect each other.
+	// A vertex can only be part of one collapse per pass,
+	// and so the error of every collapse that is made is still correct when it is made.
+	std::vector<uint32_t> triangleOffsets( i_vertexCount + 1 );
+	std::vector<uint32_t> vertexTriangles;
+	std::vector<sCollapse> collapses;
+	std::vector<uint32_t> remap( i_vertexCount );
+	std::vector<bool> wasTouched( i_vertexCount );
+	double maxError = 0.0;
+	while ( o_indices.size() > i_targetIndexCount )
+	{
+		const size_t triangleCount = o_indices.size() / 3;
+
+		// Find the triangles that use each vertex
+		std::fill( triangleOffsets.begin(), triangleOffsets.end(), 0 );
+		for ( const uint32_t index : o_indices )
+		{
+			++triangleOffsets[index + 1];
+		}
+		for ( uint32_t i = 0; i < i_vertexCount; ++i )
+		{
+			triangleOffsets[i + 1] += triangleOffsets[i];
+		}
+		vertexTriangles.resize( o_indices.size() );
+		{
+			std::vector<uint32_t> writeOffsets( triangleOffsets.begin(), triangleOffsets.end() - 1 );
+			for ( size_t i = 0; i < o_indices.size(); ++i )
+			{
+				vertexTriangles[writeOffsets[o_indices[i]]++] = static_cast<uint32_t>( i / 3 );
+			}
+		}
+
+		// Find every collapse that could be made
+		collapses.clear();
+		for ( size_t i = 0; i < o_indices.size(); i += 3 )
+		{
+			for ( unsigned int j = 0; j < 3; ++j )
+			{
+				const uint32_t vertex0 = o_indices[i + j];
+				const uint32_t vertex1 = o_indices[i + ( ( j + 1 ) % 3 )];
+				const uint32_t directions[2][2] = { { vertex0, vertex1 }, { vertex1, vertex0 } };
+				for ( unsigned int k = 0; k < 2; ++k )
+				{
+					const uint32_t source = directions[k][0];
+					const uint32_t target = directions[k][1];
+					if ( !isLocked[source] )
+					{
+						sQuadric quadric = quadrics[positionIds[source]];
+						quadric.Add( quadrics[positionIds[target]] );
+						sCollapse collapse;
+						collapse.error = quadric.Evaluate( &positions[target * 3] );
+						collapse.source = source;
+						collapse.target = target;
+						collapses.push_back( collapse );
+					}
+				}
+			}
+		}
+		std::sort( collapses.begin(), collapses.end() );
+
+		// Most collapses remove two triangles,
+		// and so only about half of the remaining difference is collapsed each pass
+		// so that the result doesn't end up far below the target
+		const size_t targetTriangleCount = i_targetIndexCount / 3;
+		const size_t maxCollapseCount = std::max<size_t>( ( triangleCount - targetTriangleCount ) / 2, 1 );
+		size_t collapseCount = 0;
+		for ( uint32_t i = 0; i < i_vertexCount; ++i )
+		{
+			remap[i] = i;
+		}
+		std::fill( wasTouched.begin(), wasTouched.end(), false );
+		for ( const sCollapse& collapse : collapses )
+		{
+			if ( collapseCount >= maxCollapseCount )
+			{
+				break;
+			}
+			if ( wasTouched[collapse.source] || wasTouched[collapse.target] )
+			{
+				continue;
+			}
+			// The collapse isn't allowed if it would flip any of the triangles that move
+			// (or turn one of them too far)
+			bool wouldFlip = false;
+			for ( uint32_t j = triangleOffsets[collapse.source]; ( j < triangleOffsets[collapse.source + 1] ) && !wouldFlip; ++j )
+			{
+				const uint32_t* const triangle = &o_indices[vertexTriangles[j] * 3];
+				if ( ( triangle[0] == collapse.target ) || ( triangle[1] == collapse.target ) || ( triangle[2] == collapse.target ) )
+				{
+					// This triangle will be removed
+					continue;
+				}
+				const double* corners[3];
+				const double* corners_moved[3];
+				for ( unsigned int k = 0; k < 3; ++k )
+				{
+					corners[k] = &positions[triangle[k] * 3];
+					corners_moved[k] = ( triangle[k] == collapse.source ) ? &positions[collapse.target * 3] : corners[k];
+				}
+				double normal[3], normal_moved[3];
+				CalculateNormal( corners[0], corners[1], corners[2], normal );
+				CalculateNormal( corners_moved[0], corners_moved[1], corners_moved[2], normal_moved );
+				const double dot = ( normal[0] * normal_moved[0] ) + ( normal[1] * normal_moved[1] ) + ( normal[2] * normal_moved[2] );
+				const double lengths = std::sqrt(
+					( ( normal[0] * normal[0] ) + ( normal[1] * normal[1] ) + ( normal[2] * normal[2] ) )
+					* ( ( normal_moved[0] * normal_moved[0] ) + ( normal_moved[1] * normal_moved[1] ) + ( normal_moved[2] * normal_moved[2] ) ) );
+				// The normal may turn by up to about 75 degrees
+				wouldFlip = dot <= ( 0.25 * lengths );
+			}
+			if ( wouldFlip )
+			{
+				continue;
+			}
+
+			remap[collapse.source] = collapse.target;
+			// Every vertex of every triangle that moved is touched
+			// so that the flip test above only ever sees triangles that haven't changed in this pass
+			for ( uint32_t j = triangleOffsets[collapse.source]; j < triangleOffsets[collapse.source + 1]; ++j )
+			{
+				const uint32_t* const triangle = &o_indices[vertexTriangles[j] * 3];
+				wasTouched[triangle[0]] = wasTouched[triangle[1]] = wasTouched[triangle[2]] = true;
+			}
+			wasTouched[collapse.target] = true;
+			quadrics[positionIds[collapse.target]].Add( quadrics[positionIds[collapse.source]] );
+			maxError = std::max( maxError, collapse.error );
+			++collapseCount;
+		}
+		if ( collapseCount == 0 )
+		{
+			break;
+		}
+
+		// Move the collapsed vertices and remove the triangles that no longer have any area
+		size_t indexCount = 0;
+		for ( size_t i = 0; i < o_indices.size(); i += 3 )
+		{
+			const uint32_t vertex0 = remap[o_indices[i + 0]];
+			const uint32_t vertex1 = remap[o_indices[i + 1]];
+			const uint32_t vertex2 = remap[o_indices[i + 2]];
+			const uint32_t position0 = positionIds[vertex0], position1 = positionIds[vertex1], position2 = positionIds[vertex2];
+			if ( ( position0 != position1 ) && ( position1 != position2 ) && ( position2 != position0 ) )
+			{
+				o_indices[indexCount++] = vertex0;
+				o_indices[indexCount++] = vertex1;
+				o_indices[indexCount++] = vertex2;
+			}
+		}
+		o_indices.resize( indexCount );
+	}
+
+	o_error = static_cast<float>( std::sqrt( std::max( maxError, 0.0 ) ) );
+}
+
+// Helper Class Definitions
+//=========================
+
+namespace
+{
+	void sQuadric::Add( const sQuadric& i_other )
+	{
+		a00 += i_other.a00; a01 += i_other.a01; a02 += i_other.a02; a03 += i_other.a03;
+		a11 += i_other.a11; a12 += i_other.a12; a13 += i_other.a13;
+		a22 += i_other.a22; a23 += i_other.a23;
+		a33 += i_other.a33;
+	}
+
+	double sQuadric::Evaluate( const double* const i_point ) const
+	{
+		const double x = i_point[0], y = i_point[1], z = i_point[2];
+		return ( x * x * a00 ) + ( 2.0 * x * y * a01 ) + ( 2.0 * x * z * a02 ) + ( 2.0 * x * a03 )
+			+ ( y * y * a11 ) + ( 2.0 * y * z * a12 ) + ( 2.0 * y * a13 )
+			+ ( z * z * a22 ) + ( 2.0 * z * a23 )
+			+ a33;
+	}
+
+	sQuadric sQuadric::CreateFromPlane( const double i_a, const double i_b, const double i_c, const double i_d )
+	{
+		sQuadric quadric;
+		quadric.a00 = i_a * i_a; quadric.a01 = i_a * i_b; quadric.a02 = i_a * i_c; quadric.a03 = i_a * i_d;
+		quadric.a11 = i_b * i_b; quadric.a12 = i_b * i_c; quadric.a13 = i_b * i_d;
+		quadric.a22 = i_c * i_c; quadric.a23 = i_c * i_d;
+		quadric.a33 = i_d * i_d;
+		return quadric;
+	}
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	void FindSharedVertices( const eae6320::Graphics::sVertex* const i_vertices, const uint32_t i_vertexCount,
+		std::vector<uint32_t>& o_positionIds, std::vector<uint32_t>& o_vertexIds )
+	{
+		// The vertices are sorted by position (and then by their other attributes)
+		// so that the ones with the same position are next to each other
+		std::vector<uint32_t> sortedVertices( i_vertexCount );
+		for ( uint32_t i = 0; i < i_vertexCount; ++i )
+		{
+			sortedVertices[i] = i;
+		}
+		const auto isLess = [i_vertices]( const uint32_t i_lhs, const uint32_t i_rhs )
+		{
+			const eae6320::Graphics::sVertex& lhs = i_vertices[i_lhs];
+			const eae6320::Graphics::sVertex& rhs = i_vertices[i_rhs];
+			if ( lhs.x != rhs.x ) return lhs.x < rhs.x;
+			if ( lhs.y != rhs.y ) return lhs.y < rhs.y;
+			if ( lhs.z != rhs.z ) return lhs.z < rhs.z;
+			if ( lhs.u != rhs.u ) return lhs.u < rhs.u;
+			if ( lhs.v != rhs.v ) return lhs.v < rhs.v;
+			if ( lhs.red != rhs.red ) return lhs.red < rhs.red;
+			if ( lhs.green != rhs.green ) return lhs.green < rhs.green;
+			if ( lhs.blue != rhs.blue ) return lhs.blue < rhs.blue;
+			if ( lhs.alpha != rhs.alpha ) return lhs.alpha < rhs.alpha;
+			// Ties are broken by index so that the first of the identical vertices comes first
+			return i_lhs < i_rhs;
+		};
+		std::sort( sortedVertices.begin(), sortedVertices.end(), isLess );
+
+		o_positionIds.resize( i_vertexCount );
+		o_vertexIds.resize( i_vertexCount );
+		uint32_t firstWithPosition = 0, firstIdentical = 0;
+		for ( uint32_t i = 0; i < i_vertexCount; ++i )
+		{
+			const eae6320::Graphics::sVertex& vertex = i_vertices[sortedVertices[i]];
+			if ( i > 0 )
+			{
+				const eae6320::Graphics::sVertex& previousVertex = i_vertices[sortedVertices[i - 1]];
+				if ( ( vertex.x != previousVertex.x ) || ( vertex.y != previousVertex.y ) || ( vertex.z != previousVertex.z ) )
+				{
+					firstWithPosition = firstIdentical = i;
+				}
+				else if ( !AreAttributesEqual( vertex, previousVertex ) )
+				{
+					firstIdentical = i;
+				}
+			}
+			// The first vertex with a position isn't necessarily the one with the lowest index,
+			// but it's always the same one for every vertex with that position
+			o_positionIds[sortedVertices[i]] = sortedVertices[firstWithPosition];
+			o_vertexIds[sortedVertices[i]] = sortedVertices[firstIdentical];
+		}
+	}
+
+	bool AreAttributesEqual( const eae6320::Graphics::sVertex& i_lhs, const eae6320::Graphics::sVertex& i_rhs )
+	{
+		return ( i_lhs.u == i_rhs.u ) && ( i_lhs.v == i_rhs.v )
+			&& ( i_lhs.red == i_rhs.red ) && ( i_lhs.green == i_rhs.green ) && ( i_lhs.blue == i_rhs.blue ) && ( i_lhs.alpha == i_rhs.alpha );
+	}
+
+	void CalculateNormal( const double* const i_position0, const double* const i_position1, const double* const i_position2, double* const o_normal )
+	{
+		const double edge0[3] = { i_position1[0] - i_position0[0], i_position1[1] - i_position0[1], i_position1[2] - i_position0[2] };
+		const double edge1[3] = { i_position2[0] - i_position0[0], i_position2[1] - i_position0[1], i_position2[2] - i_position0[2] };
+		o_normal[0] = ( edge0[1] * edge1[2] ) - ( edge0[2] * edge1[1] );
+		o_normal[1] = ( edge0[2] * edge1[0] ) - ( edge0[0] * edge1[2] );
+		o_normal[2] = ( edge0[0] * edge1[1] ) - ( edge0[1] * edge1[0] );
+	}
+
+	uint64_t MakeEdgeKey( const uint32_t i_vertex0, const uint32_t i_vertex1 )
+	{
+		// The key is the same regardless of which direction the edge goes
+		return ( static_cast<uint64_t>( std::min( i_vertex0, i_vertex1 ) ) << 32 ) | std::max( i_vertex0, i_vertex1 );
+	}
+}
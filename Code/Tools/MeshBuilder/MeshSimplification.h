@@ -0,0 +1,44 @@
+/*
+	This file contains the mesh simplification that the mesh builder uses to create levels of detail
+
+	A mesh is simplified by collapsing edges (moving one vertex onto another)
+	in the order of how much each collapse changes the surface,
+	which is measured with quadric error metrics (Garland and Heckbert, 1997).
+	Vertices are only ever moved onto existing vertices,
+	and so every level of detail uses the same vertices as the original mesh
+	and only needs its own indices.
+
+	Vertices that are identical are merged first.
+	Vertices that share a position with a different vertex (e.g. on a texture seam)
+	and vertices on the border of an open surface are never moved,
+	which keeps seams from tearing and holes from growing.
+*/
+
+#ifndef EAE6320_MESHSIMPLIFICATION_H
+#define EAE6320_MESHSIMPLIFICATION_H
+
+// Header Files
+//=============
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "../../Engine/Graphics/VertexData.h"
+
+// Interface
+//==========
+
+namespace eae6320
+{
+	namespace AssetBuild
+	{
+		// Collapses edges until there are no more than the target number of indices
+		// (or until no more edges can be collapsed without a triangle flipping over or a seam or border changing).
+		// o_error is the distance from the original surface of the worst collapse that was made.
+		void SimplifyMesh( const Graphics::sVertex* const i_vertices, const uint32_t i_vertexCount,
+			const std::vector<uint32_t>& i_indices, const size_t i_targetIndexCount,
+			std::vector<uint32_t>& o_indices, float& o_error );
+	}
+}
+
+#endif	// EAE6320_MESHSIMPLIFICATION_H
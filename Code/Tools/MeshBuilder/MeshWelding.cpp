@@ -0,0 +1,175 @@
+// Header Files
+//=============
+
+#include "MeshWelding.h"
+
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <unordered_map>
+
+// Helper Class Declarations
+//==========================
+
+namespace
+{
+	struct sVertexHash
+	{
+		size_t operator ()( const eae6320::Graphics::sVertex& i_vertex ) const;
+	};
+	struct sVertexEqual
+	{
+		bool operator ()( const eae6320::Graphics::sVertex& i_lhs, const eae6320::Graphics::sVertex& i_rhs ) const;
+	};
+}
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	bool AreAttributesEqual( const eae6320::Graphics::sVertex& i_lhs, const eae6320::Graphics::sVertex& i_rhs );
+	size_t HashFloat( const float i_value );
+	void CombineHash( const size_t i_value, size_t& io_hash );
+	uint64_t MakeCellKey( const int64_t i_x, const int64_t i_y, const int64_t i_z );
+}
+
+// Interface
+//==========
+
+void eae6320::AssetBuild::WeldVertices( std::vector<Graphics::sVertex>& io_vertices, std::vector<uint32_t>& io_indices, const float i_distance )
+{
+	const uint32_t vertexCount = static_cast<uint32_t>( io_vertices.size() );
+	std::vector<uint32_t> remap( vertexCount );
+	std::vector<Graphics::sVertex> vertices;
+	vertices.reserve( vertexCount );
+
+	if ( !( i_distance > 0.0f ) )
+	{
+		std::unordered_map<Graphics::sVertex, uint32_t, sVertexHash, sVertexEqual> weldedVertices( vertexCount );
+		for ( uint32_t i = 0; i < vertexCount; ++i )
+		{
+			const auto result = weldedVertices.insert( std::make_pair( io_vertices[i], static_cast<uint32_t>( vertices.size() ) ) );
+			if ( result.second )
+			{
+				vertices.push_back( io_vertices[i] );
+			}
+			remap[i] = result.first->second;
+		}
+	}
+	else
+	{
+		// Every cell is the size of the distance,
+		// and so any position that is close enough to be welded must be in the same cell or a neighboring one.
+		// Each cell stores the last welded vertex in it,
+		// and each welded vertex stores the one before it in the same cell.
+		const uint32_t noVertex = std::numeric_limits<uint32_t>::max();
+		std::unordered_map<uint64_t, uint32_t> cellLastVertices( vertexCount );
+		std::vector<uint32_t> previousVerticesInCell;
+		previousVerticesInCell.reserve( vertexCount );
+		for ( uint32_t i = 0; i < vertexCount; ++i )
+		{
+			const Graphics::sVertex& vertex = io_vertices[i];
+			const int64_t cellX = static_cast<int64_t>( std::floor( vertex.x / i_distance ) );
+			const int64_t cellY = static_cast<int64_t>( std::floor( vertex.y / i_distance ) );
+			const int64_t cellZ = static_cast<int64_t>( std::floor( vertex.z / i_distance ) );
+			uint32_t weldedVertex = noVertex;
+			for ( int64_t z = ( cellZ - 1 ); ( z <= ( cellZ + 1 ) ) && ( weldedVertex == noVertex ); ++z )
+			{
+				for ( int64_t y = ( cellY - 1 ); ( y <= ( cellY + 1 ) ) && ( weldedVertex == noVertex ); ++y )
+				{
+					for ( int64_t x = ( cellX - 1 ); ( x <= ( cellX + 1 ) ) && ( weldedVertex == noVertex ); ++x )
+					{
+						const auto cell = cellLastVertices.find( MakeCellKey( x, y, z ) );
+						if ( cell == cellLastVertices.end() )
+						{
+							continue;
+						}
+						for ( uint32_t j = cell->second; j != noVertex; j = previousVerticesInCell[j] )
+						{
+							const Graphics::sVertex& otherVertex = vertices[j];
+							if ( ( std::abs( vertex.x - otherVertex.x ) <= i_distance )
+								&& ( std::abs( vertex.y - otherVertex.y ) <= i_distance )
+								&& ( std::abs( vertex.z - otherVertex.z ) <= i_distance )
+								&& AreAttributesEqual( vertex, otherVertex ) )
+							{
+								weldedVertex = j;
+								break;
+							}
+						}
+					}
+				}
+			}
+			if ( weldedVertex == noVertex )
+			{
+				weldedVertex = static_cast<uint32_t>( vertices.size() );
+				vertices.push_back( vertex );
+				uint32_t& cellLastVertex = cellLastVertices.insert( std::make_pair( MakeCellKey( cellX, cellY, cellZ ), noVertex ) ).first->second;
+				previousVerticesInCell.push_back( cellLastVertex );
+				cellLastVertex = weldedVertex;
+			}
+			remap[i] = weldedVertex;
+		}
+	}
+
+	for ( uint32_t& index : io_indices )
+	{
+		index = remap[index];
+	}
+	io_vertices.swap( vertices );
+}
+
+// Helper Class Definitions
+//=========================
+
+namespace
+{
+	size_t sVertexHash::operator ()( const eae6320::Graphics::sVertex& i_vertex ) const
+	{
+		size_t hash = HashFloat( i_vertex.x );
+		CombineHash( HashFloat( i_vertex.y ), hash );
+		CombineHash( HashFloat( i_vertex.z ), hash );
+		CombineHash( HashFloat( i_vertex.u ), hash );
+		CombineHash( HashFloat( i_vertex.v ), hash );
+		CombineHash( ( static_cast<size_t>( i_vertex.red ) << 24 ) | ( static_cast<size_t>( i_vertex.green ) << 16 )
+			| ( static_cast<size_t>( i_vertex.blue ) << 8 ) | static_cast<size_t>( i_vertex.alpha ), hash );
+		return hash;
+	}
+
+	bool sVertexEqual::operator ()( const eae6320::Graphics::sVertex& i_lhs, const eae6320::Graphics::sVertex& i_rhs ) const
+	{
+		return ( i_lhs.x == i_rhs.x ) && ( i_lhs.y == i_rhs.y ) && ( i_lhs.z == i_rhs.z ) && AreAttributesEqual( i_lhs, i_rhs );
+	}
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	bool AreAttributesEqual( const eae6320::Graphics::sVertex& i_lhs, const eae6320::Graphics::sVertex& i_rhs )
+	{
+		return ( i_lhs.u == i_rhs.u ) && ( i_lhs.v == i_rhs.v )
+			&& ( i_lhs.red == i_rhs.red ) && ( i_lhs.green == i_rhs.green ) && ( i_lhs.blue == i_rhs.blue ) && ( i_lhs.alpha == i_rhs.alpha );
+	}
+
+	size_t HashFloat( const float i_value )
+	{
+		// Positive and negative zero are equal and so they must have the same hash
+		return std::hash<float>()( ( i_value == 0.0f ) ? 0.0f : i_value );
+	}
+
+	void CombineHash( const size_t i_value, size_t& io_hash )
+	{
+		io_hash ^= i_value + 0x9e3779b9 + ( io_hash << 6 ) + ( io_hash >> 2 );
+	}
+
+	uint64_t MakeCellKey( const int64_t i_x, const int64_t i_y, const int64_t i_z )
+	{
+		// Only the low 21 bits of each coordinate are kept.
+		// Cells that are far apart can end up with the same key,
+		// but that only means that the distance has to be checked for more vertices.
+		const uint64_t mask = ( uint64_t( 1 ) << 21 ) - 1;
+		return ( static_cast<uint64_t>( i_x ) & mask ) | ( ( static_cast<uint64_t>( i_y ) & mask ) << 21 ) | ( ( static_cast<uint64_t>( i_z ) & mask ) << 42 );
+	}
+}
@@ -0,0 +1,42 @@
+/*
+	This file contains the vertex welding that the mesh builder does before anything else
+
+	The exporter writes a separate vertex for every corner of every triangle,
+	and so most vertices are identical to others.
+	Welding keeps only one of each and updates the indices to match,
+	which makes the vertex buffer smaller
+	and lets the post-transform cache and the mesh simplification see which triangles are connected.
+
+	Vertices are found with a hash table:
+		* By default only identical vertices are welded
+		* If a distance is given then vertices whose positions are that close are also welded
+			(their other attributes must still be identical so that seams are kept),
+			and they are found by hashing positions into cells of that size
+			and looking in the neighboring cells
+*/
+
+#ifndef EAE6320_MESHWELDING_H
+#define EAE6320_MESHWELDING_H
+
+// Header Files
+//=============
+
+#include <cstdint>
+#include <vector>
+#include "../../Engine/Graphics/VertexData.h"
+
+// Interface
+//==========
+
+namespace eae6320
+{
+	namespace AssetBuild
+	{
+		// Removes vertices that are the same as an earlier vertex and updates the indices to use the earlier one.
+		// If i_distance is greater than zero
+		// then positions are the same if none of their coordinates differ by more than it.
+		void WeldVertices( std::vector<Graphics::sVertex>& io_vertices, std::vector<uint32_t>& io_indices, const float i_distance = 0.0f );
+	}
+}
+
+#endif	// EAE6320_MESHWELDING_H
@@ -5,18 +5,91 @@
 #include "cMayaMeshParser.h"
 #include <sstream>
 #include <fstream> 
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include "MeshOptimization.h"
+#include "MeshSimplification.h"
+#include "MeshWelding.h"
+#include "../AssetBuildLibrary/AtlasTable.h"
 #include "../AssetBuildLibrary/UtilityFunctions.h"
+#include "../../Engine/Math/BoundingVolumes.h"
+#include "../../Engine/Math/Quantization.h"
 #include "../../Engine/Platform/Platform.h"
 
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+	// The atlas must have already been built.
+	// The size of the atlas texture and the atlas's gutter are returned
+	// so that the compressed texture coordinates can be checked against them.
+	bool MoveTextureCoordinatesIntoAtlas(const std::string& i_atlasPath, const std::string& i_imagePath, const char* const i_meshPath,
+		std::vector<eae6320::Graphics::sVertex>& io_vertices, uint16_t& o_atlasWidth, uint16_t& o_atlasHeight, uint16_t& o_gutter);
+}
+
 // Inherited Implementation
 //=========================
 
 // Build
 //------
 
-bool eae6320::AssetBuild::cMeshBuilder::Build(const std::vector<std::string>&)
+bool eae6320::AssetBuild::cMeshBuilder::Build(const std::vector<std::string>& i_arguments)
 {
 	bool wereThereErrors = false;
+	// Levels of detail are only built for meshes that ask for them
+	// (there's no point in simplifying the level itself because the camera is always inside of it)
+	bool shouldBuildLods = false;
+	// Ordering triangles to reduce overdraw makes the post-transform cache a little less effective,
+	// and so it's only done for meshes that ask for it
+	bool shouldOptimizeOverdraw = false;
+	// Only identical vertices are welded unless a distance is given
+	// (e.g. "weld=0.01" also welds vertices whose positions are that close)
+	float weldDistance = 0.0f;
+	// If the mesh's texture is in an atlas then its texture coordinates are moved to the texture's place in the atlas
+	// (e.g. "atlas=Textures/level.atlas" and "atlasImage=Textures/walls.png")
+	std::string atlasPath, atlasImagePath;
+	uint16_t atlasWidth = 0, atlasHeight = 0, atlasGutter = 0;
+	for (const std::string& argument : i_arguments)
+	{
+		if (argument == "lods")
+		{
+			shouldBuildLods = true;
+		}
+		else if (argument == "overdraw")
+		{
+			shouldOptimizeOverdraw = true;
+		}
+		else if (argument.compare(0, 5, "weld=") == 0)
+		{
+			char* end;
+			weldDistance = std::strtof(argument.c_str() + 5, &end);
+			if ((*end != '\0') || !(weldDistance >= 0.0f))
+			{
+				std::ostringstream errorMessage;
+				errorMessage << "\"" << argument << "\" must be \"weld=\" followed by a distance that isn't negative";
+				OutputErrorMessage(errorMessage.str().c_str(), m_path_source);
+				return false;
+			}
+		}
+		else if (argument.compare(0, 6, "atlas=") == 0)
+		{
+			atlasPath = argument.substr(6);
+		}
+		else if (argument.compare(0, 11, "atlasImage=") == 0)
+		{
+			atlasImagePath = argument.substr(11);
+		}
+		else
+		{
+			std::ostringstream errorMessage;
+			errorMessage << "\"" << argument << "\" is not a valid mesh build argument";
+			OutputErrorMessage(errorMessage.str().c_str(), m_path_source);
+			return false;
+		}
+	}
 	{
 		std::string copyErrorMessage;
 		cMayaMeshParser mayaMeshParser;
@@ -27,18 +100,320 @@ bool eae6320::AssetBuild::cMeshBuilder::Build(const std::vector<std::string>&)
 			eae6320::AssetBuild::OutputErrorMessage(errorMessage.str().c_str(), __FILE__);
 			return false;
 		}
-		
-			std::ofstream outfile(m_path_target, std::ofstream::binary);
-			outfile.write(reinterpret_cast<char*>(&mayaMeshParser.verticesCount), sizeof(uint32_t));
-			outfile.write(reinterpret_cast<char*>(&mayaMeshParser.indicesCount), sizeof(uint32_t));
-			outfile.write(reinterpret_cast<char*>(mayaMeshParser.vertexData), sizeof(eae6320::Graphics::sVertex) * mayaMeshParser.verticesCount);
-			outfile.write(reinterpret_cast<char*>(mayaMeshParser.indices), sizeof(uint32_t) * mayaMeshParser.indicesCount);
-			outfile.close();
 
-			delete[] mayaMeshParser.vertexData;
-			delete[] mayaMeshParser.indices;
+			// The parser's arrays were allocated with malloc()
+			std::vector<Graphics::sVertex> vertices(mayaMeshParser.vertexData, mayaMeshParser.vertexData + mayaMeshParser.verticesCount);
+			std::vector<uint32_t> indices(mayaMeshParser.indices, mayaMeshParser.indices + mayaMeshParser.indicesCount);
+			free(mayaMeshParser.vertexData);
+			free(mayaMeshParser.indices);
 			mayaMeshParser.vertexData = NULL;
 			mayaMeshParser.indices = NULL;
+
+			if (!atlasPath.empty() || !atlasImagePath.empty())
+			{
+				if (!MoveTextureCoordinatesIntoAtlas(atlasPath, atlasImagePath, m_path_source, vertices, atlasWidth, atlasHeight, atlasGutter))
+				{
+					return false;
+				}
+			}
+
+			{
+				const size_t vertexCount_beforeWelding = vertices.size();
+				WeldVertices(vertices, indices, weldDistance);
+				std::cout << m_path_source << ": Welding reduced " << vertexCount_beforeWelding << " vertices to " << vertices.size() << "\n";
+			}
+
+			// The bounds are calculated here so that the game doesn't have to look at every vertex when a mesh is loaded.
+			// The sphere is centered on the box
+			// (which isn't the smallest possible sphere but is always close enough for culling)
+			Math::sAABB boundingBox;
+			Math::sSphere boundingSphere = { Math::cVector(), 0.0f };
+			if (!vertices.empty())
+			{
+				boundingBox.m_min = boundingBox.m_max = Math::cVector(vertices[0].x, vertices[0].y, vertices[0].z);
+				for (size_t i = 1; i < vertices.size(); ++i)
+				{
+					boundingBox.Expand(Math::cVector(vertices[i].x, vertices[i].y, vertices[i].z));
+				}
+				boundingSphere.m_center = boundingBox.GetCenter();
+				for (size_t i = 0; i < vertices.size(); ++i)
+				{
+					boundingSphere.m_radius = std::max(boundingSphere.m_radius,
+						(Math::cVector(vertices[i].x, vertices[i].y, vertices[i].z) - boundingSphere.m_center).GetLength());
+				}
+			}
+
+			// The first level of detail is the original mesh,
+			// and each of the others is simplified from the one before it.
+			// They all use the same vertices, and so only their indices are added.
+			struct sLod
+			{
+				uint32_t firstIndex;
+				uint32_t indexCount;
+			};
+			std::vector<sLod> lods;
+			const uint32_t vertexCount = static_cast<uint32_t>(vertices.size());
+			{
+				const sLod lod = { 0, static_cast<uint32_t>(indices.size()) };
+				lods.push_back(lod);
+				std::cout << m_path_source << ": LOD 0 has " << (lod.indexCount / 3) << " triangles\n";
+			}
+			if (shouldBuildLods)
+			{
+				// Each level of detail has about this fraction of the original triangles
+				const float triangleRatios[] = { 0.5f, 0.25f, 0.125f };
+				std::vector<uint32_t> previousLodIndices(indices);
+				std::vector<uint32_t> lodIndices;
+				for (const float triangleRatio : triangleRatios)
+				{
+					const size_t targetTriangleCount = static_cast<size_t>((lods[0].indexCount / 3) * triangleRatio);
+					float error;
+					SimplifyMesh(vertices.data(), vertexCount, previousLodIndices, targetTriangleCount * 3,
+						lodIndices, error);
+					// If the mesh can't be simplified much further then another level of detail wouldn't help
+					if (lodIndices.empty() || (lodIndices.size() > ((previousLodIndices.size() * 9) / 10)))
+					{
+						std::cout << m_path_source << ": LOD " << lods.size() << " was skipped because the mesh can't be simplified any further\n";
+						break;
+					}
+					const sLod lod = { static_cast<uint32_t>(indices.size()), static_cast<uint32_t>(lodIndices.size()) };
+					std::cout << m_path_source << ": LOD " << lods.size() << " has " << (lod.indexCount / 3) << " triangles"
+						" (the target was " << targetTriangleCount << " and the largest error is " << error << ")\n";
+					lods.push_back(lod);
+					indices.insert(indices.end(), lodIndices.begin(), lodIndices.end());
+					previousLodIndices.swap(lodIndices);
+				}
+			}
+
+			// The triangles of each level of detail are reordered for the post-transform cache
+			// and then the vertices are reordered for all of them
+			for (size_t i = 0; i < lods.size(); ++i)
+			{
+				uint32_t* const lodIndices = indices.data() + lods[i].firstIndex;
+				const sVertexCacheStatistics statistics_before = AnalyzeVertexCache(lodIndices, lods[i].indexCount, vertexCount);
+				std::vector<size_t> clusterOffsets;
+				OptimizeVertexCache(lodIndices, lods[i].indexCount, vertexCount,
+					shouldOptimizeOverdraw ? &clusterOffsets : NULL);
+				if (shouldOptimizeOverdraw)
+				{
+					OptimizeOverdraw(vertices.data(), lodIndices, lods[i].indexCount, clusterOffsets);
+				}
+				const sVertexCacheStatistics statistics_after = AnalyzeVertexCache(lodIndices, lods[i].indexCount, vertexCount);
+				std::cout << m_path_source << ": LOD " << i << " ACMR " << statistics_before.acmr << " -> " << statistics_after.acmr
+					<< ", ATVR " << statistics_before.atvr << " -> " << statistics_after.atvr;
+				if (shouldOptimizeOverdraw)
+				{
+					std::cout << " (" << clusterOffsets.size() << " clusters ordered for overdraw)";
+				}
+				std::cout << "\n";
+			}
+			OptimizeVertexFetch(vertices, indices);
+
+			// Indices are only 32 bit if there are too many vertices for 16 bit indices
+			const uint32_t vertexCount_optimized = static_cast<uint32_t>(vertices.size());
+			const uint32_t indexCount = static_cast<uint32_t>(indices.size());
+			const uint32_t indexSize = (vertexCount_optimized <= 0x10000) ? sizeof(uint16_t) : sizeof(uint32_t);
+			std::cout << m_path_source << ": The indices are " << (indexSize * 8) << " bit\n";
+
+			// Vertices are only compressed for OpenGL
+			// (Direct3D's input layout belongs to the effect rather than the mesh and is always for uncompressed vertices)
+			Graphics::sVertexFormat vertexFormat = { Graphics::VertexFormats::Uncompressed, { 1.0f, 1.0f, 1.0f }, { 0.0f, 0.0f, 0.0f } };
+			std::vector<Graphics::sVertex_compressed> vertices_compressed;
+#if defined(EAE6320_PLATFORM_GL)
+			if (!vertices.empty())
+			{
+				// Positions are quantized to the bounding box
+				// (an axis that the mesh is flat on still needs a size to divide by)
+				Math::sAABB quantizationBounds = boundingBox;
+				float* const boundsMin[] = { &quantizationBounds.m_min.x, &quantizationBounds.m_min.y, &quantizationBounds.m_min.z };
+				float* const boundsMax[] = { &quantizationBounds.m_max.x, &quantizationBounds.m_max.y, &quantizationBounds.m_max.z };
+				vertexFormat.type = Graphics::VertexFormats::Compressed;
+				for (unsigned int i = 0; i < 3; ++i)
+				{
+					if (!(*boundsMax[i] > *boundsMin[i]))
+					{
+						*boundsMax[i] = *boundsMin[i] + 1.0f;
+					}
+					vertexFormat.positionScale[i] = *boundsMax[i] - *boundsMin[i];
+					vertexFormat.positionBias[i] = *boundsMin[i];
+				}
+
+				// Texture coordinates in an atlas need more precision than half floats have near 1
+				// (1/2048, which is a whole texel of a 2048 atlas),
+				// and so they are stored as 16 bit fractions if they are all in [0,1]
+				const bool isInAtlas = !atlasPath.empty();
+				bool areTextureCoordinatesUnorm = isInAtlas;
+				for (size_t i = 0; areTextureCoordinatesUnorm && (i < vertices.size()); ++i)
+				{
+					areTextureCoordinatesUnorm = (vertices[i].u >= 0.0f) && (vertices[i].u <= 1.0f) && (vertices[i].v >= 0.0f) && (vertices[i].v <= 1.0f);
+				}
+				if (areTextureCoordinatesUnorm)
+				{
+					vertexFormat.type = Graphics::VertexFormats::Compressed_unormTextureCoordinates;
+				}
+
+				vertices_compressed.resize(vertices.size());
+				float maxPositionError = 0.0f, maxTextureCoordinateError = 0.0f;
+				float maxTextureCoordinateError_u = 0.0f, maxTextureCoordinateError_v = 0.0f;
+				for (size_t i = 0; i < vertices.size(); ++i)
+				{
+					const Graphics::sVertex& vertex = vertices[i];
+					Graphics::sVertex_compressed& vertex_compressed = vertices_compressed[i];
+					const Math::cVector position(vertex.x, vertex.y, vertex.z);
+					const Math::sQuantizedPosition position_quantized = Math::QuantizePosition(position, quantizationBounds);
+					vertex_compressed.x = position_quantized.x;
+					vertex_compressed.y = position_quantized.y;
+					vertex_compressed.z = position_quantized.z;
+					vertex_compressed.padding = 0;
+					vertex_compressed.red = vertex.red;
+					vertex_compressed.blue = vertex.blue;
+					vertex_compressed.green = vertex.green;
+					vertex_compressed.alpha = vertex.alpha;
+					float u_decoded, v_decoded;
+					if (areTextureCoordinatesUnorm)
+					{
+						vertex_compressed.u = static_cast<uint16_t>(std::lround(vertex.u * 65535.0f));
+						vertex_compressed.v = static_cast<uint16_t>(std::lround(vertex.v * 65535.0f));
+						u_decoded = static_cast<float>(vertex_compressed.u) / 65535.0f;
+						v_decoded = static_cast<float>(vertex_compressed.v) / 65535.0f;
+					}
+					else
+					{
+						vertex_compressed.u = Math::EncodeHalfFloat(vertex.u);
+						vertex_compressed.v = Math::EncodeHalfFloat(vertex.v);
+						u_decoded = Math::DecodeHalfFloat(vertex_compressed.u);
+						v_decoded = Math::DecodeHalfFloat(vertex_compressed.v);
+					}
+
+					const Math::cVector positionError = Math::DequantizePosition(position_quantized, quantizationBounds) - position;
+					maxPositionError = std::max(maxPositionError,
+						std::max(std::abs(positionError.x), std::max(std::abs(positionError.y), std::abs(positionError.z))));
+					maxTextureCoordinateError_u = std::max(maxTextureCoordinateError_u, std::abs(u_decoded - vertex.u));
+					maxTextureCoordinateError_v = std::max(maxTextureCoordinateError_v, std::abs(v_decoded - vertex.v));
+				}
+				maxTextureCoordinateError = std::max(maxTextureCoordinateError_u, maxTextureCoordinateError_v);
+				std::cout << m_path_source << ": Compressing the vertices reduced them from " << (vertices.size() * sizeof(Graphics::sVertex))
+					<< " to " << (vertices_compressed.size() * sizeof(Graphics::sVertex_compressed)) << " bytes"
+					" (the largest position error is " << maxPositionError << " and the largest texture coordinate error is " << maxTextureCoordinateError << ")\n";
+				if (isInAtlas)
+				{
+					// A texture coordinate that is off by as many texels as the gutter reads the neighboring image
+					// (without a gutter anything more than half a texel does)
+					const float maxTextureCoordinateError_texels = std::max(maxTextureCoordinateError_u * atlasWidth, maxTextureCoordinateError_v * atlasHeight);
+					const float maxAllowedError_texels = std::max(static_cast<float>(atlasGutter), 0.5f);
+					std::cout << m_path_source << ": The texture coordinates are " << (areTextureCoordinatesUnorm ? "16 bit fractions" : "half floats")
+						<< " and are at most " << maxTextureCoordinateError_texels << " texels from where they should be in the atlas\n";
+					if (!(maxTextureCoordinateError_texels < maxAllowedError_texels))
+					{
+						std::ostringstream errorMessage;
+						errorMessage << "The compressed texture coordinates are up to " << maxTextureCoordinateError_texels
+							<< " texels from where they should be, which isn't less than the atlas " << atlasPath << "'s gutter of " << atlasGutter << " texels";
+						OutputErrorMessage(errorMessage.str().c_str(), m_path_source);
+						return false;
+					}
+				}
+			}
+#endif
+
+			// The file is the vertex and index counts, the index size, the vertex format, the bounds, the levels of detail, the vertices, and then the indices
+			std::ofstream outfile(m_path_target, std::ofstream::binary);
+			const uint32_t lodCount = static_cast<uint32_t>(lods.size());
+			outfile.write(reinterpret_cast<const char*>(&vertexCount_optimized), sizeof(uint32_t));
+			outfile.write(reinterpret_cast<const char*>(&indexCount), sizeof(uint32_t));
+			outfile.write(reinterpret_cast<const char*>(&indexSize), sizeof(uint32_t));
+			outfile.write(reinterpret_cast<const char*>(&vertexFormat), sizeof(Graphics::sVertexFormat));
+			outfile.write(reinterpret_cast<char*>(&boundingBox), sizeof(Math::sAABB));
+			outfile.write(reinterpret_cast<char*>(&boundingSphere), sizeof(Math::sSphere));
+			outfile.write(reinterpret_cast<const char*>(&lodCount), sizeof(uint32_t));
+			outfile.write(reinterpret_cast<const char*>(lods.data()), sizeof(sLod) * lodCount);
+			if (Graphics::VertexFormats::IsCompressed(vertexFormat.type))
+			{
+				outfile.write(reinterpret_cast<const char*>(vertices_compressed.data()), sizeof(Graphics::sVertex_compressed) * vertexCount_optimized);
+			}
+			else
+			{
+				outfile.write(reinterpret_cast<const char*>(vertices.data()), sizeof(Graphics::sVertex) * vertexCount_optimized);
+			}
+			if (indexSize == sizeof(uint16_t))
+			{
+				const std::vector<uint16_t> indices_16(indices.begin(), indices.end());
+				outfile.write(reinterpret_cast<const char*>(indices_16.data()), sizeof(uint16_t) * indexCount);
+			}
+			else
+			{
+				outfile.write(reinterpret_cast<const char*>(indices.data()), sizeof(uint32_t) * indexCount);
+			}
+			outfile.close();
 	}
 	return !wereThereErrors;
 }
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+	bool MoveTextureCoordinatesIntoAtlas(const std::string& i_atlasPath, const std::string& i_imagePath, const char* const i_meshPath,
+		std::vector<eae6320::Graphics::sVertex>& io_vertices, uint16_t& o_atlasWidth, uint16_t& o_atlasHeight, uint16_t& o_gutter)
+	{
+		if (i_atlasPath.empty() || i_imagePath.empty())
+		{
+			eae6320::AssetBuild::OutputErrorMessage("\"atlas=\" and \"atlasImage=\" must both be given", i_meshPath);
+			return false;
+		}
+		eae6320::AssetBuild::sAtlasTable atlasTable;
+		{
+			std::string errorMessage;
+			if (!atlasTable.LoadBuiltAtlas(i_atlasPath.c_str(), &errorMessage))
+			{
+				eae6320::AssetBuild::OutputErrorMessage(errorMessage.c_str(), i_meshPath);
+				return false;
+			}
+		}
+		const eae6320::AssetBuild::sAtlasTable::sImage* const image = atlasTable.FindImage(i_imagePath.c_str());
+		if (!image)
+		{
+			std::ostringstream errorMessage;
+			errorMessage << i_imagePath << " isn't in the atlas " << i_atlasPath;
+			eae6320::AssetBuild::OutputErrorMessage(errorMessage.str().c_str(), i_meshPath);
+			return false;
+		}
+		const eae6320::AssetBuild::sAtlasTable::sTexture& texture = atlasTable.textures[image->textureIndex];
+		// The atlas's rectangles are measured from the top of the texture (the same as the source images),
+		// but OpenGL texture coordinates are measured from the bottom (see cSprite::GetTextureCoordinates())
+		const float scale_u = static_cast<float>(image->width) / static_cast<float>(texture.width);
+		const float scale_v = static_cast<float>(image->height) / static_cast<float>(texture.height);
+		const float offset_u = static_cast<float>(image->left) / static_cast<float>(texture.width);
+#if defined(EAE6320_PLATFORM_GL)
+		const float offset_v = static_cast<float>(texture.height - image->top - image->height) / static_cast<float>(texture.height);
+#else
+		const float offset_v = static_cast<float>(image->top) / static_cast<float>(texture.height);
+#endif
+		// Texture coordinates outside of the image would have repeated it,
+		// but in the atlas they read the gutter and then the neighboring images
+		{
+			const float tolerance = 1.0f / 1024.0f;
+			for (const eae6320::Graphics::sVertex& vertex : io_vertices)
+			{
+				if ((vertex.u < -tolerance) || (vertex.u > (1.0f + tolerance)) || (vertex.v < -tolerance) || (vertex.v > (1.0f + tolerance)))
+				{
+					std::ostringstream errorMessage;
+					errorMessage << "The mesh has texture coordinates outside of [0,1] (" << vertex.u << ", " << vertex.v << ")"
+						", which can't repeat the image " << i_imagePath << " in the atlas " << i_atlasPath;
+					eae6320::AssetBuild::OutputErrorMessage(errorMessage.str().c_str(), i_meshPath);
+					return false;
+				}
+			}
+		}
+		for (eae6320::Graphics::sVertex& vertex : io_vertices)
+		{
+			vertex.u = offset_u + (vertex.u * scale_u);
+			vertex.v = offset_v + (vertex.v * scale_v);
+		}
+		o_atlasWidth = texture.width;
+		o_atlasHeight = texture.height;
+		o_gutter = atlasTable.gutter;
+		std::cout << i_meshPath << ": Texture coordinates were moved into " << i_imagePath << " in atlas texture " << texture.builtRelativePath << "\n";
+		return true;
+	}
+}
@@ -120,9 +120,11 @@ local function RegisterAssetToBeBuilt( i_sourceAssetRelativePath, i_assetType, i
 			registrationInfo = { path = uniquePath, assetTypeInfo = assetTypeInfo, arguments = arguments }
 			-- (This table is simultaneously used as a dictionary and an array)
 			registeredAssetsToBuild[uniquePath] = registrationInfo
+			-- Any assets that are referenced by this asset are registered first
+			-- so that they are built before it
+			-- (e.g. a material uses the built atlas to know which texture to use)
+			assetTypeInfo.RegisterReferencedAssets( uniquePath, arguments )
 			registeredAssetsToBuild[#registeredAssetsToBuild + 1] = registrationInfo
-			-- And also register any assets that are referenced by this asset
-			assetTypeInfo.RegisterReferencedAssets( uniquePath )
 		else
 			-- If this source asset has already been registered then the information must be identical
 			if assetTypeInfo ~= registrationInfo.assetTypeInfo then
@@ -160,7 +162,7 @@ function cbAssetTypeInfo.ConvertSourceRelativePathToBuiltRelativePath( i_sourceR
 end
 
 -- You will need to override the following function for some new asset types, but not for all
-function cbAssetTypeInfo.RegisterReferencedAssets( i_sourceRelativePath )
+function cbAssetTypeInfo.RegisterReferencedAssets( i_sourceRelativePath, i_arguments )
 	-- Some asset types reference other assets
 	-- (e.g. materials use textures and effects, and effects use shaders).
 	-- This function registers any assets that are referenced by the given source asset.
@@ -169,13 +171,29 @@ function cbAssetTypeInfo.RegisterReferencedAssets( i_sourceRelativePath )
 end
 
 -- You may need to override the following function for some new asset types, but not for many
-function cbAssetTypeInfo.ShouldTargetBeBuilt( i_lastWriteTime_builtAsset )
+function cbAssetTypeInfo.ShouldTargetBeBuilt( i_lastWriteTime_builtAsset, i_sourceRelativePath, i_arguments )
 	-- By default this returns false,
 	-- because there are no special dependencies for this asset type
 	-- that need to be taken into account
 	return false
 end
 
+-- Meshes and materials that use an atlas have to be built again whenever the atlas is
+local function IsBuiltAtlasNewer( i_atlasSourceRelativePath, i_lastWriteTime_builtAsset )
+	local path_builtAtlas = s_BuiltAssetDir .. assetTypeInfos["atlases"].ConvertSourceRelativePathToBuiltRelativePath( i_atlasSourceRelativePath )
+	return DoesFileExist( path_builtAtlas ) and ( GetLastWriteTime( path_builtAtlas ) > i_lastWriteTime_builtAsset )
+end
+
+-- A mesh's atlas is passed to the builder as an "atlas=" argument
+local function GetMeshAtlasPath( i_arguments )
+	for i, argument in ipairs( i_arguments ) do
+		local path_atlas = argument:match( "^atlas=(.+)$" )
+		if path_atlas then
+			return path_atlas
+		end
+	end
+end
+
 -- Mesh Asset Type
 --------------------
 
@@ -185,6 +203,16 @@ NewAssetTypeInfo( "meshes",
 		GetBuilderRelativePath = function()
 			return "MeshBuilder.exe"
 		end,
+		RegisterReferencedAssets = function( i_sourceRelativePath, i_arguments )
+			local path_atlas = GetMeshAtlasPath( i_arguments )
+			if path_atlas then
+				RegisterAssetToBeBuilt( path_atlas, "atlases" )
+			end
+		end,
+		ShouldTargetBeBuilt = function( i_lastWriteTime_builtAsset, i_sourceRelativePath, i_arguments )
+			local path_atlas = GetMeshAtlasPath( i_arguments )
+			return path_atlas ~= nil and IsBuiltAtlasNewer( path_atlas, i_lastWriteTime_builtAsset )
+		end,
 	}
 )
 
@@ -268,7 +296,10 @@ NewAssetTypeInfo("materials",
 				
 				local path_texture = material.texturePath
 				local path_texture_type = type( path_texture )
-				if path_texture_type == "nil" then
+				if material.atlasPath then
+					-- The texture's image is in an atlas, and so the atlas's textures are used instead
+					RegisterAssetToBeBuilt( material.atlasPath, "atlases")
+				elseif path_texture_type == "nil" then
 					RegisterAssetToBeBuilt( "Textures/default.tga", "textures")
 				elseif path_texture_type == "string" then
 					RegisterAssetToBeBuilt( path_texture, "textures")
@@ -277,6 +308,16 @@ NewAssetTypeInfo("materials",
 				end					
 			end
 		end,
+		ShouldTargetBeBuilt = function( i_lastWriteTime_builtAsset, i_sourceRelativePath )
+			local sourceAbsolutePath = s_AuthoredAssetDir .. i_sourceRelativePath
+			if DoesFileExist( sourceAbsolutePath ) then
+				local material = dofile( sourceAbsolutePath )
+				if type( material.atlasPath ) == "string" then
+					return IsBuiltAtlasNewer( material.atlasPath, i_lastWriteTime_builtAsset )
+				end
+			end
+			return false
+		end,
 	}
 )
 
@@ -297,6 +338,32 @@ NewAssetTypeInfo( "textures",
  )
 
 
+--Atlas Asset type
+---------------------
+NewAssetTypeInfo( "atlases",
+	{
+		GetBuilderRelativePath = function()
+			return "AtlasBuilder.exe"
+		end,
+		-- The atlas has to be built again if any of its images have changed
+		ShouldTargetBeBuilt = function( i_lastWriteTime_builtAsset, i_sourceRelativePath )
+			local sourceAbsolutePath = s_AuthoredAssetDir .. i_sourceRelativePath
+			if DoesFileExist( sourceAbsolutePath ) then
+				local atlas = dofile( sourceAbsolutePath )
+				if type( atlas ) == "table" and type( atlas.images ) == "table" then
+					for i, path_image in ipairs( atlas.images ) do
+						local path_image_absolute = s_AuthoredAssetDir .. path_image
+						if DoesFileExist( path_image_absolute ) and ( GetLastWriteTime( path_image_absolute ) > i_lastWriteTime_builtAsset ) then
+							return true
+						end
+					end
+				end
+			end
+			return false
+		end,
+	}
+)
+
 -- Function Definitions
 --=====================
 
@@ -350,7 +417,7 @@ local function BuildAsset( i_assetInfo )
 				shouldTargetBeBuilt = lastWriteTime_builder > lastWriteTime_target
 				if not shouldTargetBeBuilt then
 					-- There might be other dependencies specific to this asset type
-					shouldTargetBeBuilt = assetTypeInfo.ShouldTargetBeBuilt( lastWriteTime_target )
+					shouldTargetBeBuilt = assetTypeInfo.ShouldTargetBeBuilt( lastWriteTime_target, i_assetInfo.path, i_assetInfo.arguments )
 				end
 			end
 		else